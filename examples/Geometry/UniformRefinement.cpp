@@ -15,6 +15,9 @@ int main(int, char**)
   Mesh mesh;
   mesh = mesh.UniformGrid(Polytope::Type::Triangle, { 16, 16 });
 
+  UniformRefinement refinement(mesh);
+  Mesh refined = refinement.refine();
+  refined.save("UniformRefinement.mesh");
+
   return 0;
 }
-
@@ -32,6 +32,18 @@ namespace Rodin::Assembly
 
       virtual OperatorType execute(const InputType& data) const = 0;
 
+      /**
+       * @brief Executes the assembly into an existing operator.
+       *
+       * Implementations may reuse the storage of @p res if it is compatible
+       * with the structure of the assembled operator. By default, @p res is
+       * replaced by the result of execute(const InputType&).
+       */
+      virtual void execute(OperatorType& res, const InputType& data) const
+      {
+        res = execute(data);
+      }
+
       virtual AssemblyBase* copy() const noexcept = 0;
   };
 
@@ -0,0 +1,411 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_BLOCKSPARSEMATRIX_H
+#define RODIN_ASSEMBLY_BLOCKSPARSEMATRIX_H
+
+#include <vector>
+
+#include "Rodin/Alert/Exception.h"
+
+#include "Rodin/Math/Matrix.h"
+#include "Rodin/Math/BlockSparseMatrix.h"
+
+#include "Rodin/Threads/ThreadPool.h"
+
+#include "Rodin/Variational/BilinearForm.h"
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "ForwardDecls.h"
+#include "AssemblyBase.h"
+#include "Sequential.h"
+#include "Multithreaded.h"
+
+namespace Rodin::Assembly::Internal
+{
+  /**
+   * @brief Computes the pattern of the Math::BlockSparseMatrix associated to
+   * a bilinear form, and scatters the element matrices into its blocks.
+   *
+   * The degree of freedom @f$ i + c m @f$ of a space of vector dimension @f$
+   * b @f$ and size @f$ b m @f$ is the component @f$ c @f$ of the node @f$ i
+   * @f$, which is the case of the vector P1 spaces. Hence the block @f$ (i,
+   * j) @f$ is nonzero if the nodes @f$ i @f$ and @f$ j @f$ belong to the
+   * same polytope of an integration region.
+   */
+  template <class TrialFES, class TestFES>
+  class BlockSparseMatrixBuilder
+  {
+    public:
+      using ScalarType =
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type;
+
+      using OperatorType = Math::BlockSparseMatrix<ScalarType>;
+
+      using StorageIndex = typename OperatorType::StorageIndex;
+
+      using InputType = BilinearFormAssemblyInput<TrialFES, TestFES>;
+
+      BlockSparseMatrixBuilder(const InputType& input)
+        : m_input(input)
+      {
+        const auto& trialFES = input.getTrialFES();
+        const auto& testFES = input.getTestFES();
+        m_blockSize = testFES.getVectorDimension();
+        if (trialFES.getVectorDimension() != m_blockSize)
+        {
+          Alert::Exception()
+            << "The trial and test spaces of a block sparse operator must have "
+            << "the same vector dimension."
+            << Alert::Raise;
+        }
+        if (input.getGlobalBFIs().size() > 0)
+        {
+          Alert::Exception()
+            << "Global integrators cannot be assembled into a block sparse operator."
+            << Alert::Raise;
+        }
+        assert(testFES.getSize() % m_blockSize == 0);
+        assert(trialFES.getSize() % m_blockSize == 0);
+        m_rows = testFES.getSize() / m_blockSize;
+        m_cols = trialFES.getSize() / m_blockSize;
+      }
+
+      /**
+       * @brief Returns the operator with its pattern, and all its values set
+       * to zero.
+       */
+      OperatorType initialize() const
+      {
+        const auto& trialFES = m_input.get().getTrialFES();
+        const auto& testFES = m_input.get().getTestFES();
+        const auto& mesh = testFES.getMesh();
+        FlatSet<size_t> dims;
+        for (auto& bfi : m_input.get().getLocalBFIs())
+          dims.insert(MultithreadedIteration(mesh, bfi.getRegion()).getDimension());
+
+        std::vector<std::vector<StorageIndex>> pattern(m_rows);
+        for (const size_t d : dims)
+        {
+          for (Index i = 0; i < mesh.getPolytopeCount(d); i++)
+          {
+            const auto& rows = testFES.getDOFs(d, i);
+            const auto& cols = trialFES.getDOFs(d, i);
+            for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+            {
+              auto& row = pattern[rows(l) % m_rows];
+              for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                row.push_back(cols(m) % m_cols);
+            }
+          }
+        }
+        OperatorType res(m_rows, m_cols, m_blockSize);
+        res.setPattern(pattern);
+        return res;
+      }
+
+      /**
+       * @brief Adds the element matrix @p mat, whose rows and columns are
+       * the degrees of freedom @p rows and @p cols, to @p res.
+       */
+      void add(
+          OperatorType& res,
+          const IndexArray& rows, const IndexArray& cols, const Math::Matrix<ScalarType>& mat) const
+      {
+        const size_t b = m_blockSize;
+        for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+        {
+          const Index i = rows(l) % m_rows;
+          const Index r = rows(l) / m_rows;
+          for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+          {
+            const Index j = cols(m) % m_cols;
+            const Index s = cols(m) / m_cols;
+            const auto k = res.getBlockPosition(i, j);
+            assert(k.has_value());
+            res.getBlock(*k)[r * b + s] += mat(l, m);
+          }
+        }
+      }
+
+    private:
+      std::reference_wrapper<const InputType> m_input;
+      size_t m_blockSize;
+      size_t m_rows;
+      size_t m_cols;
+  };
+}
+
+namespace Rodin::Assembly
+{
+  /**
+   * @brief %Sequential assembly of the Math::BlockSparseMatrix associated to
+   * a BilinearForm object.
+   *
+   * The block size is the vector dimension of the finite element spaces,
+   * whose degrees of freedom must be ordered by component (see
+   * Math::BlockSparseMatrix). Only the local integrators are supported.
+   *
+   * # Utilization
+   *
+   * @code{cpp}
+   * P1 vh(mesh, mesh.getSpaceDimension());
+   * BilinearForm<decltype(vh), decltype(vh), Math::BlockSparseMatrix<Real>> a(u, v);
+   * a = LinearElasticityIntegral(u, v)(lambda, mu);
+   * Solver::CG cg(a.getOperator());
+   * @endcode
+   *
+   * @note Include Rodin/Assembly/BlockSparseMatrix.h before constructing a
+   * BilinearForm whose operator is a Math::BlockSparseMatrix.
+   */
+  template <class TrialFES, class TestFES>
+  class Sequential<
+    Math::BlockSparseMatrix<
+      typename FormLanguage::Dot<
+        typename FormLanguage::Traits<TrialFES>::ScalarType,
+        typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+    Variational::BilinearForm<
+      TrialFES, TestFES,
+      Math::BlockSparseMatrix<
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>> final
+    : public AssemblyBase<
+        Math::BlockSparseMatrix<
+          typename FormLanguage::Dot<
+            typename FormLanguage::Traits<TrialFES>::ScalarType,
+            typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+        Variational::BilinearForm<TrialFES, TestFES,
+          Math::BlockSparseMatrix<
+            typename FormLanguage::Dot<
+              typename FormLanguage::Traits<TrialFES>::ScalarType,
+              typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>>
+  {
+    public:
+      using ScalarType =
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type;
+
+      using OperatorType = Math::BlockSparseMatrix<ScalarType>;
+
+      using BilinearFormType = Variational::BilinearForm<TrialFES, TestFES, OperatorType>;
+
+      using Parent = AssemblyBase<OperatorType, BilinearFormType>;
+
+      using InputType = typename Parent::InputType;
+
+      using BuilderType = Internal::BlockSparseMatrixBuilder<TrialFES, TestFES>;
+
+      Sequential() = default;
+
+      Sequential(const Sequential& other)
+        : Parent(other)
+      {}
+
+      Sequential(Sequential&& other)
+        : Parent(std::move(other))
+      {}
+
+      /**
+       * @brief Executes the assembly and returns the block sparse matrix
+       * associated to the bilinear form.
+       */
+      OperatorType execute(const InputType& input) const override
+      {
+        const BuilderType builder(input);
+        OperatorType res = builder.initialize();
+        Math::Matrix<ScalarType> mat;
+        const auto& mesh = input.getTestFES().getMesh();
+        for (auto& bfi : input.getLocalBFIs())
+        {
+          const auto& attrs = bfi.getAttributes();
+          Internal::SequentialIteration seq(mesh, bfi.getRegion());
+          for (auto it = seq.getIterator(); it; ++it)
+          {
+            if (attrs.size() == 0 || attrs.count(it->getAttribute()))
+            {
+              bfi.setPolytope(*it);
+              const auto& rows = input.getTestFES().getDOFs(it.getDimension(), it->getIndex());
+              const auto& cols = input.getTrialFES().getDOFs(it.getDimension(), it->getIndex());
+              mat.resize(rows.size(), cols.size());
+              bfi.getElementMatrix(mat);
+              builder.add(res, rows, cols, mat);
+            }
+          }
+        }
+        return res;
+      }
+
+      Sequential* copy() const noexcept override
+      {
+        return new Sequential(*this);
+      }
+  };
+
+  /**
+   * @brief %Multithreaded assembly of the Math::BlockSparseMatrix associated
+   * to a BilinearForm object.
+   *
+   * The polytopes are processed color by color (see
+   * Geometry::Mesh::getColoring), so that the element matrices of one color
+   * are added in parallel to the blocks without locks.
+   *
+   * @see Sequential<Math::BlockSparseMatrix, BilinearForm>
+   */
+  template <class TrialFES, class TestFES>
+  class Multithreaded<
+    Math::BlockSparseMatrix<
+      typename FormLanguage::Dot<
+        typename FormLanguage::Traits<TrialFES>::ScalarType,
+        typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+    Variational::BilinearForm<
+      TrialFES, TestFES,
+      Math::BlockSparseMatrix<
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>> final
+    : public AssemblyBase<
+        Math::BlockSparseMatrix<
+          typename FormLanguage::Dot<
+            typename FormLanguage::Traits<TrialFES>::ScalarType,
+            typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+        Variational::BilinearForm<TrialFES, TestFES,
+          Math::BlockSparseMatrix<
+            typename FormLanguage::Dot<
+              typename FormLanguage::Traits<TrialFES>::ScalarType,
+              typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>>
+  {
+    public:
+      using ScalarType =
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type;
+
+      using OperatorType = Math::BlockSparseMatrix<ScalarType>;
+
+      using LocalBilinearFormIntegratorBaseType = Variational::LocalBilinearFormIntegratorBase<ScalarType>;
+
+      using BilinearFormType = Variational::BilinearForm<TrialFES, TestFES, OperatorType>;
+
+      using Parent = AssemblyBase<OperatorType, BilinearFormType>;
+
+      using InputType = typename Parent::InputType;
+
+      using BuilderType = Internal::BlockSparseMatrixBuilder<TrialFES, TestFES>;
+
+#ifdef RODIN_MULTITHREADED
+      Multithreaded()
+        : Multithreaded(Threads::getGlobalThreadPool())
+      {}
+#else
+      Multithreaded()
+        : Multithreaded(std::thread::hardware_concurrency())
+      {}
+#endif
+
+      Multithreaded(std::reference_wrapper<Threads::ThreadPool> pool)
+        : m_pool(pool)
+      {}
+
+      Multithreaded(size_t threadCount)
+        : m_pool(threadCount)
+      {
+        assert(threadCount > 0);
+      }
+
+      Multithreaded(const Multithreaded& other)
+        : Parent(other),
+          m_pool(
+            std::visit(
+              [](auto&& arg) -> std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>
+              {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::reference_wrapper<Threads::ThreadPool>>)
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(arg);
+                else
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(
+                      std::in_place_type_t<Threads::ThreadPool>(), arg.getThreadCount());
+              }, other.m_pool))
+      {}
+
+      Multithreaded(Multithreaded&& other)
+        : Parent(std::move(other)),
+          m_pool(std::move(other.m_pool))
+      {}
+
+      /**
+       * @brief Executes the assembly and returns the block sparse matrix
+       * associated to the bilinear form.
+       */
+      OperatorType execute(const InputType& input) const override
+      {
+        const BuilderType builder(input);
+        OperatorType res = builder.initialize();
+        auto& threadPool = getThreadPool();
+        const auto& testFES = input.getTestFES();
+        const auto& trialFES = input.getTrialFES();
+        const auto& mesh = testFES.getMesh();
+        for (auto& bfi : input.getLocalBFIs())
+        {
+          const auto& attrs = bfi.getAttributes();
+          Internal::MultithreadedIteration seq(mesh, bfi.getRegion());
+          const size_t d = seq.getDimension();
+          for (const auto& color : mesh.getColoring(d))
+          {
+            auto loop =
+              [&](const Index start, const Index end)
+              {
+                Math::Matrix<ScalarType> mat;
+                std::unique_ptr<LocalBilinearFormIntegratorBaseType> lbfi;
+                lbfi.reset(bfi.copy());
+                for (Index j = start; j < end; ++j)
+                {
+                  const Index i = color[j];
+                  if (seq.filter(i))
+                  {
+                    if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
+                    {
+                      const auto polytope = seq.getPolytope(i);
+                      lbfi->setPolytope(polytope);
+                      const auto& rows = testFES.getDOFs(d, i);
+                      const auto& cols = trialFES.getDOFs(d, i);
+                      mat.resize(rows.size(), cols.size());
+                      lbfi->getElementMatrix(mat);
+                      builder.add(res, rows, cols, mat);
+                    }
+                  }
+                }
+              };
+            threadPool.pushLoop(0, color.size(), loop);
+            threadPool.waitForTasks();
+          }
+        }
+        return res;
+      }
+
+      Threads::ThreadPool& getThreadPool() const
+      {
+        if (std::holds_alternative<Threads::ThreadPool>(m_pool))
+          return std::get<Threads::ThreadPool>(m_pool);
+        else
+          return std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+      }
+
+      Multithreaded* copy() const noexcept override
+      {
+        return new Multithreaded(*this);
+      }
+
+    private:
+      mutable std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>> m_pool;
+  };
+}
+
+#endif
@@ -0,0 +1,348 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_BLOCKED_H
+#define RODIN_ASSEMBLY_BLOCKED_H
+
+#include <vector>
+#include <algorithm>
+
+#include "Rodin/Math/Matrix.h"
+
+#include "Rodin/Threads/Mutex.h"
+#include "Rodin/Threads/ThreadPool.h"
+
+#include "Rodin/Variational/BilinearForm.h"
+
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "ForwardDecls.h"
+#include "AssemblyBase.h"
+#include "Multithreaded.h"
+
+namespace Rodin::Assembly
+{
+  /**
+   * @brief Blocked multithreaded assembly of the dense Math::Matrix associated
+   * to a BilinearFormBase object.
+   *
+   * This assembly is meant for bilinear forms with global integrators, where
+   * every test polytope interacts with every trial polytope. The test and
+   * trial polytopes are split in blocks of getBlockSize() polytopes, and the
+   * tiles (test block) @f$ \times @f$ (trial block) are evaluated so that
+   * the data of a trial block is reused by all the polytopes of the test
+   * block. Each test block is processed by one task of the thread pool, which
+   * accumulates its contributions into a buffer holding only the rows of the
+   * degrees of freedom of the block. The buffer is then added to the
+   * column-major storage of the resulting matrix, one stripe of
+   * getBlockSize() rows at a time, under the lock of the stripe. Hence only
+   * the blocks whose degrees of freedom fall in the same stripe are
+   * serialized.
+   *
+   * The contributions of the local integrators are written directly into the
+   * resulting matrix.
+   */
+  template <class TrialFES, class TestFES>
+  class Blocked<
+    Math::Matrix<
+      typename FormLanguage::Dot<
+        typename FormLanguage::Traits<TrialFES>::ScalarType,
+        typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+    Variational::BilinearForm<
+      TrialFES, TestFES,
+      Math::Matrix<
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>> final
+    : public AssemblyBase<
+        Math::Matrix<
+          typename FormLanguage::Dot<
+            typename FormLanguage::Traits<TrialFES>::ScalarType,
+            typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+        Variational::BilinearForm<TrialFES, TestFES,
+          Math::Matrix<
+            typename FormLanguage::Dot<
+              typename FormLanguage::Traits<TrialFES>::ScalarType,
+              typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>>
+  {
+    public:
+      using ScalarType =
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type;
+
+      using OperatorType = Math::Matrix<ScalarType>;
+
+      using LocalBilinearFormIntegratorBaseType = Variational::LocalBilinearFormIntegratorBase<ScalarType>;
+
+      using GlobalBilinearFormIntegratorBaseType = Variational::GlobalBilinearFormIntegratorBase<ScalarType>;
+
+      using BilinearFormType = Variational::BilinearForm<TrialFES, TestFES, OperatorType>;
+
+      using Parent = AssemblyBase<OperatorType, BilinearFormType>;
+
+      using InputType = typename Parent::InputType;
+
+#ifdef RODIN_MULTITHREADED
+      Blocked()
+        : Blocked(Threads::getGlobalThreadPool())
+      {}
+#else
+      Blocked()
+        : Blocked(std::thread::hardware_concurrency())
+      {}
+#endif
+
+      Blocked(std::reference_wrapper<Threads::ThreadPool> pool)
+        : m_blockSize(64),
+          m_pool(pool)
+      {}
+
+      Blocked(size_t threadCount)
+        : m_blockSize(64),
+          m_pool(threadCount)
+      {
+        assert(threadCount > 0);
+      }
+
+      Blocked(const Blocked& other)
+        : Parent(other),
+          m_blockSize(other.m_blockSize),
+          m_pool(
+            std::visit(
+              [](auto&& arg) -> std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>
+              {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::reference_wrapper<Threads::ThreadPool>>)
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(arg);
+                else
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(
+                      std::in_place_type_t<Threads::ThreadPool>(), arg.getThreadCount());
+              }, other.m_pool))
+      {}
+
+      Blocked(Blocked&& other)
+        : Parent(std::move(other)),
+          m_blockSize(other.m_blockSize),
+          m_pool(std::move(other.m_pool))
+      {}
+
+      /**
+       * @brief Sets the number of polytopes in each test and trial block.
+       */
+      Blocked& setBlockSize(size_t blockSize)
+      {
+        assert(blockSize > 0);
+        m_blockSize = blockSize;
+        return *this;
+      }
+
+      size_t getBlockSize() const
+      {
+        return m_blockSize;
+      }
+
+      /**
+       * @brief Executes the assembly and returns the linear operator
+       * associated to the bilinear form.
+       */
+      OperatorType execute(const InputType& input) const override
+      {
+        OperatorType res;
+        execute(res, input);
+        return res;
+      }
+
+      /**
+       * @brief Executes the assembly into @p res.
+       *
+       * If @p res already has the right dimensions, its storage is reused.
+       */
+      void execute(OperatorType& res, const InputType& input) const override
+      {
+        auto& threadPool =
+          std::holds_alternative<Threads::ThreadPool>(m_pool) ?
+            std::get<Threads::ThreadPool>(m_pool) :
+            std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+
+        const auto& trialFES = input.getTrialFES();
+        const auto& testFES = input.getTestFES();
+        const auto& mesh = testFES.getMesh();
+
+        res.resize(testFES.getSize(), trialFES.getSize());
+        res.setZero();
+
+        Math::Matrix<ScalarType> mat;
+        for (auto& bfi : input.getLocalBFIs())
+        {
+          const auto& attrs = bfi.getAttributes();
+          Internal::MultithreadedIteration seq(mesh, bfi.getRegion());
+          const size_t d = seq.getDimension();
+          for (Index i = 0; i < seq.getCount(); ++i)
+          {
+            if (seq.filter(i))
+            {
+              if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
+              {
+                const auto polytope = seq.getPolytope(i);
+                bfi.setPolytope(polytope);
+                const auto& rows = testFES.getDOFs(d, i);
+                const auto& cols = trialFES.getDOFs(d, i);
+                mat.resize(rows.size(), cols.size());
+                bfi.getElementMatrix(mat);
+                for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                  for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                    res(rows(l), cols(m)) += mat(l, m);
+              }
+            }
+          }
+        }
+
+        for (auto& bfi : input.getGlobalBFIs())
+        {
+          Internal::MultithreadedIteration testseq(mesh, bfi.getTestRegion());
+          Internal::MultithreadedIteration trialseq(mesh, bfi.getTrialRegion());
+          const size_t testd = testseq.getDimension();
+          const size_t triald = trialseq.getDimension();
+          const std::vector<Index> tests = getPolytopes(mesh, testseq, bfi.getTestAttributes());
+          const std::vector<Index> trials = getPolytopes(mesh, trialseq, bfi.getTrialAttributes());
+          const size_t blockCount = (tests.size() + m_blockSize - 1) / m_blockSize;
+          std::vector<Threads::Mutex> stripes((testFES.getSize() + m_blockSize - 1) / m_blockSize);
+          const auto loop =
+            [&](const Index start, const Index end)
+            {
+              std::unique_ptr<GlobalBilinearFormIntegratorBaseType> gbfi;
+              gbfi.reset(bfi.copy());
+              Math::Matrix<ScalarType> mat;
+              Math::Matrix<ScalarType> buffer;
+              std::vector<Index> dofs;
+              std::vector<Index> offsets;
+              std::vector<Index> locals;
+              std::vector<Geometry::Polytope> tes;
+              std::vector<Geometry::Polytope> trs;
+              for (Index b = start; b < end; ++b)
+              {
+                const size_t first = b * m_blockSize;
+                const size_t last = std::min(first + m_blockSize, tests.size());
+
+                // Rows of the buffer, i.e. the test degrees of freedom of the block
+                dofs.clear();
+                for (size_t p = first; p < last; p++)
+                {
+                  const auto& rows = testFES.getDOFs(testd, tests[p]);
+                  dofs.insert(dofs.end(), rows.begin(), rows.end());
+                }
+                std::sort(dofs.begin(), dofs.end());
+                dofs.erase(std::unique(dofs.begin(), dofs.end()), dofs.end());
+
+                tes.clear();
+                offsets.assign(1, 0);
+                locals.clear();
+                for (size_t p = first; p < last; p++)
+                {
+                  tes.push_back(testseq.getPolytope(tests[p]));
+                  const auto& rows = testFES.getDOFs(testd, tests[p]);
+                  for (const Index row : rows)
+                  {
+                    locals.push_back(
+                        std::lower_bound(dofs.begin(), dofs.end(), row) - dofs.begin());
+                  }
+                  offsets.push_back(locals.size());
+                }
+
+                buffer.resize(dofs.size(), trialFES.getSize());
+                buffer.setZero();
+                for (size_t tfirst = 0; tfirst < trials.size(); tfirst += m_blockSize)
+                {
+                  const size_t tlast = std::min(tfirst + m_blockSize, trials.size());
+                  trs.clear();
+                  for (size_t q = tfirst; q < tlast; q++)
+                    trs.push_back(trialseq.getPolytope(trials[q]));
+                  for (size_t p = 0; p < tes.size(); p++)
+                  {
+                    const Index* const rows = locals.data() + offsets[p];
+                    const size_t rowCount = offsets[p + 1] - offsets[p];
+                    for (const auto& tr : trs)
+                    {
+                      gbfi->setPolytope(tr, tes[p]);
+                      const auto& cols = trialFES.getDOFs(triald, tr.getIndex());
+                      mat.resize(rowCount, cols.size());
+                      gbfi->getElementMatrix(mat);
+                      for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                      {
+                        ScalarType* const col = buffer.col(cols(m)).data();
+                        for (size_t l = 0; l < rowCount; l++)
+                          col[rows[l]] += mat(l, m);
+                      }
+                    }
+                  }
+                }
+
+                // Test blocks may share degrees of freedom, hence the rows
+                // are added by stripes under the lock of each stripe
+                for (size_t lfirst = 0; lfirst < dofs.size();)
+                {
+                  const size_t stripe = dofs[lfirst] / m_blockSize;
+                  size_t llast = lfirst + 1;
+                  while (llast < dofs.size() && dofs[llast] / m_blockSize == stripe)
+                    llast++;
+                  std::lock_guard lock(stripes[stripe]);
+                  for (size_t m = 0; m < static_cast<size_t>(buffer.cols()); m++)
+                  {
+                    const ScalarType* const src = buffer.col(m).data();
+                    ScalarType* const dst = res.col(m).data();
+                    for (size_t l = lfirst; l < llast; l++)
+                      dst[dofs[l]] += src[l];
+                  }
+                  lfirst = llast;
+                }
+              }
+            };
+          threadPool.pushLoop(0, blockCount, loop, blockCount);
+          threadPool.waitForTasks();
+        }
+      }
+
+      const Threads::ThreadPool& getThreadPool() const
+      {
+        if (std::holds_alternative<Threads::ThreadPool>(m_pool))
+          return std::get<Threads::ThreadPool>(m_pool);
+        else
+          return std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+      }
+
+      Blocked* copy() const noexcept override
+      {
+        return new Blocked(*this);
+      }
+
+    private:
+      static std::vector<Index> getPolytopes(
+          const Geometry::MeshBase& mesh,
+          const Internal::MultithreadedIteration& seq,
+          const FlatSet<Geometry::Attribute>& attrs)
+      {
+        const size_t d = seq.getDimension();
+        std::vector<Index> res;
+        res.reserve(seq.getCount());
+        for (Index i = 0; i < seq.getCount(); ++i)
+        {
+          if (seq.filter(i))
+          {
+            if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
+              res.push_back(i);
+          }
+        }
+        return res;
+      }
+
+      size_t m_blockSize;
+      mutable std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>> m_pool;
+  };
+}
+
+#endif
@@ -0,0 +1,377 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_COLORED_H
+#define RODIN_ASSEMBLY_COLORED_H
+
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/SparseMatrix.h"
+
+#include "Rodin/Threads/ThreadPool.h"
+
+#include "Rodin/Variational/LinearForm.h"
+#include "Rodin/Variational/BilinearForm.h"
+
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/LinearFormIntegrator.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "ForwardDecls.h"
+#include "AssemblyBase.h"
+#include "Multithreaded.h"
+#include "SparsityPattern.h"
+
+namespace Rodin::Assembly
+{
+  /**
+   * @brief Colored multithreaded assembly of the Math::SparseMatrix associated
+   * to a BilinearFormBase object.
+   *
+   * The polytopes of each integration region are processed color by color,
+   * using the coloring cached in the mesh (see Geometry::Mesh::getColoring).
+   * Since no two polytopes of the same color share a vertex, the element
+   * matrices of one color are written in parallel directly into the value
+   * array of the compressed matrix, without locks or atomic operations.
+   *
+   * @note This requires that the degrees of freedom of a polytope are only
+   * shared with the polytopes sharing one of its vertices, which is the case
+   * of the P1 spaces.
+   *
+   * If the bilinear form contains global integrators, the assembly falls back
+   * to the Multithreaded assembly.
+   */
+  template <class TrialFES, class TestFES>
+  class Colored<
+    Math::SparseMatrix<
+      typename FormLanguage::Dot<
+        typename FormLanguage::Traits<TrialFES>::ScalarType,
+        typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+    Variational::BilinearForm<
+      TrialFES, TestFES,
+      Math::SparseMatrix<
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>> final
+    : public AssemblyBase<
+        Math::SparseMatrix<
+          typename FormLanguage::Dot<
+            typename FormLanguage::Traits<TrialFES>::ScalarType,
+            typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+        Variational::BilinearForm<
+          TrialFES, TestFES,
+          Math::SparseMatrix<
+            typename FormLanguage::Dot<
+              typename FormLanguage::Traits<TrialFES>::ScalarType,
+              typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>>
+  {
+    public:
+      using ScalarType =
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type;
+
+      using OperatorType = Math::SparseMatrix<ScalarType>;
+
+      using LocalBilinearFormIntegratorBaseType =
+        Variational::LocalBilinearFormIntegratorBase<ScalarType>;
+
+      using BilinearFormType = Variational::BilinearForm<TrialFES, TestFES, OperatorType>;
+
+      using Parent = AssemblyBase<OperatorType, BilinearFormType>;
+
+      using InputType = typename Parent::InputType;
+
+#ifdef RODIN_MULTITHREADED
+      Colored()
+        : Colored(Threads::getGlobalThreadPool())
+      {}
+#else
+      Colored()
+        : Colored(std::thread::hardware_concurrency())
+      {}
+#endif
+
+      Colored(std::reference_wrapper<Threads::ThreadPool> pool)
+        : m_pool(pool)
+      {}
+
+      Colored(size_t threadCount)
+        : m_pool(threadCount)
+      {
+        assert(threadCount > 0);
+      }
+
+      Colored(const Colored& other)
+        : Parent(other),
+          m_pattern(other.m_pattern),
+          m_pool(
+            std::visit(
+              [](auto&& arg) -> std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>
+              {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::reference_wrapper<Threads::ThreadPool>>)
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(arg);
+                else
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(
+                      std::in_place_type_t<Threads::ThreadPool>(), arg.getThreadCount());
+              }, other.m_pool))
+      {}
+
+      Colored(Colored&& other)
+        : Parent(std::move(other)),
+          m_pattern(std::move(other.m_pattern)),
+          m_pool(std::move(other.getThreadPool()))
+      {}
+
+      /**
+       * @brief Executes the assembly and returns the linear operator
+       * associated to the bilinear form.
+       */
+      OperatorType execute(const InputType& input) const override
+      {
+        OperatorType res;
+        execute(res, input);
+        return res;
+      }
+
+      /**
+       * @brief Executes the assembly into @p res.
+       *
+       * If @p res already has the sparsity pattern of the operator, only its
+       * values are refilled and no memory is allocated.
+       */
+      void execute(OperatorType& res, const InputType& input) const override
+      {
+        auto& threadPool =
+          std::holds_alternative<Threads::ThreadPool>(m_pool) ?
+            std::get<Threads::ThreadPool>(m_pool) :
+            std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+
+        if (input.getGlobalBFIs().size() > 0)
+        {
+          Multithreaded<OperatorType, BilinearFormType> assembly(threadPool);
+          assembly.execute(res, input);
+          return;
+        }
+
+        const auto& trialFES = input.getTrialFES();
+        const auto& testFES = input.getTestFES();
+        const auto& mesh = testFES.getMesh();
+
+        FlatSet<size_t> dims;
+        for (auto& bfi : input.getLocalBFIs())
+          dims.insert(Internal::MultithreadedIteration(mesh, bfi.getRegion()).getDimension());
+        if (!m_pattern.matches(trialFES, testFES, dims))
+          m_pattern.build(trialFES, testFES, dims);
+
+        const SparsityPattern& pattern = m_pattern;
+        pattern.getMatrix(res);
+        ScalarType* const values = res.valuePtr();
+        for (auto& bfi : input.getLocalBFIs())
+        {
+          const auto& attrs = bfi.getAttributes();
+          Internal::MultithreadedIteration seq(mesh, bfi.getRegion());
+          const size_t d = seq.getDimension();
+          for (const auto& color : mesh.getColoring(d))
+          {
+            auto loop =
+              [&](const Index start, const Index end)
+              {
+                Math::Matrix<ScalarType> mat;
+                std::unique_ptr<LocalBilinearFormIntegratorBaseType> lbfi;
+                lbfi.reset(bfi.copy());
+                for (Index j = start; j < end; ++j)
+                {
+                  const Index i = color[j];
+                  if (seq.filter(i))
+                  {
+                    if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
+                    {
+                      const auto polytope = seq.getPolytope(i);
+                      lbfi->setPolytope(polytope);
+                      const auto& rows = testFES.getDOFs(d, i);
+                      const auto& cols = trialFES.getDOFs(d, i);
+                      mat.resize(rows.size(), cols.size());
+                      lbfi->getElementMatrix(mat);
+                      for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                      {
+                        for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                          values[pattern.getPosition(rows(l), cols(m))] += mat(l, m);
+                      }
+                    }
+                  }
+                }
+              };
+            threadPool.pushLoop(0, color.size(), loop);
+            threadPool.waitForTasks();
+          }
+        }
+      }
+
+      /**
+       * @brief Gets the sparsity pattern computed by the last symbolic phase.
+       */
+      const SparsityPattern& getSparsityPattern() const
+      {
+        return m_pattern;
+      }
+
+      const Threads::ThreadPool& getThreadPool() const
+      {
+        if (std::holds_alternative<Threads::ThreadPool>(m_pool))
+          return std::get<Threads::ThreadPool>(m_pool);
+        else
+          return std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+      }
+
+      Colored* copy() const noexcept override
+      {
+        return new Colored(*this);
+      }
+
+    private:
+      mutable SparsityPattern m_pattern;
+      mutable std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>> m_pool;
+  };
+
+  /**
+   * @brief Colored multithreaded assembly of the Math::Vector associated to a
+   * LinearForm object.
+   *
+   * The polytopes are processed color by color, and the contributions of one
+   * color are written in parallel directly into the resulting vector.
+   *
+   * @see Colored<Math::SparseMatrix, BilinearForm>
+   */
+  template <class FES>
+  class Colored<
+    Math::Vector<typename FormLanguage::Traits<FES>::ScalarType>,
+    Variational::LinearForm<FES, Math::Vector<typename FormLanguage::Traits<FES>::ScalarType>>> final
+    : public AssemblyBase<
+        Math::Vector<typename FormLanguage::Traits<FES>::ScalarType>,
+        Variational::LinearForm<FES, Math::Vector<typename FormLanguage::Traits<FES>::ScalarType>>>
+  {
+    public:
+      using FESType = FES;
+
+      using ScalarType = typename FormLanguage::Traits<FESType>::ScalarType;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using LinearFormType = Variational::LinearForm<FES, VectorType>;
+
+      using Parent = AssemblyBase<VectorType, LinearFormType>;
+
+      using InputType = typename Parent::InputType;
+
+#ifdef RODIN_MULTITHREADED
+      Colored()
+        : Colored(Threads::getGlobalThreadPool())
+      {}
+#else
+      Colored()
+        : Colored(std::thread::hardware_concurrency())
+      {}
+#endif
+
+      Colored(std::reference_wrapper<Threads::ThreadPool> pool)
+        : m_pool(pool)
+      {}
+
+      Colored(size_t threadCount)
+        : m_pool(threadCount)
+      {
+        assert(threadCount > 0);
+      }
+
+      Colored(const Colored& other)
+        : Parent(other),
+          m_pool(
+            std::visit(
+              [](auto&& arg) -> std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>
+              {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::reference_wrapper<Threads::ThreadPool>>)
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(arg);
+                else
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(
+                      std::in_place_type_t<Threads::ThreadPool>(), arg.getThreadCount());
+              }, other.m_pool))
+      {}
+
+      Colored(Colored&& other)
+        : Parent(std::move(other)),
+          m_pool(std::move(other.getThreadPool()))
+      {}
+
+      /**
+       * @brief Executes the assembly and returns the vector associated to the
+       * linear form.
+       */
+      VectorType execute(const InputType& input) const override
+      {
+        auto& threadPool =
+          std::holds_alternative<Threads::ThreadPool>(m_pool) ?
+            std::get<Threads::ThreadPool>(m_pool) :
+            std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+        const auto& fes = input.getFES();
+        const auto& mesh = fes.getMesh();
+        VectorType res(fes.getSize());
+        res.setZero();
+        for (auto& lfi : input.getLFIs())
+        {
+          const auto& attrs = lfi.getAttributes();
+          Internal::MultithreadedIteration seq(mesh, lfi.getRegion());
+          const size_t d = seq.getDimension();
+          for (const auto& color : mesh.getColoring(d))
+          {
+            const auto loop =
+              [&](const Index start, const Index end)
+              {
+                std::unique_ptr<Variational::LinearFormIntegratorBase<ScalarType>> tl_lfi;
+                tl_lfi.reset(lfi.copy());
+                for (Index j = start; j < end; ++j)
+                {
+                  const Index i = color[j];
+                  if (seq.filter(i))
+                  {
+                    if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
+                    {
+                      const auto polytope = seq.getPolytope(i);
+                      tl_lfi->setPolytope(polytope);
+                      const auto& dofs = fes.getDOFs(d, i);
+                      for (size_t l = 0; l < static_cast<size_t>(dofs.size()); l++)
+                        res.coeffRef(dofs(l)) += tl_lfi->integrate(l);
+                    }
+                  }
+                }
+              };
+            threadPool.pushLoop(0, color.size(), loop);
+            threadPool.waitForTasks();
+          }
+        }
+        return res;
+      }
+
+      const Threads::ThreadPool& getThreadPool() const
+      {
+        if (std::holds_alternative<Threads::ThreadPool>(m_pool))
+          return std::get<Threads::ThreadPool>(m_pool);
+        else
+          return std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+      }
+
+      Colored* copy() const noexcept override
+      {
+        return new Colored(*this);
+      }
+
+    private:
+      mutable std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>> m_pool;
+  };
+}
+
+#endif
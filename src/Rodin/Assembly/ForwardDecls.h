@@ -12,6 +12,12 @@ namespace Rodin::Assembly
   template <class LinearAlgebraType, class Operand>
   class Multithreaded;
 
+  template <class LinearAlgebraType, class Operand>
+  class Colored;
+
+  template <class LinearAlgebraType, class Operand>
+  class Blocked;
+
   template <class Operand>
   class OpenMP;
 
@@ -0,0 +1,661 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_HMATRIX_H
+#define RODIN_ASSEMBLY_HMATRIX_H
+
+#include <limits>
+#include <optional>
+#include <algorithm>
+
+#include "Rodin/Math/Matrix.h"
+#include "Rodin/Math/HMatrix.h"
+#include "Rodin/Math/ClusterTree.h"
+
+#include "Rodin/Geometry/Incidence.h"
+
+#include "Rodin/Threads/ThreadPool.h"
+
+#include "Rodin/Variational/BilinearForm.h"
+#include "Rodin/Variational/FiniteElementSpace.h"
+#include "Rodin/Variational/BilinearFormIntegrator.h"
+
+#include "ForwardDecls.h"
+#include "AssemblyBase.h"
+#include "Multithreaded.h"
+
+namespace Rodin::Assembly::Internal
+{
+  /**
+   * @brief Computes the submatrices of the operator associated to a
+   * bilinear form, for the assembly of a Math::HMatrix.
+   *
+   * The entry @f$ (i, j) @f$ only receives contributions from the polytopes
+   * whose degrees of freedom contain @f$ i @f$ (test space) and @f$ j @f$
+   * (trial space). Hence the submatrix @f$ A|_{R \times C} @f$ is computed by
+   * visiting only the polytopes incident to the degrees of freedom in @f$ R
+   * @f$ and @f$ C @f$, via the incidences @f$ \mathrm{dof} \rightarrow
+   * \mathrm{polytope} @f$ built by the Context.
+   */
+  template <class TrialFES, class TestFES>
+  class HMatrixGenerator
+  {
+    public:
+      using ScalarType =
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type;
+
+      using MatrixType = Math::Matrix<ScalarType>;
+
+      using InputType = BilinearFormAssemblyInput<TrialFES, TestFES>;
+
+      using LocalBilinearFormIntegratorBaseType = Variational::LocalBilinearFormIntegratorBase<ScalarType>;
+
+      using GlobalBilinearFormIntegratorBaseType = Variational::GlobalBilinearFormIntegratorBase<ScalarType>;
+
+      /**
+       * @brief Data shared by the generators of all the blocks.
+       */
+      class Context
+      {
+        public:
+          Context(const InputType& input)
+            : m_input(input)
+          {
+            const auto& mesh = input.getTestFES().getMesh();
+            m_trial.resize(mesh.getDimension() + 1);
+            m_test.resize(mesh.getDimension() + 1);
+            for (const auto& bfi : input.getLocalBFIs())
+            {
+              const size_t d = MultithreadedIteration(mesh, bfi.getRegion()).getDimension();
+              build(m_trial, input.getTrialFES(), d);
+              build(m_test, input.getTestFES(), d);
+            }
+            for (const auto& bfi : input.getGlobalBFIs())
+            {
+              build(m_trial, input.getTrialFES(),
+                  MultithreadedIteration(mesh, bfi.getTrialRegion()).getDimension());
+              build(m_test, input.getTestFES(),
+                  MultithreadedIteration(mesh, bfi.getTestRegion()).getDimension());
+            }
+          }
+
+          const InputType& getInput() const
+          {
+            return m_input;
+          }
+
+          const Geometry::Incidence& getTrialIncidence(size_t d) const
+          {
+            assert(m_trial[d].has_value());
+            return *m_trial[d];
+          }
+
+          const Geometry::Incidence& getTestIncidence(size_t d) const
+          {
+            assert(m_test[d].has_value());
+            return *m_test[d];
+          }
+
+          /**
+           * @brief Builds the cluster tree of the degrees of freedom of the
+           * trial space.
+           */
+          Math::ClusterTree getTrialTree(size_t leafSize) const
+          {
+            return getTree(m_input.getTrialFES(), leafSize);
+          }
+
+          /**
+           * @brief Builds the cluster tree of the degrees of freedom of the
+           * test space.
+           */
+          Math::ClusterTree getTestTree(size_t leafSize) const
+          {
+            return getTree(m_input.getTestFES(), leafSize);
+          }
+
+        private:
+          /**
+           * @brief Builds the cluster tree of the degrees of freedom, where
+           * the support of a degree of freedom is bounded by the union of the
+           * bounding boxes of the cells which contain it.
+           */
+          template <class FES>
+          static Math::ClusterTree getTree(const FES& fes, size_t leafSize)
+          {
+            const auto& mesh = fes.getMesh();
+            const size_t D = mesh.getDimension();
+            const size_t sdim = mesh.getSpaceDimension();
+            const auto& conn = mesh.getConnectivity();
+            Math::Matrix<Real> min(sdim, fes.getSize());
+            Math::Matrix<Real> max(sdim, fes.getSize());
+            min.setConstant(std::numeric_limits<Real>::max());
+            max.setConstant(std::numeric_limits<Real>::lowest());
+            Math::SpatialVector<Real> lo, hi;
+            for (Index i = 0; i < mesh.getCellCount(); i++)
+            {
+              const auto& vertices = conn.getPolytope(D, i);
+              lo = mesh.getVertexCoordinates(vertices(0));
+              hi = lo;
+              for (Eigen::Index k = 1; k < vertices.size(); k++)
+              {
+                lo = lo.cwiseMin(mesh.getVertexCoordinates(vertices(k)));
+                hi = hi.cwiseMax(mesh.getVertexCoordinates(vertices(k)));
+              }
+              const auto& dofs = fes.getDOFs(D, i);
+              for (Eigen::Index k = 0; k < dofs.size(); k++)
+              {
+                min.col(dofs(k)) = min.col(dofs(k)).cwiseMin(lo);
+                max.col(dofs(k)) = max.col(dofs(k)).cwiseMax(hi);
+              }
+            }
+            for (Eigen::Index j = 0; j < min.cols(); j++)
+            {
+              if (min(0, j) > max(0, j))
+              {
+                min.col(j).setZero();
+                max.col(j).setZero();
+              }
+            }
+            return Math::ClusterTree(min, max, leafSize);
+          }
+
+          template <class FES>
+          static void build(std::vector<std::optional<Geometry::Incidence>>& res, const FES& fes, size_t d)
+          {
+            if (res[d].has_value())
+              return;
+            const size_t count = fes.getMesh().getConnectivity().getCount(d);
+            std::vector<Index> offsets(fes.getSize() + 1, 0);
+            for (Index i = 0; i < count; i++)
+            {
+              const auto& dofs = fes.getDOFs(d, i);
+              for (Eigen::Index k = 0; k < dofs.size(); k++)
+                offsets[dofs(k) + 1]++;
+            }
+            for (size_t k = 0; k < fes.getSize(); k++)
+              offsets[k + 1] += offsets[k];
+            std::vector<Index> indices(offsets.back());
+            std::vector<Index> pos(offsets.begin(), offsets.end() - 1);
+            for (Index i = 0; i < count; i++)
+            {
+              const auto& dofs = fes.getDOFs(d, i);
+              for (Eigen::Index k = 0; k < dofs.size(); k++)
+                indices[pos[dofs(k)]++] = i;
+            }
+            res[d].emplace(std::move(offsets), std::move(indices));
+          }
+
+          const InputType& m_input;
+          std::vector<std::optional<Geometry::Incidence>> m_trial;
+          std::vector<std::optional<Geometry::Incidence>> m_test;
+      };
+
+      /**
+       * @brief Constructs a generator with its own copies of the
+       * integrators.
+       */
+      HMatrixGenerator(const Context& context)
+        : m_context(context)
+      {
+        for (const auto& bfi : context.getInput().getLocalBFIs())
+          m_lbfis.emplace_back(bfi.copy());
+        for (const auto& bfi : context.getInput().getGlobalBFIs())
+          m_gbfis.emplace_back(bfi.copy());
+      }
+
+      HMatrixGenerator(const HMatrixGenerator&) = delete;
+
+      /**
+       * @brief Computes the submatrix @f$ A|_{R \times C} @f$.
+       */
+      void operator()(const Index* rows, size_t m, const Index* cols, size_t n, MatrixType& res)
+      {
+        const auto& input = m_context.getInput();
+        const auto& mesh = input.getTestFES().getMesh();
+        res.resize(m, n);
+        res.setZero();
+        sort(m_rows, rows, m);
+        sort(m_cols, cols, n);
+
+        for (auto& lbfi : m_lbfis)
+        {
+          const auto& attrs = lbfi->getAttributes();
+          const MultithreadedIteration seq(mesh, lbfi->getRegion());
+          const size_t d = seq.getDimension();
+          gather(m_testPolytopes, m_context.getTestIncidence(d), rows, m);
+          for (const Index i : m_testPolytopes)
+          {
+            if (!seq.filter(i) || (attrs.size() > 0 && !attrs.count(mesh.getAttribute(d, i))))
+              continue;
+            const auto& testDOFs = input.getTestFES().getDOFs(d, i);
+            const auto& trialDOFs = input.getTrialFES().getDOFs(d, i);
+            locate(m_testPositions, m_rows, testDOFs);
+            locate(m_trialPositions, m_cols, trialDOFs);
+            if (!any(m_trialPositions))
+              continue;
+            const Geometry::Polytope polytope(d, i, mesh);
+            lbfi->setPolytope(polytope);
+            m_mat.resize(testDOFs.size(), trialDOFs.size());
+            lbfi->getElementMatrix(m_mat);
+            scatter(res);
+          }
+        }
+
+        for (auto& gbfi : m_gbfis)
+        {
+          const auto& trialAttrs = gbfi->getTrialAttributes();
+          const auto& testAttrs = gbfi->getTestAttributes();
+          const MultithreadedIteration trialseq(mesh, gbfi->getTrialRegion());
+          const MultithreadedIteration testseq(mesh, gbfi->getTestRegion());
+          const size_t dtr = trialseq.getDimension();
+          const size_t dte = testseq.getDimension();
+          gather(m_testPolytopes, m_context.getTestIncidence(dte), rows, m);
+          gather(m_trialPolytopes, m_context.getTrialIncidence(dtr), cols, n);
+          for (const Index te : m_testPolytopes)
+          {
+            if (!testseq.filter(te) || (testAttrs.size() > 0 && !testAttrs.count(mesh.getAttribute(dte, te))))
+              continue;
+            const auto& testDOFs = input.getTestFES().getDOFs(dte, te);
+            locate(m_testPositions, m_rows, testDOFs);
+            const Geometry::Polytope tep(dte, te, mesh);
+            for (const Index tr : m_trialPolytopes)
+            {
+              if (!trialseq.filter(tr) || (trialAttrs.size() > 0 && !trialAttrs.count(mesh.getAttribute(dtr, tr))))
+                continue;
+              const auto& trialDOFs = input.getTrialFES().getDOFs(dtr, tr);
+              locate(m_trialPositions, m_cols, trialDOFs);
+              const Geometry::Polytope trp(dtr, tr, mesh);
+              gbfi->setPolytope(trp, tep);
+              m_mat.resize(testDOFs.size(), trialDOFs.size());
+              gbfi->getElementMatrix(m_mat);
+              scatter(res);
+            }
+          }
+        }
+      }
+
+    private:
+      static constexpr size_t s_npos = std::numeric_limits<size_t>::max();
+
+      /**
+       * @brief Sorts the pairs (index, position) of the given indices.
+       */
+      static void sort(std::vector<std::pair<Index, size_t>>& res, const Index* indices, size_t n)
+      {
+        res.resize(n);
+        for (size_t k = 0; k < n; k++)
+          res[k] = { indices[k], k };
+        std::sort(res.begin(), res.end());
+      }
+
+      /**
+       * @brief Collects the sorted polytopes incident to the given degrees of
+       * freedom.
+       */
+      static void gather(
+          std::vector<Index>& res, const Geometry::Incidence& incidence, const Index* dofs, size_t n)
+      {
+        res.clear();
+        for (size_t k = 0; k < n; k++)
+        {
+          const auto range = incidence[dofs[k]];
+          res.insert(res.end(), range.begin(), range.end());
+        }
+        std::sort(res.begin(), res.end());
+        res.erase(std::unique(res.begin(), res.end()), res.end());
+      }
+
+      /**
+       * @brief Computes the positions of the local degrees of freedom in the
+       * submatrix, or s_npos if they are not part of it.
+       */
+      static void locate(
+          std::vector<size_t>& res, const std::vector<std::pair<Index, size_t>>& sorted, const IndexArray& dofs)
+      {
+        res.resize(dofs.size());
+        for (Eigen::Index k = 0; k < dofs.size(); k++)
+        {
+          const auto it = std::lower_bound(sorted.begin(), sorted.end(),
+              std::pair<Index, size_t>{ dofs(k), 0 });
+          res[k] = (it != sorted.end() && it->first == dofs(k)) ? it->second : s_npos;
+        }
+      }
+
+      static bool any(const std::vector<size_t>& positions)
+      {
+        return std::any_of(positions.begin(), positions.end(), [](size_t p) { return p != s_npos; });
+      }
+
+      void scatter(MatrixType& res) const
+      {
+        for (size_t c = 0; c < m_trialPositions.size(); c++)
+        {
+          if (m_trialPositions[c] == s_npos)
+            continue;
+          for (size_t r = 0; r < m_testPositions.size(); r++)
+          {
+            if (m_testPositions[r] == s_npos)
+              continue;
+            res(m_testPositions[r], m_trialPositions[c]) += m_mat(r, c);
+          }
+        }
+      }
+
+      const Context& m_context;
+      std::vector<std::unique_ptr<LocalBilinearFormIntegratorBaseType>> m_lbfis;
+      std::vector<std::unique_ptr<GlobalBilinearFormIntegratorBaseType>> m_gbfis;
+      std::vector<std::pair<Index, size_t>> m_rows;
+      std::vector<std::pair<Index, size_t>> m_cols;
+      std::vector<Index> m_testPolytopes;
+      std::vector<Index> m_trialPolytopes;
+      std::vector<size_t> m_testPositions;
+      std::vector<size_t> m_trialPositions;
+      MatrixType m_mat;
+  };
+}
+
+namespace Rodin::Assembly
+{
+  /**
+   * @brief %Sequential assembly of the Math::HMatrix associated to a
+   * BilinearForm object.
+   *
+   * The degrees of freedom are clustered according to the bounding boxes of
+   * their supports, and the admissible blocks are compressed with the
+   * adaptive cross approximation. The local integrators only contribute to
+   * the dense blocks, since the supports of the degrees of freedom coupled by
+   * them intersect.
+   *
+   * # Utilization
+   *
+   * @code{cpp}
+   * BilinearForm<decltype(fes), decltype(fes), Math::HMatrix<Real>> a(u, v);
+   * a = Integral(Potential(K, u), v);
+   * auto op = a.getOperator().getLinearOperator();
+   * Eigen::GMRES<Math::LinearOperator<Real>, Eigen::IdentityPreconditioner> gmres(op);
+   * @endcode
+   *
+   * @note Include Rodin/Assembly/HMatrix.h before constructing a BilinearForm
+   * whose operator is a Math::HMatrix.
+   */
+  template <class TrialFES, class TestFES>
+  class Sequential<
+    Math::HMatrix<
+      typename FormLanguage::Dot<
+        typename FormLanguage::Traits<TrialFES>::ScalarType,
+        typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+    Variational::BilinearForm<
+      TrialFES, TestFES,
+      Math::HMatrix<
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>> final
+    : public AssemblyBase<
+        Math::HMatrix<
+          typename FormLanguage::Dot<
+            typename FormLanguage::Traits<TrialFES>::ScalarType,
+            typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+        Variational::BilinearForm<TrialFES, TestFES,
+          Math::HMatrix<
+            typename FormLanguage::Dot<
+              typename FormLanguage::Traits<TrialFES>::ScalarType,
+              typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>>
+  {
+    public:
+      using ScalarType =
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type;
+
+      using OperatorType = Math::HMatrix<ScalarType>;
+
+      using BilinearFormType = Variational::BilinearForm<TrialFES, TestFES, OperatorType>;
+
+      using Parent = AssemblyBase<OperatorType, BilinearFormType>;
+
+      using InputType = typename Parent::InputType;
+
+      using GeneratorType = Internal::HMatrixGenerator<TrialFES, TestFES>;
+
+      Sequential()
+        : m_eta(2), m_tolerance(1e-6), m_leafSize(32)
+      {}
+
+      Sequential(const Sequential& other)
+        : Parent(other),
+          m_eta(other.m_eta), m_tolerance(other.m_tolerance), m_leafSize(other.m_leafSize)
+      {}
+
+      Sequential(Sequential&& other)
+        : Parent(std::move(other)),
+          m_eta(other.m_eta), m_tolerance(other.m_tolerance), m_leafSize(other.m_leafSize)
+      {}
+
+      /**
+       * @brief Sets the admissibility parameter @f$ \eta @f$.
+       */
+      Sequential& setAdmissibility(Real eta)
+      {
+        m_eta = eta;
+        return *this;
+      }
+
+      /**
+       * @brief Sets the relative tolerance of the cross approximation.
+       */
+      Sequential& setTolerance(Real tolerance)
+      {
+        m_tolerance = tolerance;
+        return *this;
+      }
+
+      /**
+       * @brief Sets the maximal number of degrees of freedom of the leaves
+       * of the cluster trees.
+       */
+      Sequential& setLeafSize(size_t leafSize)
+      {
+        m_leafSize = leafSize;
+        return *this;
+      }
+
+      /**
+       * @brief Executes the assembly and returns the hierarchical matrix
+       * associated to the bilinear form.
+       */
+      OperatorType execute(const InputType& input) const override
+      {
+        const typename GeneratorType::Context context(input);
+        OperatorType res(context.getTestTree(m_leafSize), context.getTrialTree(m_leafSize), m_eta);
+        GeneratorType generator(context);
+        res.assemble(
+            [&](const Index* rows, size_t m, const Index* cols, size_t n, Math::Matrix<ScalarType>& out)
+            {
+              generator(rows, m, cols, n, out);
+            }, m_tolerance);
+        return res;
+      }
+
+      Sequential* copy() const noexcept override
+      {
+        return new Sequential(*this);
+      }
+
+    private:
+      Real m_eta;
+      Real m_tolerance;
+      size_t m_leafSize;
+  };
+
+  /**
+   * @brief %Multithreaded assembly of the Math::HMatrix associated to a
+   * BilinearForm object.
+   *
+   * The blocks are assembled in parallel, each thread using its own copies of
+   * the integrators.
+   *
+   * @see Sequential
+   */
+  template <class TrialFES, class TestFES>
+  class Multithreaded<
+    Math::HMatrix<
+      typename FormLanguage::Dot<
+        typename FormLanguage::Traits<TrialFES>::ScalarType,
+        typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+    Variational::BilinearForm<
+      TrialFES, TestFES,
+      Math::HMatrix<
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>> final
+    : public AssemblyBase<
+        Math::HMatrix<
+          typename FormLanguage::Dot<
+            typename FormLanguage::Traits<TrialFES>::ScalarType,
+            typename FormLanguage::Traits<TestFES>::ScalarType>::Type>,
+        Variational::BilinearForm<TrialFES, TestFES,
+          Math::HMatrix<
+            typename FormLanguage::Dot<
+              typename FormLanguage::Traits<TrialFES>::ScalarType,
+              typename FormLanguage::Traits<TestFES>::ScalarType>::Type>>>
+  {
+    public:
+      using ScalarType =
+        typename FormLanguage::Dot<
+          typename FormLanguage::Traits<TrialFES>::ScalarType,
+          typename FormLanguage::Traits<TestFES>::ScalarType>::Type;
+
+      using OperatorType = Math::HMatrix<ScalarType>;
+
+      using BilinearFormType = Variational::BilinearForm<TrialFES, TestFES, OperatorType>;
+
+      using Parent = AssemblyBase<OperatorType, BilinearFormType>;
+
+      using InputType = typename Parent::InputType;
+
+      using GeneratorType = Internal::HMatrixGenerator<TrialFES, TestFES>;
+
+#ifdef RODIN_MULTITHREADED
+      Multithreaded()
+        : Multithreaded(Threads::getGlobalThreadPool())
+      {}
+#else
+      Multithreaded()
+        : Multithreaded(std::thread::hardware_concurrency())
+      {}
+#endif
+
+      Multithreaded(std::reference_wrapper<Threads::ThreadPool> pool)
+        : m_eta(2), m_tolerance(1e-6), m_leafSize(32), m_pool(pool)
+      {}
+
+      Multithreaded(size_t threadCount)
+        : m_eta(2), m_tolerance(1e-6), m_leafSize(32), m_pool(threadCount)
+      {
+        assert(threadCount > 0);
+      }
+
+      Multithreaded(const Multithreaded& other)
+        : Parent(other),
+          m_eta(other.m_eta), m_tolerance(other.m_tolerance), m_leafSize(other.m_leafSize),
+          m_pool(
+            std::visit(
+              [](auto&& arg) -> std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>
+              {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::reference_wrapper<Threads::ThreadPool>>)
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(arg);
+                else
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(
+                      std::in_place_type_t<Threads::ThreadPool>(), arg.getThreadCount());
+              }, other.m_pool))
+      {}
+
+      Multithreaded(Multithreaded&& other)
+        : Parent(std::move(other)),
+          m_eta(other.m_eta), m_tolerance(other.m_tolerance), m_leafSize(other.m_leafSize),
+          m_pool(std::move(other.m_pool))
+      {}
+
+      /**
+       * @brief Sets the admissibility parameter @f$ \eta @f$.
+       */
+      Multithreaded& setAdmissibility(Real eta)
+      {
+        m_eta = eta;
+        return *this;
+      }
+
+      /**
+       * @brief Sets the relative tolerance of the cross approximation.
+       */
+      Multithreaded& setTolerance(Real tolerance)
+      {
+        m_tolerance = tolerance;
+        return *this;
+      }
+
+      /**
+       * @brief Sets the maximal number of degrees of freedom of the leaves
+       * of the cluster trees.
+       */
+      Multithreaded& setLeafSize(size_t leafSize)
+      {
+        m_leafSize = leafSize;
+        return *this;
+      }
+
+      /**
+       * @brief Executes the assembly and returns the hierarchical matrix
+       * associated to the bilinear form.
+       */
+      OperatorType execute(const InputType& input) const override
+      {
+        const typename GeneratorType::Context context(input);
+        OperatorType res(context.getTestTree(m_leafSize), context.getTrialTree(m_leafSize), m_eta);
+        auto loop =
+          [&](const Index start, const Index end)
+          {
+            GeneratorType generator(context);
+            const typename OperatorType::GeneratorType f =
+              [&](const Index* rows, size_t m, const Index* cols, size_t n, Math::Matrix<ScalarType>& out)
+              {
+                generator(rows, m, cols, n, out);
+              };
+            for (Index k = start; k < end; ++k)
+              res.assemble(k, f, m_tolerance);
+          };
+        auto& threadPool = getThreadPool();
+        threadPool.pushLoop(0, res.getBlocks().size(), loop);
+        threadPool.waitForTasks();
+        return res;
+      }
+
+      Threads::ThreadPool& getThreadPool() const
+      {
+        if (std::holds_alternative<Threads::ThreadPool>(m_pool))
+          return std::get<Threads::ThreadPool>(m_pool);
+        else
+          return std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+      }
+
+      Multithreaded* copy() const noexcept override
+      {
+        return new Multithreaded(*this);
+      }
+
+    private:
+      Real m_eta;
+      Real m_tolerance;
+      size_t m_leafSize;
+      mutable std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>> m_pool;
+  };
+}
+
+#endif
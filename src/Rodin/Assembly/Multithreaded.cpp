@@ -16,26 +16,9 @@ namespace Rodin::Assembly
       : m_mesh(mesh), m_region(region)
     {}
 
-    Geometry::PolytopeIterator MultithreadedIteration::getIterator(Index i) const
+    Geometry::Polytope MultithreadedIteration::getPolytope(Index i) const
     {
-      Geometry::PolytopeIterator it;
-      switch (m_region)
-      {
-        case Variational::Integrator::Region::Cells:
-        {
-          it = m_mesh.get().getCell(i);
-          return it;
-        }
-        case Variational::Integrator::Region::Faces:
-        case Variational::Integrator::Region::Boundary:
-        case Variational::Integrator::Region::Interface:
-        {
-          it = m_mesh.get().getFace(i);
-          return it;
-        }
-      }
-      assert(false);
-      return it;
+      return Geometry::Polytope(getDimension(), i, m_mesh.get());
     }
 
     size_t MultithreadedIteration::getDimension() const
@@ -13,6 +13,7 @@
 #include "Rodin/Math/SparseMatrix.h"
 
 #include "Rodin/Threads/Mutex.h"
+#include "Rodin/Threads/Atomic.h"
 #include "Rodin/Threads/ThreadPool.h"
 
 #include "Rodin/Variational/LinearForm.h"
@@ -27,6 +28,7 @@
 #include "ForwardDecls.h"
 #include "AssemblyBase.h"
 #include "Sequential.h"
+#include "SparsityPattern.h"
 
 namespace Rodin::Assembly
 {
@@ -37,7 +39,10 @@ namespace Rodin::Assembly
       public:
         MultithreadedIteration(const Geometry::MeshBase& mesh, Variational::Integrator::Region);
 
-        Geometry::PolytopeIterator getIterator(Index i) const;
+        /**
+         * @brief Gets the i-th polytope of the region, by value.
+         */
+        Geometry::Polytope getPolytope(Index i) const;
 
         size_t getDimension() const;
 
@@ -156,6 +161,7 @@ namespace Rodin::Assembly
             [&](const Index start, const Index end)
             {
               OperatorType triplets;
+              Math::Matrix<ScalarType> mat;
               std::unique_ptr<LocalBilinearFormIntegratorBaseType>  lbfi;
               lbfi.reset(bfi.copy());
               triplets.reserve(capacity / threadCount);
@@ -165,15 +171,17 @@ namespace Rodin::Assembly
                 {
                   if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
                   {
-                    const auto it = seq.getIterator(i);
-                    lbfi->setPolytope(*it);
+                    const auto polytope = seq.getPolytope(i);
+                    lbfi->setPolytope(polytope);
                     const auto& rows = input.getTestFES().getDOFs(d, i);
                     const auto& cols = input.getTrialFES().getDOFs(d, i);
-                    for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                    mat.resize(rows.size(), cols.size());
+                    lbfi->getElementMatrix(mat);
+                    for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
                     {
-                      for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                      for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
                       {
-                        const ScalarType s = lbfi->integrate(m, l);
+                        const ScalarType s = mat(l, m);
                         if (s != ScalarType(0))
                           triplets.emplace_back(rows(l), cols(m), s);
                       }
@@ -212,6 +220,7 @@ namespace Rodin::Assembly
             [&](const Index start, const Index end)
             {
               OperatorType triplets;
+              Math::Matrix<ScalarType> mat;
               std::unique_ptr<GlobalBilinearFormIntegratorBaseType> gbfi;
               gbfi.reset(bfi.copy());
               triplets.reserve(capacity / threadCount);
@@ -221,20 +230,22 @@ namespace Rodin::Assembly
                 {
                   if (testAttrs.size() == 0 || testAttrs.count(mesh.getAttribute(d, i)))
                   {
-                    const auto teIt = testseq.getIterator(i);
+                    const auto te = testseq.getPolytope(i);
                     Internal::SequentialIteration trialseq{ mesh, gbfi->getTrialRegion() };
                     for (auto trIt = trialseq.getIterator(); trIt; ++trIt)
                     {
                       if (trialAttrs.size() == 0 || trialAttrs.count(trIt->getAttribute()))
                       {
-                        gbfi->setPolytope(*trIt, *teIt);
-                        const auto& rows = input.getTestFES().getDOFs(d, teIt->getIndex());
+                        gbfi->setPolytope(*trIt, te);
+                        const auto& rows = input.getTestFES().getDOFs(d, te.getIndex());
                         const auto& cols = input.getTrialFES().getDOFs(d, trIt->getIndex());
-                        for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                        mat.resize(rows.size(), cols.size());
+                        gbfi->getElementMatrix(mat);
+                        for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
                         {
-                          for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                          for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
                           {
-                            const ScalarType s = gbfi->integrate(m, l);
+                            const ScalarType s = mat(l, m);
                             if (s != ScalarType(0))
                               triplets.emplace_back(rows(l), cols(m), s);
                           }
@@ -289,6 +300,17 @@ namespace Rodin::Assembly
   /**
    * @brief Multithreaded assembly of the Math::SparseMatrix associated to a
    * BilinearFormBase object.
+   *
+   * The assembly proceeds in two phases. The symbolic phase computes the
+   * SparsityPattern of the operator from the degrees of freedom of the trial
+   * and test spaces. It is only performed on the first call, or when the
+   * spaces, the mesh or the integration regions change. The numeric phase
+   * then accumulates the element matrices directly into the value array of
+   * the compressed matrix with atomic additions, so that no triplets need to
+   * be merged or sorted.
+   *
+   * If the bilinear form contains global integrators, the operator is dense
+   * and the assembly falls back to building it from triplets.
    */
   template <class TrialFES, class TestFES>
   class Multithreaded<
@@ -322,6 +344,9 @@ namespace Rodin::Assembly
 
       using OperatorType = Math::SparseMatrix<ScalarType>;
 
+      using LocalBilinearFormIntegratorBaseType =
+        Variational::LocalBilinearFormIntegratorBase<ScalarType>;
+
       using BilinearFormType = Variational::BilinearForm<TrialFES, TestFES, OperatorType>;
 
       using Parent = AssemblyBase<OperatorType, BilinearFormType>;
@@ -339,23 +364,35 @@ namespace Rodin::Assembly
 #endif
 
       Multithreaded(std::reference_wrapper<Threads::ThreadPool> pool)
-        : m_assembly(pool)
+        : m_pool(pool)
       {}
 
       Multithreaded(size_t threadCount)
-        : m_assembly(threadCount)
+        : m_pool(threadCount)
       {
         assert(threadCount > 0);
       }
 
       Multithreaded(const Multithreaded& other)
         : Parent(other),
-          m_assembly(other.m_assembly)
+          m_pattern(other.m_pattern),
+          m_pool(
+            std::visit(
+              [](auto&& arg) -> std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>
+              {
+                using T = std::decay_t<decltype(arg)>;
+                if constexpr (std::is_same_v<T, std::reference_wrapper<Threads::ThreadPool>>)
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(arg);
+                else
+                  return std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>>(
+                      std::in_place_type_t<Threads::ThreadPool>(), arg.getThreadCount());
+              }, other.m_pool))
       {}
 
       Multithreaded(Multithreaded&& other)
         : Parent(std::move(other)),
-          m_assembly(std::move(other.m_assembly))
+          m_pattern(std::move(other.m_pattern)),
+          m_pool(std::move(other.getThreadPool()))
       {}
 
       /**
@@ -364,23 +401,118 @@ namespace Rodin::Assembly
        */
       OperatorType execute(const InputType& input) const override
       {
-        const auto triplets = m_assembly.execute({
-            input.getTrialFES(), input.getTestFES(),
-            input.getLocalBFIs(), input.getGlobalBFIs() });
-        OperatorType res(input.getTestFES().getSize(), input.getTrialFES().getSize());
-        res.setFromTriplets(triplets.begin(), triplets.end());
+        OperatorType res;
+        execute(res, input);
         return res;
       }
 
+      /**
+       * @brief Executes the assembly into @p res.
+       *
+       * If @p res already has the sparsity pattern of the operator, only its
+       * values are refilled and no memory is allocated.
+       */
+      void execute(OperatorType& res, const InputType& input) const override
+      {
+        auto& threadPool =
+          std::holds_alternative<Threads::ThreadPool>(m_pool) ?
+            std::get<Threads::ThreadPool>(m_pool) :
+            std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+
+        if (input.getGlobalBFIs().size() > 0)
+        {
+          Multithreaded<
+            std::vector<Eigen::Triplet<ScalarType>>,
+            Variational::BilinearForm<TrialFES, TestFES, std::vector<Eigen::Triplet<ScalarType>>>>
+              assembly(threadPool);
+          const auto triplets = assembly.execute({
+              input.getTrialFES(), input.getTestFES(),
+              input.getLocalBFIs(), input.getGlobalBFIs() });
+          res.resize(input.getTestFES().getSize(), input.getTrialFES().getSize());
+          res.setFromTriplets(triplets.begin(), triplets.end());
+          return;
+        }
+
+        const auto& trialFES = input.getTrialFES();
+        const auto& testFES = input.getTestFES();
+        const auto& mesh = testFES.getMesh();
+
+        // Symbolic phase
+        FlatSet<size_t> dims;
+        for (auto& bfi : input.getLocalBFIs())
+          dims.insert(Internal::MultithreadedIteration(mesh, bfi.getRegion()).getDimension());
+        if (!m_pattern.matches(trialFES, testFES, dims))
+          m_pattern.build(trialFES, testFES, dims);
+
+        // Numeric phase
+        const SparsityPattern& pattern = m_pattern;
+        pattern.getMatrix(res);
+        ScalarType* const values = res.valuePtr();
+        for (auto& bfi : input.getLocalBFIs())
+        {
+          const auto& attrs = bfi.getAttributes();
+          Internal::MultithreadedIteration seq(mesh, bfi.getRegion());
+          const size_t d = seq.getDimension();
+          auto loop =
+            [&](const Index start, const Index end)
+            {
+              Math::Matrix<ScalarType> mat;
+              std::unique_ptr<LocalBilinearFormIntegratorBaseType> lbfi;
+              lbfi.reset(bfi.copy());
+              for (Index i = start; i < end; ++i)
+              {
+                if (seq.filter(i))
+                {
+                  if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
+                  {
+                    const auto polytope = seq.getPolytope(i);
+                    lbfi->setPolytope(polytope);
+                    const auto& rows = testFES.getDOFs(d, i);
+                    const auto& cols = trialFES.getDOFs(d, i);
+                    mat.resize(rows.size(), cols.size());
+                    lbfi->getElementMatrix(mat);
+                    for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                    {
+                      for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                      {
+                        const ScalarType s = mat(l, m);
+                        if (s != ScalarType(0))
+                          Threads::atomicAdd(values[pattern.getPosition(rows(l), cols(m))], s);
+                      }
+                    }
+                  }
+                }
+              }
+            };
+          threadPool.pushLoop(0, seq.getCount(), loop);
+          threadPool.waitForTasks();
+        }
+      }
+
+      /**
+       * @brief Gets the sparsity pattern computed by the last symbolic phase.
+       */
+      const SparsityPattern& getSparsityPattern() const
+      {
+        return m_pattern;
+      }
+
+      const Threads::ThreadPool& getThreadPool() const
+      {
+        if (std::holds_alternative<Threads::ThreadPool>(m_pool))
+          return std::get<Threads::ThreadPool>(m_pool);
+        else
+          return std::get<std::reference_wrapper<Threads::ThreadPool>>(m_pool).get();
+      }
+
       Multithreaded* copy() const noexcept override
       {
         return new Multithreaded(*this);
       }
 
     private:
-      Multithreaded<
-        std::vector<Eigen::Triplet<ScalarType>>,
-        Variational::BilinearForm<TrialFES, TestFES, std::vector<Eigen::Triplet<ScalarType>>>> m_assembly;
+      mutable SparsityPattern m_pattern;
+      mutable std::variant<Threads::ThreadPool, std::reference_wrapper<Threads::ThreadPool>> m_pool;
   };
 
   template <class TrialFES, class TestFES>
@@ -483,6 +615,7 @@ namespace Rodin::Assembly
             [&](const Index start, const Index end)
             {
               OperatorType pres;
+              Math::Matrix<ScalarType> mat;
               std::unique_ptr<LocalBilinearFormIntegratorBaseType> lbfi;
               lbfi.reset(bfi.copy());
               pres.resize(input.getTestFES().getSize(), input.getTrialFES().getSize());
@@ -493,13 +626,15 @@ namespace Rodin::Assembly
                 {
                   if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
                   {
-                    const auto it = seq.getIterator(i);
-                    lbfi->setPolytope(*it);
+                    const auto polytope = seq.getPolytope(i);
+                    lbfi->setPolytope(polytope);
                     const auto& rows = input.getTestFES().getDOFs(d, i);
                     const auto& cols = input.getTrialFES().getDOFs(d, i);
-                    for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
-                      for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
-                        pres(rows(l), cols(m)) += lbfi->integrate(m, l);
+                    mat.resize(rows.size(), cols.size());
+                    lbfi->getElementMatrix(mat);
+                    for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                      for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                        pres(rows(l), cols(m)) += mat(l, m);
                   }
                 }
               }
@@ -531,6 +666,7 @@ namespace Rodin::Assembly
             [&](const Index start, const Index end)
             {
               OperatorType tl_res;
+              Math::Matrix<ScalarType> mat;
               std::unique_ptr<GlobalBilinearFormIntegratorBaseType> gbfi;
               gbfi.reset(bfi.copy());
               tl_res.resize(input.getTestFES().getSize(), input.getTrialFES().getSize());
@@ -541,18 +677,20 @@ namespace Rodin::Assembly
                 {
                   if (testAttrs.size() == 0 || testAttrs.count(mesh.getAttribute(d, i)))
                   {
-                    const auto teIt = testseq.getIterator(i);
+                    const auto te = testseq.getPolytope(i);
                     Internal::SequentialIteration trialseq{ mesh, gbfi->getTrialRegion() };
                     for (auto trIt = trialseq.getIterator(); trIt; ++trIt)
                     {
                       if (trialAttrs.size() == 0 || trialAttrs.count(trIt->getAttribute()))
                       {
-                        gbfi->setPolytope(*trIt, *teIt);
-                        const auto& rows = input.getTestFES().getDOFs(d, teIt->getIndex());
+                        gbfi->setPolytope(*trIt, te);
+                        const auto& rows = input.getTestFES().getDOFs(d, te.getIndex());
                         const auto& cols = input.getTrialFES().getDOFs(d, trIt->getIndex());
-                        for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
-                          for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
-                            tl_res(rows(l), cols(m)) += gbfi->integrate(m, l);
+                        mat.resize(rows.size(), cols.size());
+                        gbfi->getElementMatrix(mat);
+                        for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                          for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                            tl_res(rows(l), cols(m)) += mat(l, m);
                       }
                     }
                   }
@@ -690,8 +828,8 @@ namespace Rodin::Assembly
                 {
                   if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
                   {
-                    const auto it = seq.getIterator(i);
-                    tl_lfi->setPolytope(*it);
+                    const auto polytope = seq.getPolytope(i);
+                    tl_lfi->setPolytope(polytope);
                     const auto& dofs = input.getFES().getDOFs(d, i);
                     for (size_t l = 0; l < static_cast<size_t>(dofs.size()); l++)
                       tl_res(dofs(l)) += tl_lfi->integrate(l);
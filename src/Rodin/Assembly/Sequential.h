@@ -168,6 +168,7 @@ namespace Rodin::Assembly
       {
         OperatorType res(input.getTestFES().getSize(), input.getTrialFES().getSize());
         res.setZero();
+        Math::Matrix<ScalarType> mat;
         const auto& mesh = input.getTrialFES().getMesh();
         for (auto& bfi : input.getLocalBFIs())
         {
@@ -180,9 +181,11 @@ namespace Rodin::Assembly
               bfi.setPolytope(*it);
               const auto& rows = input.getTestFES().getDOFs(it.getDimension(), it->getIndex());
               const auto& cols = input.getTrialFES().getDOFs(it.getDimension(), it->getIndex());
-              for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
-                for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
-                  res(rows(l), cols(m)) += bfi.integrate(m, l);
+              mat.resize(rows.size(), cols.size());
+              bfi.getElementMatrix(mat);
+              for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                  res(rows(l), cols(m)) += mat(l, m);
             }
           }
         }
@@ -203,9 +206,11 @@ namespace Rodin::Assembly
                   bfi.setPolytope(*trIt, *teIt);
                   const auto& rows = input.getTestFES().getDOFs(teIt.getDimension(), teIt->getIndex());
                   const auto& cols = input.getTrialFES().getDOFs(trIt.getDimension(), trIt->getIndex());
-                  for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
-                    for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
-                      res(rows(l), cols(m)) += bfi.integrate(m, l);
+                  mat.resize(rows.size(), cols.size());
+                  bfi.getElementMatrix(mat);
+                  for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                    for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                      res(rows(l), cols(m)) += mat(l, m);
                 }
               }
             }
@@ -353,6 +358,7 @@ namespace Rodin::Assembly
       OperatorType execute(const InputType& input) const override
       {
         OperatorType res;
+        Math::Matrix<ScalarType> mat;
         const auto& mesh = input.getTrialFES().getMesh();
         res.reserve(input.getTestFES().getSize() * std::log(input.getTrialFES().getSize()));
         for (auto& bfi : input.getLocalBFIs())
@@ -366,11 +372,13 @@ namespace Rodin::Assembly
               bfi.setPolytope(*it);
               const auto& rows = input.getTestFES().getDOFs(it.getDimension(), it->getIndex());
               const auto& cols = input.getTrialFES().getDOFs(it.getDimension(), it->getIndex());
-              for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+              mat.resize(rows.size(), cols.size());
+              bfi.getElementMatrix(mat);
+              for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
               {
-                for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
                 {
-                  const ScalarType s = bfi.integrate(m, l);
+                  const ScalarType s = mat(l, m);
                   if (s != ScalarType(0))
                     res.emplace_back(rows(l), cols(m), s);
                 }
@@ -395,11 +403,13 @@ namespace Rodin::Assembly
                   bfi.setPolytope(*trIt, *teIt);
                   const auto& rows = input.getTestFES().getDOFs(teIt.getDimension(), teIt->getIndex());
                   const auto& cols = input.getTrialFES().getDOFs(trIt.getDimension(), trIt->getIndex());
-                  for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                  mat.resize(rows.size(), cols.size());
+                  bfi.getElementMatrix(mat);
+                  for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
                   {
-                    for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                    for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
                     {
-                      const ScalarType s = bfi.integrate(m, l);
+                      const ScalarType s = mat(l, m);
                       if (s != ScalarType(0))
                         res.emplace_back(rows(l), cols(m), s);
                     }
@@ -0,0 +1,42 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+
+#include "SparsityPattern.h"
+
+namespace Rodin::Assembly
+{
+  Index SparsityPattern::getPosition(Index i, Index j) const
+  {
+    assert(j < m_cols);
+    const StorageIndex* const begin = m_inner.data() + m_outer[j];
+    const StorageIndex* const end = m_inner.data() + m_outer[j + 1];
+    const StorageIndex* const it = std::lower_bound(begin, end, static_cast<StorageIndex>(i));
+    assert(it != end && static_cast<Index>(*it) == i);
+    return it - m_inner.data();
+  }
+
+  void SparsityPattern::compress()
+  {
+    StorageIndex nnz = 0;
+    StorageIndex begin = m_outer[0];
+    for (size_t j = 0; j < m_cols; j++)
+    {
+      const StorageIndex end = m_outer[j + 1];
+      std::sort(m_inner.begin() + begin, m_inner.begin() + end);
+      const auto last = std::unique(m_inner.begin() + begin, m_inner.begin() + end);
+      const auto first = m_inner.begin() + begin;
+      if (nnz != begin)
+        std::copy(first, last, m_inner.begin() + nnz);
+      nnz += std::distance(first, last);
+      begin = end;
+      m_outer[j + 1] = nnz;
+    }
+    m_inner.resize(nnz);
+    m_inner.shrink_to_fit();
+  }
+}
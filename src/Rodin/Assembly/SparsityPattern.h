@@ -0,0 +1,234 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_ASSEMBLY_SPARSITYPATTERN_H
+#define RODIN_ASSEMBLY_SPARSITYPATTERN_H
+
+#include <vector>
+#include <algorithm>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/SparseMatrix.h"
+#include "Rodin/Geometry/Mesh.h"
+
+#include "ForwardDecls.h"
+
+namespace Rodin::Assembly
+{
+  /**
+   * @brief Compressed sparsity pattern of the operator associated to a
+   * bilinear form.
+   *
+   * The pattern is computed once, in a symbolic phase, from the degrees of
+   * freedom which the trial and test spaces associate to the polytopes of
+   * the mesh. It is stored in the same compressed column format as
+   * Math::SparseMatrix, so that a numeric phase may accumulate the element
+   * contributions directly into the value array of a matrix built with
+   * getMatrix().
+   *
+   * The pattern is identified by the addresses of the finite element
+   * spaces and of the mesh, the revision of the mesh, the sizes of the
+   * spaces and the polytope dimensions it was built over.
+   *
+   * @see Geometry::MeshBase::getRevision()
+   */
+  class SparsityPattern
+  {
+    public:
+      using StorageIndex = typename Math::SparseMatrix<Real>::StorageIndex;
+
+      SparsityPattern()
+        : m_rows(0), m_cols(0),
+          m_trialFES(nullptr), m_testFES(nullptr), m_mesh(nullptr), m_revision(0)
+      {}
+
+      SparsityPattern(const SparsityPattern&) = default;
+
+      SparsityPattern(SparsityPattern&&) = default;
+
+      SparsityPattern& operator=(const SparsityPattern&) = default;
+
+      SparsityPattern& operator=(SparsityPattern&&) = default;
+
+      /**
+       * @brief Computes the sparsity pattern.
+       * @param[in] trialFES Trial finite element space (columns)
+       * @param[in] testFES Test finite element space (rows)
+       * @param[in] dims Dimensions of the polytopes over which the degrees
+       * of freedom are coupled.
+       */
+      template <class TrialFES, class TestFES>
+      SparsityPattern& build(
+          const TrialFES& trialFES, const TestFES& testFES, const FlatSet<size_t>& dims)
+      {
+        const auto& mesh = trialFES.getMesh();
+        m_trialFES = &trialFES;
+        m_testFES = &testFES;
+        m_mesh = &mesh;
+        m_revision = mesh.getRevision();
+        m_dims = dims;
+        m_rows = testFES.getSize();
+        m_cols = trialFES.getSize();
+
+        // Count an upper bound for the number of entries of each column
+        m_outer.assign(m_cols + 1, 0);
+        for (const size_t d : m_dims)
+        {
+          for (Index i = 0; i < mesh.getPolytopeCount(d); i++)
+          {
+            const auto& rows = testFES.getDOFs(d, i);
+            const auto& cols = trialFES.getDOFs(d, i);
+            for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+              m_outer[cols(m) + 1] += rows.size();
+          }
+        }
+        for (size_t j = 0; j < m_cols; j++)
+          m_outer[j + 1] += m_outer[j];
+
+        // Fill each column with its (possibly repeated) row indices
+        m_inner.resize(m_outer.back());
+        std::vector<StorageIndex> cursor(m_outer.begin(), m_outer.end() - 1);
+        for (const size_t d : m_dims)
+        {
+          for (Index i = 0; i < mesh.getPolytopeCount(d); i++)
+          {
+            const auto& rows = testFES.getDOFs(d, i);
+            const auto& cols = trialFES.getDOFs(d, i);
+            for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+            {
+              StorageIndex& k = cursor[cols(m)];
+              for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                m_inner[k++] = rows(l);
+            }
+          }
+        }
+
+        compress();
+        return *this;
+      }
+
+      /**
+       * @brief Determines if the pattern was built for the given finite
+       * element spaces and polytope dimensions, on the current revision of
+       * their mesh.
+       */
+      template <class TrialFES, class TestFES>
+      bool matches(
+          const TrialFES& trialFES, const TestFES& testFES, const FlatSet<size_t>& dims) const
+      {
+        if (m_trialFES != &trialFES || m_testFES != &testFES)
+          return false;
+        const auto& mesh = trialFES.getMesh();
+        if (m_mesh != &mesh || m_revision != mesh.getRevision())
+          return false;
+        if (m_rows != testFES.getSize() || m_cols != trialFES.getSize())
+          return false;
+        return m_dims == dims;
+      }
+
+      /**
+       * @brief Gets the position of the @f$ (i, j) @f$ entry in the value
+       * array of the compressed matrix.
+       *
+       * The entry must be part of the pattern.
+       */
+      Index getPosition(Index i, Index j) const;
+
+      /**
+       * @brief Builds a compressed matrix with the sparsity pattern and all
+       * its values set to zero.
+       */
+      template <class Scalar>
+      Math::SparseMatrix<Scalar> getMatrix() const
+      {
+        Math::SparseMatrix<Scalar> res(m_rows, m_cols);
+        res.resizeNonZeros(m_inner.size());
+        std::copy(m_outer.begin(), m_outer.end(), res.outerIndexPtr());
+        std::copy(m_inner.begin(), m_inner.end(), res.innerIndexPtr());
+        std::fill(res.valuePtr(), res.valuePtr() + m_inner.size(), Scalar(0));
+        return res;
+      }
+
+      /**
+       * @brief Sets all the values of @p res to zero, reusing its storage if
+       * it already has the sparsity pattern.
+       *
+       * Otherwise @p res is replaced by getMatrix().
+       */
+      template <class Scalar>
+      void getMatrix(Math::SparseMatrix<Scalar>& res) const
+      {
+        if (isPatternOf(res))
+          std::fill(res.valuePtr(), res.valuePtr() + m_inner.size(), Scalar(0));
+        else
+          res = getMatrix<Scalar>();
+      }
+
+      /**
+       * @brief Determines if the compressed matrix @p m has exactly this
+       * sparsity pattern.
+       */
+      template <class Scalar>
+      bool isPatternOf(const Math::SparseMatrix<Scalar>& m) const
+      {
+        if (!m.isCompressed())
+          return false;
+        if (static_cast<size_t>(m.rows()) != m_rows || static_cast<size_t>(m.cols()) != m_cols)
+          return false;
+        if (static_cast<size_t>(m.nonZeros()) != m_inner.size())
+          return false;
+        return std::equal(m_outer.begin(), m_outer.end(), m.outerIndexPtr())
+          && std::equal(m_inner.begin(), m_inner.end(), m.innerIndexPtr());
+      }
+
+      /**
+       * @brief Gets the number of structural nonzeros.
+       */
+      size_t getNonZeros() const
+      {
+        return m_inner.size();
+      }
+
+      size_t getRows() const
+      {
+        return m_rows;
+      }
+
+      size_t getColumns() const
+      {
+        return m_cols;
+      }
+
+      const std::vector<StorageIndex>& getOuterIndices() const
+      {
+        return m_outer;
+      }
+
+      const std::vector<StorageIndex>& getInnerIndices() const
+      {
+        return m_inner;
+      }
+
+    private:
+      /**
+       * @brief Sorts the row indices of each column and removes duplicates.
+       */
+      void compress();
+
+      size_t m_rows;
+      size_t m_cols;
+      std::vector<StorageIndex> m_outer;
+      std::vector<StorageIndex> m_inner;
+
+      const void* m_trialFES;
+      const void* m_testFES;
+      const void* m_mesh;
+      size_t m_revision;
+      FlatSet<size_t> m_dims;
+  };
+}
+
+#endif
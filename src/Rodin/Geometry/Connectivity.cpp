@@ -4,10 +4,152 @@
  *       (See accompanying file LICENSE or copy at
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
+#include <array>
+#include <bit>
+#include <cstdint>
+
+#include "Rodin/Configure.h"
+#include "Rodin/Threads/ThreadPool.h"
+
 #include "Connectivity.h"
 
 namespace Rodin::Geometry
 {
+  namespace
+  {
+    /**
+     * Sub-polytope of a cell, keyed by its sorted vertices. The unused
+     * trailing entries of the key are padded with the vertex count.
+     */
+    struct SubPolytopeKey
+    {
+      std::array<Index, 4> key;
+      Index cell;
+      Index position;
+    };
+
+    /**
+     * Sub-polytope of a cell with its vertices in the original ordering.
+     */
+    struct SubPolytopeVertices
+    {
+      Polytope::Type geometry;
+      uint8_t size;
+      std::array<Index, 4> vertices;
+    };
+
+    size_t getSubPolytopeCount(Polytope::Type g, size_t d)
+    {
+      static const GeometryIndexed<std::array<size_t, 4>> s_count =
+      {
+        { Polytope::Type::Point, { 1, 0, 0, 0 } },
+        { Polytope::Type::Segment, { 2, 1, 0, 0 } },
+        { Polytope::Type::Triangle, { 3, 3, 1, 0 } },
+        { Polytope::Type::Quadrilateral, { 4, 4, 1, 0 } },
+        { Polytope::Type::Tetrahedron, { 4, 6, 4, 1 } },
+        { Polytope::Type::TriangularPrism, { 6, 9, 5, 1 } }
+      };
+      assert(d < 4);
+      return s_count[g][d];
+    }
+
+    size_t getChunkCount()
+    {
+#ifdef RODIN_MULTITHREADED
+      return Threads::getGlobalThreadPool().getThreadCount();
+#else
+      return 1;
+#endif
+    }
+
+    /**
+     * Calls loop(start, end) over blocks of [0, count), in parallel on the
+     * global thread pool if Rodin is multithreaded.
+     */
+    template <class F>
+    void parallelLoop(size_t count, const F& loop)
+    {
+      if (count == 0)
+        return;
+#ifdef RODIN_MULTITHREADED
+      auto& threadPool = Threads::getGlobalThreadPool();
+      threadPool.pushLoop(0, count, loop);
+      threadPool.waitForTasks();
+#else
+      loop(0, count);
+#endif
+    }
+
+    /**
+     * Sorts the sub-polytopes lexicographically by key, using a stable
+     * least significant digit radix sort with 8-bit digits. The histogram
+     * and scatter steps of each pass are carried out in parallel over
+     * contiguous chunks of the input.
+     */
+    void radixSort(std::vector<SubPolytopeKey>& entries, size_t width, size_t bits)
+    {
+      constexpr size_t radix = 256;
+      const size_t n = entries.size();
+      const size_t chunks = std::max<size_t>(1, std::min(getChunkCount(), n));
+      std::vector<SubPolytopeKey> buffer(n);
+      std::vector<std::array<Index, radix>> histograms(chunks);
+      const auto getChunk =
+        [&](size_t c) -> std::pair<size_t, size_t>
+        {
+          return { c * n / chunks, (c + 1) * n / chunks };
+        };
+      for (size_t w = width; w-- > 0;)
+      {
+        for (size_t shift = 0; shift < bits; shift += 8)
+        {
+          const auto digit =
+            [&](const SubPolytopeKey& e) -> size_t
+            {
+              return (e.key[w] >> shift) & (radix - 1);
+            };
+
+          parallelLoop(chunks,
+              [&](const Index start, const Index end)
+              {
+                for (Index c = start; c < end; c++)
+                {
+                  auto& h = histograms[c];
+                  h.fill(0);
+                  const auto [first, last] = getChunk(c);
+                  for (size_t k = first; k < last; k++)
+                    h[digit(entries[k])]++;
+                }
+              });
+
+          Index offset = 0;
+          for (size_t b = 0; b < radix; b++)
+          {
+            for (size_t c = 0; c < chunks; c++)
+            {
+              const Index count = histograms[c][b];
+              histograms[c][b] = offset;
+              offset += count;
+            }
+          }
+
+          parallelLoop(chunks,
+              [&](const Index start, const Index end)
+              {
+                for (Index c = start; c < end; c++)
+                {
+                  auto& h = histograms[c];
+                  const auto [first, last] = getChunk(c);
+                  for (size_t k = first; k < last; k++)
+                    buffer[h[digit(entries[k])]++] = entries[k];
+                }
+              });
+
+          std::swap(entries, buffer);
+        }
+      }
+    }
+  }
+
   Connectivity<Context::Local>::Connectivity()
   {
     m_count.resize(1, 0);
@@ -71,7 +213,7 @@ namespace Rodin::Geometry
     auto [it, inserted] = m_index[d].left.insert({ in, m_count[d] });
     if (inserted)
     {
-      m_connectivity[d][0].emplace_back().insert_unique(it->first.begin(), it->first.end());
+      m_connectivity[d][0].push_back(it->first.begin(), it->first.end());
       m_geometry[d].push_back(t);
       m_count[d] += 1;
       m_gcount[t] += 1;
@@ -90,7 +232,7 @@ namespace Rodin::Geometry
     auto [it, inserted] = m_index[d].left.insert({ std::move(in), m_count[d] });
     if (inserted)
     {
-      m_connectivity[d][0].emplace_back().insert_unique(it->first.begin(), it->first.end());
+      m_connectivity[d][0].push_back(it->first.begin(), it->first.end());
       m_geometry[d].push_back(t);
       m_count[d] += 1;
       m_gcount[t] += 1;
@@ -122,7 +264,7 @@ namespace Rodin::Geometry
     return m_connectivity[d][dp];
   }
 
-  const IndexSet& Connectivity<Context::Local>::getIncidence(
+  Incidence::Range Connectivity<Context::Local>::getIncidence(
       const std::pair<size_t, size_t> p, Index idx) const
   {
     const auto& [d, dp] = p;
@@ -220,8 +362,110 @@ namespace Rodin::Geometry
     assert(d < D);
     assert(!m_dirty[D][0]);
     assert(!m_dirty[D][D]);
-    for (Index i = 0; i < m_count[D]; i++)
-      local(i, d);
+    const size_t cellCount = m_count[D];
+    const Index pad = m_count[0];
+
+    // Position of the sub-polytopes of each cell in the emission order
+    std::vector<Index> offsets(cellCount + 1);
+    offsets[0] = 0;
+    for (Index i = 0; i < cellCount; i++)
+      offsets[i + 1] = offsets[i] + getSubPolytopeCount(m_geometry[D][i], d);
+    const size_t total = offsets[cellCount];
+
+    // Emit the sub-polytopes of all the cells
+    std::vector<SubPolytopeKey> entries(total);
+    std::vector<SubPolytopeVertices> vertices(total);
+    parallelLoop(cellCount,
+        [&](const Index start, const Index end)
+        {
+          std::vector<SubPolytope> subpolytopes;
+          for (Index i = start; i < end; i++)
+          {
+            getSubPolytopes(subpolytopes, i, d);
+            assert(subpolytopes.size() == offsets[i + 1] - offsets[i]);
+            for (size_t k = 0; k < subpolytopes.size(); k++)
+            {
+              const auto& [geometry, p] = subpolytopes[k];
+              const Index position = offsets[i] + k;
+              assert(p.size() <= 4);
+              auto& e = entries[position];
+              auto& v = vertices[position];
+              v.geometry = geometry;
+              v.size = p.size();
+              v.vertices.fill(pad);
+              std::copy(p.begin(), p.end(), v.vertices.begin());
+              e.key = v.vertices;
+              std::sort(e.key.begin(), e.key.begin() + v.size);
+              e.cell = i;
+              e.position = position;
+            }
+          }
+        });
+
+    // Sort the sub-polytopes by key. The sort is stable, hence the first
+    // entry of each group of equal keys is its first appearance.
+    size_t width = 0;
+    for (const auto& v : vertices)
+      width = std::max<size_t>(width, v.size);
+    radixSort(entries, width, std::bit_width(pad));
+
+    // Assign the global indices. Polytopes which already exist keep their
+    // index, and new ones are numbered in order of first appearance.
+    std::vector<Index> ids(total);
+    std::vector<std::pair<Index, Index>> created; // (first position, group start)
+    const bool lookup = m_count[d] > 0;
+    for (size_t k = 0; k < total;)
+    {
+      size_t last = k + 1;
+      while (last < total && entries[last].key == entries[k].key)
+        last++;
+      std::optional<Index> idx;
+      if (lookup)
+      {
+        const auto& v = vertices[entries[k].position];
+        IndexArray key(v.size);
+        std::copy(v.vertices.begin(), v.vertices.begin() + v.size, key.begin());
+        idx = getIndex(d, key);
+      }
+      if (idx)
+      {
+        for (size_t l = k; l < last; l++)
+          ids[entries[l].position] = *idx;
+      }
+      else
+      {
+        created.emplace_back(entries[k].position, k);
+      }
+      k = last;
+    }
+    std::sort(created.begin(), created.end());
+
+    m_geometry[d].reserve(m_count[d] + created.size());
+    m_connectivity[d][0].reserve(m_count[d] + created.size());
+    for (const auto& [position, k] : created)
+    {
+      const Index idx = m_count[d];
+      const auto& [geometry, size, vs] = vertices[position];
+      IndexArray key(size);
+      std::copy(vs.begin(), vs.begin() + size, key.begin());
+      m_connectivity[d][0].push_back(key.begin(), key.end());
+      m_index[d].left.insert({ std::move(key), idx });
+      m_geometry[d].push_back(geometry);
+      m_count[d] += 1;
+      m_gcount[geometry] += 1;
+      for (size_t l = k; l < total && entries[l].key == entries[k].key; l++)
+        ids[entries[l].position] = idx;
+    }
+
+    // The sub-polytopes of cell i occupy [offsets[i], offsets[i + 1])
+    parallelLoop(cellCount,
+        [&](const Index start, const Index end)
+        {
+          for (Index i = start; i < end; i++)
+            std::sort(ids.begin() + offsets[i], ids.begin() + offsets[i + 1]);
+        });
+    m_connectivity[D][d] = Incidence(std::move(offsets), std::move(ids));
+
     m_dirty[D][d] = false;
     m_dirty[d][0] = false;
     return *this;
@@ -233,9 +477,10 @@ namespace Rodin::Geometry
     const size_t D = getMeshDimension();
     assert(d > 0);
     assert(d < D);
-    IndexSet s;
+    std::vector<Index> s;
     std::vector<SubPolytope> subpolytopes;
     getSubPolytopes(subpolytopes, i, d);
+    s.reserve(subpolytopes.size());
     for (auto& [geometry, vertices] : subpolytopes)
     {
       auto insert = m_index[d].left.insert({ std::move(vertices), m_count[d] });
@@ -245,13 +490,13 @@ namespace Rodin::Geometry
       if (inserted)
       {
         m_geometry[d].push_back(geometry);
-        m_connectivity[d][0].emplace_back().insert_unique(v.begin(), v.end());
+        m_connectivity[d][0].push_back(v.begin(), v.end());
       }
       m_count[d] += inserted && !(d == D || d == 0);
       m_gcount[geometry] += inserted && !(d == D || d == 0);
-      s.insert(idx);
+      s.push_back(idx);
     }
-    m_connectivity[D][d].push_back(std::move(s));
+    m_connectivity[D][d].push_back(s.begin(), s.end());
     return *this;
   }
 
@@ -262,12 +507,31 @@ namespace Rodin::Geometry
     assert(d < dp);
     assert(d < m_connectivity.size());
     assert(dp < m_connectivity[d].size());
-    m_connectivity[d][dp].resize(m_count[d]);
+    const auto& in = m_connectivity[dp][d];
+    assert(in.size() == m_count[dp]);
+    const auto& inOffsets = in.getOffsets();
+    const auto& inIndices = in.getIndices();
+
+    // Count the polytopes incident to each polytope of dimension d
+    std::vector<Index> offsets(m_count[d] + 1, 0);
+    for (const Index i : inIndices)
+    {
+      assert(i < m_count[d]);
+      offsets[i + 1]++;
+    }
+    for (size_t i = 0; i < m_count[d]; i++)
+      offsets[i + 1] += offsets[i];
+
+    // Scatter in increasing order of j, so that each row ends up sorted
+    std::vector<Index> indices(inIndices.size());
+    std::vector<Index> cursor(offsets.begin(), offsets.end() - 1);
     for (Index j = 0; j < m_count[dp]; j++)
     {
-      for (Index i : m_connectivity[dp][d][j])
-        m_connectivity[d][dp][i].insert(j);
+      for (Index k = inOffsets[j]; k < inOffsets[j + 1]; k++)
+        indices[cursor[inIndices[k]]++] = j;
     }
+
+    m_connectivity[d][dp] = Incidence(std::move(offsets), std::move(indices));
     m_dirty[d][dp] = false;
     return *this;
   }
@@ -276,27 +540,44 @@ namespace Rodin::Geometry
   Connectivity<Context::Local>::intersection(size_t d, size_t dp, size_t dpp)
   {
     assert(d >= dp);
-    m_connectivity[d][dp].resize(m_count[d]);
+    const auto& ddpp = m_connectivity[d][dpp];
+    const auto& dppdp = m_connectivity[dpp][dp];
+    const auto& d0 = m_connectivity[d][0];
+    const auto& dp0 = m_connectivity[dp][0];
+    std::vector<Index> offsets, indices, row;
+    offsets.reserve(m_count[d] + 1);
+    offsets.push_back(0);
+    indices.reserve(ddpp.getIndices().size());
     for (Index i = 0; i < m_count[d]; i++)
     {
-      assert(i < m_connectivity[d][dpp].size());
-      for (Index k : m_connectivity[d][dpp][i])
+      assert(i < ddpp.size());
+      row.clear();
+      for (const Index k : ddpp[i])
       {
-        assert(k < m_connectivity[dpp][dp].size());
-        for (Index j : m_connectivity[dpp][dp][k])
+        assert(k < dppdp.size());
+        for (const Index j : dppdp[k])
         {
-          assert(i < m_connectivity[d][0].size());
-          assert(j < m_connectivity[dp][0].size());
-          const auto& d0i = m_connectivity[d][0][i];
-          const auto& d0j = m_connectivity[dp][0][j];
-          if ((d == dp && i != j) ||
-              (d > dp && std::includes(d0i.begin(), d0i.end(), d0j.begin(), d0j.end())))
+          if (d == dp)
+          {
+            if (i != j)
+              row.push_back(j);
+          }
+          else
           {
-            m_connectivity[d][dp][i].insert(j);
+            assert(i < d0.size());
+            assert(j < dp0.size());
+            const auto d0i = d0[i];
+            const auto d0j = dp0[j];
+            if (std::includes(d0i.begin(), d0i.end(), d0j.begin(), d0j.end()))
+              row.push_back(j);
           }
         }
       }
+      std::sort(row.begin(), row.end());
+      indices.insert(indices.end(), row.begin(), std::unique(row.begin(), row.end()));
+      offsets.push_back(indices.size());
     }
+    m_connectivity[d][dp] = Incidence(std::move(offsets), std::move(indices));
     m_dirty[d][dp] = false;
     return *this;
   }
@@ -34,7 +34,7 @@ namespace Rodin::Geometry
       virtual size_t getCount(Polytope::Type g) const = 0;
       virtual size_t getMeshDimension() const = 0;
       virtual const Incidence& getIncidence(size_t d, size_t dp) const = 0;
-      virtual const IndexSet& getIncidence(const std::pair<size_t, size_t> p, Index idx) const = 0;
+      virtual Incidence::Range getIncidence(const std::pair<size_t, size_t> p, Index idx) const = 0;
   };
 
   using SequentialConnectivity = Connectivity<Context::Local>;
@@ -113,6 +113,11 @@ namespace Rodin::Geometry
        *  D \longrightarrow d \quad \text{and} \quad D \longrightarrow 0, \quad 0 < d < D,
        * @f]
        * from @f$ D \longrightarrow 0 @f$ and @f$ D \longrightarrow D @f$.
+       *
+       * The sub-polytopes of all the cells are emitted in parallel, keyed by
+       * their sorted vertices, and deduplicated with a radix sort. New
+       * entities are numbered in order of first appearance, so the result
+       * is the same as calling local() on each cell in turn.
        */
       Connectivity& build(size_t d);
 
@@ -144,7 +149,7 @@ namespace Rodin::Geometry
 
       const Incidence& getIncidence(size_t d, size_t dp) const override;
 
-      const IndexSet& getIncidence(const std::pair<size_t, size_t> p, Index idx) const override;
+      Incidence::Range getIncidence(const std::pair<size_t, size_t> p, Index idx) const override;
 
     private:
       size_t m_maximalDimension;
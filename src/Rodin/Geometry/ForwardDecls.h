@@ -37,6 +37,8 @@ namespace Rodin::Geometry
 
   class Point;
 
+  class GeometricFactors;
+
   class PolytopeIterator;
 
   class CellIterator;
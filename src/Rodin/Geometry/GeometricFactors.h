@@ -0,0 +1,200 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_GEOMETRY_GEOMETRICFACTORS_H
+#define RODIN_GEOMETRY_GEOMETRICFACTORS_H
+
+#include <vector>
+#include <cassert>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Matrix.h"
+
+namespace Rodin::Geometry
+{
+  /**
+   * @brief Table of the geometric factors of the polytopes of a given
+   * dimension.
+   *
+   * For each polytope @f$ \tau @f$ whose transformation @f$ x : K
+   * \rightarrow \tau @f$ is affine, the table stores the (constant) Jacobian
+   * matrix @f$ \mathbf{J}_x @f$, its (pseudo-)inverse, its determinant and
+   * the distortion of space. Each quantity is stored contiguously in its own
+   * array, indexed by the polytope index, and the matrices are stored in
+   * column-major order.
+   *
+   * Entries of polytopes which are not affine are left empty, and the factors
+   * must be evaluated pointwise instead.
+   *
+   * The table holds the revision of the mesh at which it was computed, and
+   * is only valid as long as the mesh keeps this revision.
+   *
+   * @see MeshBase::getGeometricFactors(size_t) const
+   */
+  class GeometricFactors
+  {
+    public:
+      /**
+       * @brief Constructs an empty table for the polytopes of dimension @p
+       * dimension.
+       * @param[in] dimension Polytope dimension
+       * @param[in] sdim Space dimension
+       * @param[in] revision Revision of the mesh
+       */
+      GeometricFactors(size_t dimension, size_t sdim, size_t revision)
+        : m_dimension(dimension), m_sdim(sdim), m_revision(revision)
+      {}
+
+      GeometricFactors(const GeometricFactors&) = default;
+
+      GeometricFactors(GeometricFactors&&) = default;
+
+      GeometricFactors& operator=(const GeometricFactors&) = default;
+
+      GeometricFactors& operator=(GeometricFactors&&) = default;
+
+      GeometricFactors& reserve(size_t count)
+      {
+        const size_t n = m_sdim * m_dimension;
+        m_affine.reserve(count);
+        m_jacobian.reserve(n * count);
+        m_jacobianInverse.reserve(n * count);
+        m_jacobianDeterminant.reserve(count);
+        m_distortion.reserve(count);
+        return *this;
+      }
+
+      /**
+       * @brief Appends the factors of the next (affine) polytope.
+       */
+      GeometricFactors& push_back(
+          const Math::SpatialMatrix<Real>& jacobian,
+          const Math::SpatialMatrix<Real>& jacobianInverse,
+          Real jacobianDeterminant, Real distortion)
+      {
+        assert(static_cast<size_t>(jacobian.rows()) == m_sdim);
+        assert(static_cast<size_t>(jacobian.cols()) == m_dimension);
+        assert(static_cast<size_t>(jacobianInverse.rows()) == m_dimension);
+        assert(static_cast<size_t>(jacobianInverse.cols()) == m_sdim);
+        m_affine.push_back(true);
+        m_jacobian.insert(m_jacobian.end(),
+            jacobian.data(), jacobian.data() + jacobian.size());
+        m_jacobianInverse.insert(m_jacobianInverse.end(),
+            jacobianInverse.data(), jacobianInverse.data() + jacobianInverse.size());
+        m_jacobianDeterminant.push_back(jacobianDeterminant);
+        m_distortion.push_back(distortion);
+        return *this;
+      }
+
+      /**
+       * @brief Appends an empty entry for the next (non-affine) polytope.
+       */
+      GeometricFactors& skip()
+      {
+        const size_t n = m_sdim * m_dimension;
+        m_affine.push_back(false);
+        m_jacobian.resize(m_jacobian.size() + n, 0);
+        m_jacobianInverse.resize(m_jacobianInverse.size() + n, 0);
+        m_jacobianDeterminant.push_back(0);
+        m_distortion.push_back(0);
+        return *this;
+      }
+
+      size_t getDimension() const
+      {
+        return m_dimension;
+      }
+
+      size_t getSpaceDimension() const
+      {
+        return m_sdim;
+      }
+
+      /**
+       * @brief Gets the revision of the mesh at which the table was
+       * computed.
+       */
+      size_t getRevision() const
+      {
+        return m_revision;
+      }
+
+      /**
+       * @brief Sets the revision of the mesh for which the table is valid.
+       *
+       * Used when the table is carried over to a mesh with the same
+       * geometry.
+       */
+      GeometricFactors& setRevision(size_t revision)
+      {
+        m_revision = revision;
+        return *this;
+      }
+
+      size_t size() const
+      {
+        return m_affine.size();
+      }
+
+      /**
+       * @brief Determines if the factors of the @f$ i @f$-th polytope are
+       * stored in the table.
+       */
+      bool isAffine(Index i) const
+      {
+        assert(i < size());
+        return m_affine[i];
+      }
+
+      /**
+       * @brief Gets the @f$ s \times d @f$ Jacobian matrix of the @f$ i
+       * @f$-th polytope.
+       */
+      Eigen::Map<const Math::Matrix<Real>> getJacobian(Index i) const
+      {
+        assert(isAffine(i));
+        const size_t n = m_sdim * m_dimension;
+        return { m_jacobian.data() + n * i,
+          static_cast<Eigen::Index>(m_sdim), static_cast<Eigen::Index>(m_dimension) };
+      }
+
+      /**
+       * @brief Gets the @f$ d \times s @f$ (pseudo-)inverse of the Jacobian
+       * matrix of the @f$ i @f$-th polytope.
+       */
+      Eigen::Map<const Math::Matrix<Real>> getJacobianInverse(Index i) const
+      {
+        assert(isAffine(i));
+        const size_t n = m_sdim * m_dimension;
+        return { m_jacobianInverse.data() + n * i,
+          static_cast<Eigen::Index>(m_dimension), static_cast<Eigen::Index>(m_sdim) };
+      }
+
+      Real getJacobianDeterminant(Index i) const
+      {
+        assert(isAffine(i));
+        return m_jacobianDeterminant[i];
+      }
+
+      Real getDistortion(Index i) const
+      {
+        assert(isAffine(i));
+        return m_distortion[i];
+      }
+
+    private:
+      size_t m_dimension;
+      size_t m_sdim;
+      size_t m_revision;
+      std::vector<bool> m_affine;
+      std::vector<Real> m_jacobian;
+      std::vector<Real> m_jacobianInverse;
+      std::vector<Real> m_jacobianDeterminant;
+      std::vector<Real> m_distortion;
+  };
+}
+
+#endif
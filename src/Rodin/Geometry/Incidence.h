@@ -0,0 +1,216 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_GEOMETRY_INCIDENCE_H
+#define RODIN_GEOMETRY_INCIDENCE_H
+
+#include <vector>
+#include <cassert>
+#include <algorithm>
+
+#include "Rodin/Types.h"
+
+namespace Rodin::Geometry
+{
+  /**
+   * @brief Represents the incidence @f$ d \longrightarrow d' @f$ of the
+   * polytopes of a mesh.
+   *
+   * The incidence is stored in compressed sparse row (CSR) format: the
+   * indices of the polytopes incident to the @f$ i @f$-th polytope are
+   * stored contiguously, and in increasing order, in the range
+   * @f$ [\mathrm{offsets}[i], \mathrm{offsets}[i + 1]) @f$ of a single index
+   * array.
+   */
+  class Incidence
+  {
+    public:
+      /**
+       * @brief Non-owning view of the sorted indices incident to a polytope.
+       */
+      class Range
+      {
+        public:
+          using value_type = Index;
+
+          using size_type = size_t;
+
+          using const_iterator = const Index*;
+
+          using iterator = const_iterator;
+
+          constexpr
+          Range()
+            : m_begin(nullptr), m_end(nullptr)
+          {}
+
+          constexpr
+          Range(const Index* begin, const Index* end)
+            : m_begin(begin), m_end(end)
+          {}
+
+          constexpr
+          Range(const Range&) = default;
+
+          constexpr
+          Range& operator=(const Range&) = default;
+
+          constexpr
+          const_iterator begin() const
+          {
+            return m_begin;
+          }
+
+          constexpr
+          const_iterator end() const
+          {
+            return m_end;
+          }
+
+          constexpr
+          size_t size() const
+          {
+            return m_end - m_begin;
+          }
+
+          constexpr
+          bool empty() const
+          {
+            return m_begin == m_end;
+          }
+
+          constexpr
+          Index operator[](size_t k) const
+          {
+            assert(k < size());
+            return m_begin[k];
+          }
+
+          bool contains(Index i) const
+          {
+            return std::binary_search(m_begin, m_end, i);
+          }
+
+          size_t count(Index i) const
+          {
+            return contains(i);
+          }
+
+          bool operator==(const Range& other) const
+          {
+            return std::equal(m_begin, m_end, other.m_begin, other.m_end);
+          }
+
+          bool operator==(const IndexSet& other) const
+          {
+            return std::equal(m_begin, m_end, other.begin(), other.end());
+          }
+
+        private:
+          const Index* m_begin;
+          const Index* m_end;
+      };
+
+      Incidence()
+        : m_offsets{ 0 }
+      {}
+
+      /**
+       * @brief Constructs the incidence from its offset and index arrays.
+       *
+       * @p offsets must have one more entry than the number of polytopes,
+       * start at zero and end at the size of @p indices.
+       */
+      Incidence(std::vector<Index>&& offsets, std::vector<Index>&& indices)
+        : m_offsets(std::move(offsets)), m_indices(std::move(indices))
+      {
+        assert(m_offsets.size() > 0);
+        assert(m_offsets.front() == 0);
+        assert(m_offsets.back() == m_indices.size());
+      }
+
+      Incidence(const Incidence&) = default;
+
+      Incidence(Incidence&&) = default;
+
+      Incidence& operator=(const Incidence&) = default;
+
+      Incidence& operator=(Incidence&&) = default;
+
+      /**
+       * @brief Gets the number of polytopes in the incidence.
+       */
+      size_t size() const
+      {
+        return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+      }
+
+      Range operator[](Index i) const
+      {
+        assert(i < size());
+        const Index* data = m_indices.data();
+        return Range(data + m_offsets[i], data + m_offsets[i + 1]);
+      }
+
+      Range at(Index i) const
+      {
+        return operator[](i);
+      }
+
+      /**
+       * @brief Appends the incidence of the next polytope.
+       *
+       * The indices in @f$ [first, last) @f$ are sorted and deduplicated.
+       */
+      template <class Iterator>
+      Incidence& push_back(Iterator first, Iterator last)
+      {
+        if (m_offsets.empty())
+          m_offsets.push_back(0);
+        const size_t start = m_indices.size();
+        m_indices.insert(m_indices.end(), first, last);
+        std::sort(m_indices.begin() + start, m_indices.end());
+        m_indices.erase(
+            std::unique(m_indices.begin() + start, m_indices.end()), m_indices.end());
+        m_offsets.push_back(m_indices.size());
+        return *this;
+      }
+
+      /**
+       * @brief Reserves space for the given number of polytopes and incident
+       * indices.
+       */
+      Incidence& reserve(size_t count, size_t nnz = 0)
+      {
+        m_offsets.reserve(count + 1);
+        m_indices.reserve(nnz);
+        return *this;
+      }
+
+      Incidence& clear()
+      {
+        m_offsets.assign(1, 0);
+        m_indices.clear();
+        return *this;
+      }
+
+      const std::vector<Index>& getOffsets() const
+      {
+        return m_offsets;
+      }
+
+      const std::vector<Index>& getIndices() const
+      {
+        return m_indices;
+      }
+
+    private:
+      std::vector<Index> m_offsets;
+      std::vector<Index> m_indices;
+  };
+}
+
+#endif
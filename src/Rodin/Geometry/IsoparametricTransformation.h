@@ -11,6 +11,8 @@
 
 #include "Rodin/Geometry/Polytope.h"
 
+#include "Rodin/Variational/P1/ForwardDecls.h"
+
 #include "PolytopeTransformation.h"
 
 #include "ForwardDecls.h"
@@ -107,6 +109,19 @@ namespace Rodin::Geometry
         const size_t pdim = getPhysicalDimension();
         assert(rc.size() >= 0);
         assert(static_cast<size_t>(rc.size()) == getReferenceDimension());
+        if constexpr (std::is_same_v<FE, Variational::RealP1Element>)
+        {
+          const bool simplex =
+            FE::dispatchSimplex(pdim, m_fe.getGeometry(),
+                [&](auto s, auto r)
+                {
+                  constexpr size_t S = decltype(s)::value;
+                  constexpr size_t R = decltype(r)::value;
+                  pc = m_pm.template topLeftCorner<S, R + 1>() * FE::template getSimplexBasis<R>(rc);
+                });
+          if (simplex)
+            return;
+        }
         pc.resize(pdim);
         pc.setZero();
         for (size_t local = 0; local < m_fe.getCount(); local++)
@@ -123,6 +138,20 @@ namespace Rodin::Geometry
         assert(rc.size() >= 0);
         assert(static_cast<size_t>(rc.size()) == rdim);
         const size_t pdim = getPhysicalDimension();
+        if constexpr (std::is_same_v<FE, Variational::RealP1Element>)
+        {
+          const bool simplex =
+            FE::dispatchSimplex(pdim, m_fe.getGeometry(),
+                [&](auto s, auto r)
+                {
+                  constexpr size_t S = decltype(s)::value;
+                  constexpr size_t R = decltype(r)::value;
+                  res = m_pm.template topLeftCorner<S, R + 1>()
+                    * FE::template getSimplexGradients<R>().transpose();
+                });
+          if (simplex)
+            return;
+        }
         res.resize(pdim, rdim);
         res.setZero();
         Math::SpatialVector<Real> gradient;
@@ -4,7 +4,12 @@
  *       (See accompanying file LICENSE or copy at
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
+#include <atomic>
+#include <numeric>
+#include <algorithm>
+
 #include "Rodin/Alert/MemberFunctionException.h"
+#include "Rodin/Threads/TaskQueue.h"
 
 #include "Rodin/Variational/P1.h"
 #include "Rodin/Variational/GridFunction.h"
@@ -14,6 +19,7 @@
 
 #include "Rodin/IO/MFEM.h"
 #include "Rodin/IO/MEDIT.h"
+#include "Rodin/IO/GMSH.h"
 
 #include "Mesh.h"
 #include "SubMesh.h"
@@ -25,6 +31,12 @@
 namespace Rodin::Geometry
 {
   // ---- MeshBase ----------------------------------------------------------
+  size_t MeshBase::getNextRevision()
+  {
+    static std::atomic<size_t> s_revision = 0;
+    return s_revision++;
+  }
+
   bool MeshBase::isSurface() const
   {
     return (getSpaceDimension() - 1 == getDimension());
@@ -32,21 +44,36 @@ namespace Rodin::Geometry
 
   // ---- Mesh<Context::Local> ----------------------------------------------
   Mesh<Context::Local>::Mesh(const Mesh& other)
-    : m_sdim(other.m_sdim),
+    : Parent(other),
+      m_sdim(other.m_sdim),
       m_vertices(other.m_vertices),
       m_connectivity(other.m_connectivity),
       m_attributeIndex(other.m_attributeIndex),
-      m_attributes(other.m_attributes)
-  {}
+      m_attributes(other.m_attributes),
+      m_coloring(other.m_coloring)
+  {
+    // The polytope transformations are not copied, hence neither are the
+    // geometric factors which were computed from them
+  }
 
   Mesh<Context::Local>::Mesh(Mesh&& other)
-    : m_sdim(std::move(other.m_sdim)),
+    : Parent(std::move(other)),
+      m_sdim(std::move(other.m_sdim)),
       m_vertices(std::move(other.m_vertices)),
       m_connectivity(std::move(other.m_connectivity)),
       m_attributeIndex(std::move(other.m_attributeIndex)),
       m_transformationIndex(std::move(other.m_transformationIndex)),
-      m_attributes(std::move(other.m_attributes))
-  {}
+      m_geometricFactors(std::move(other.m_geometricFactors)),
+      m_attributes(std::move(other.m_attributes)),
+      m_coloring(std::move(other.m_coloring))
+  {
+    // The geometry is moved along with the geometric factors
+    for (auto& factors : m_geometricFactors)
+    {
+      if (factors.has_value() && factors->getRevision() == other.getRevision())
+        factors->setRevision(getRevision());
+    }
+  }
 
   Mesh<Context::Local>& Mesh<Context::Local>::operator=(Mesh&& other)
   {
@@ -56,7 +83,14 @@ namespace Rodin::Geometry
     m_connectivity = std::move(other.m_connectivity);
     m_attributeIndex = std::move(other.m_attributeIndex);
     m_transformationIndex = std::move(other.m_transformationIndex);
+    m_geometricFactors = std::move(other.m_geometricFactors);
     m_attributes = std::move(other.m_attributes);
+    m_coloring = std::move(other.m_coloring);
+    for (auto& factors : m_geometricFactors)
+    {
+      if (factors.has_value() && factors->getRevision() == other.getRevision())
+        factors->setRevision(getRevision());
+    }
     return *this;
   }
 
@@ -76,7 +110,8 @@ namespace Rodin::Geometry
   Mesh<Context::Local>&
   Mesh<Context::Local>::load(const boost::filesystem::path& filename, IO::FileFormat fmt)
   {
-    std::ifstream input(filename.c_str());
+    std::ifstream input(filename.c_str(),
+        fmt == IO::FileFormat::GMSH ? std::ios::binary : std::ios::in);
     if (!input)
     {
       Alert::MemberFunctionException(*this, __func__)
@@ -94,6 +129,12 @@ namespace Rodin::Geometry
       case IO::FileFormat::MEDIT:
       {
         IO::MeshLoader<IO::FileFormat::MEDIT, Context> loader(*this);
+        loader.load(filename);
+        break;
+      }
+      case IO::FileFormat::GMSH:
+      {
+        IO::MeshLoader<IO::FileFormat::GMSH, Context> loader(*this);
         loader.load(input);
         break;
       }
@@ -112,7 +153,8 @@ namespace Rodin::Geometry
       const boost::filesystem::path& filename,
       IO::FileFormat fmt, size_t precision) const
   {
-    std::ofstream ofs(filename.c_str());
+    const bool binary = (fmt == IO::FileFormat::MEDIT && filename.extension() == ".meshb");
+    std::ofstream ofs(filename.c_str(), binary ? std::ios::binary : std::ios::out);
     if (!ofs)
     {
       Alert::MemberFunctionException(*this, __func__)
@@ -131,6 +173,8 @@ namespace Rodin::Geometry
       case IO::FileFormat::MEDIT:
       {
         IO::MeshPrinter<IO::FileFormat::MEDIT, Context> printer(*this);
+        if (binary)
+          printer.setEncoding(IO::MEDIT::Encoding::Binary);
         printer.print(ofs);
         break;
       }
@@ -144,6 +188,18 @@ namespace Rodin::Geometry
     ofs.close();
   }
 
+  std::future<void> Mesh<Context::Local>::saveAsync(
+      const boost::filesystem::path& filename,
+      IO::FileFormat fmt, size_t precision) const
+  {
+    auto snapshot = std::make_shared<const Mesh>(*this);
+    return Threads::getIOQueue().push(
+        [snapshot, filename, fmt, precision]()
+        {
+          snapshot->save(filename, fmt, precision);
+        });
+  }
+
   SubMesh<Context::Local> Mesh<Context::Local>::keep(Attribute attr) const
   {
     return keep(FlatSet<Attribute>{attr});
@@ -281,10 +337,212 @@ namespace Rodin::Geometry
     return *this;
   }
 
+  std::vector<Index> Mesh<Context::Local>::getReverseCuthillMcKeeOrdering() const
+  {
+    const size_t n = getVertexCount();
+    const size_t D = getDimension();
+    const auto& conn = getConnectivity();
+
+    std::vector<std::vector<Index>> adjacency(n);
+    for (Index i = 0; i < getCellCount(); i++)
+    {
+      const auto& vertices = conn.getPolytope(D, i);
+      for (const Index a : vertices)
+      {
+        for (const Index b : vertices)
+        {
+          if (a != b)
+            adjacency[a].push_back(b);
+        }
+      }
+    }
+    for (auto& neighbors : adjacency)
+    {
+      std::sort(neighbors.begin(), neighbors.end());
+      neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+
+    const auto byDegree =
+      [&](Index a, Index b)
+      {
+        return adjacency[a].size() < adjacency[b].size();
+      };
+
+    // Computes the level structure rooted at r, and returns its depth and
+    // the position of its last level
+    std::vector<Index> stamp(n, 0);
+    Index run = 0;
+    const auto levels =
+      [&](Index r, std::vector<Index>& queue) -> std::pair<size_t, size_t>
+      {
+        run++;
+        queue.assign(1, r);
+        stamp[r] = run;
+        size_t depth = 0, last = 0, begin = 0, end = 1;
+        while (begin < end)
+        {
+          last = begin;
+          depth++;
+          for (size_t k = begin; k < end; k++)
+          {
+            for (const Index w : adjacency[queue[k]])
+            {
+              if (stamp[w] != run)
+              {
+                stamp[w] = run;
+                queue.push_back(w);
+              }
+            }
+          }
+          begin = end;
+          end = queue.size();
+        }
+        return { depth, last };
+      };
+
+    std::vector<Index> order;
+    order.reserve(n);
+    std::vector<bool> numbered(n, false);
+    std::vector<Index> queue, candidate;
+    for (Index s = 0; s < n; s++)
+    {
+      if (numbered[s])
+        continue;
+
+      // Find a pseudo-peripheral vertex of the component, starting from a
+      // vertex of minimum degree
+      levels(s, queue);
+      Index root = *std::min_element(queue.begin(), queue.end(), byDegree);
+      auto [depth, last] = levels(root, queue);
+      while (true)
+      {
+        const Index x = *std::min_element(queue.begin() + last, queue.end(), byDegree);
+        const auto [d, l] = levels(x, candidate);
+        if (d <= depth)
+          break;
+        root = x;
+        depth = d;
+        last = l;
+        std::swap(queue, candidate);
+      }
+
+      // Cuthill-McKee traversal of the component
+      const size_t begin = order.size();
+      order.push_back(root);
+      numbered[root] = true;
+      for (size_t k = begin; k < order.size(); k++)
+      {
+        const size_t first = order.size();
+        for (const Index w : adjacency[order[k]])
+        {
+          if (!numbered[w])
+          {
+            numbered[w] = true;
+            order.push_back(w);
+          }
+        }
+        std::stable_sort(order.begin() + first, order.end(), byDegree);
+      }
+    }
+    assert(order.size() == n);
+
+    std::vector<Index> res(n);
+    for (size_t k = 0; k < n; k++)
+      res[order[k]] = n - 1 - k;
+    return res;
+  }
+
+  Mesh<Context::Local>& Mesh<Context::Local>::reorder(const std::vector<Index>& permutation)
+  {
+    if (isSubMesh())
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "A SubMesh cannot be reordered."
+        << Alert::Raise;
+    }
+
+    const size_t n = getVertexCount();
+    const size_t D = getDimension();
+    const size_t sdim = getSpaceDimension();
+    const auto& conn = getConnectivity();
+    assert(permutation.size() == n);
+
+    Builder build;
+    build.initialize(sdim).nodes(n);
+    Math::PointMatrix vertices(sdim, n);
+    for (Index i = 0; i < n; i++)
+      vertices.col(permutation[i]) = m_vertices.col(i);
+    build.setVertices(std::move(vertices));
+
+    // Sort the polytopes of each dimension by their new vertices
+    std::vector<std::vector<Index>> polytopes(D + 1);
+    for (size_t d = 1; d <= D; d++)
+    {
+      const size_t count = getPolytopeCount(d);
+      std::vector<IndexArray> keys(count);
+      for (Index i = 0; i < count; i++)
+      {
+        keys[i] = conn.getPolytope(d, i);
+        for (auto& v : keys[i])
+          v = permutation[v];
+        std::sort(keys[i].begin(), keys[i].end());
+      }
+      auto& order = polytopes[d];
+      order.resize(count);
+      std::iota(order.begin(), order.end(), 0);
+      std::sort(order.begin(), order.end(),
+          [&](Index a, Index b)
+          {
+            return std::lexicographical_compare(
+                keys[a].begin(), keys[a].end(), keys[b].begin(), keys[b].end());
+          });
+      build.reserve(d, count);
+      for (const Index i : order)
+      {
+        IndexArray vs = conn.getPolytope(d, i);
+        for (auto& v : vs)
+          v = permutation[v];
+        build.polytope(getGeometry(d, i), std::move(vs));
+      }
+    }
+
+    Mesh res = build.finalize();
+    for (Index i = 0; i < n; i++)
+    {
+      const Attribute attr = getAttribute(0, i);
+      if (attr != RODIN_DEFAULT_POLYTOPE_ATTRIBUTE)
+        res.setAttribute({ 0, permutation[i] }, attr);
+    }
+    for (size_t d = 1; d <= D; d++)
+    {
+      for (Index k = 0; k < polytopes[d].size(); k++)
+      {
+        const Attribute attr = getAttribute(d, polytopes[d][k]);
+        if (attr != RODIN_DEFAULT_POLYTOPE_ATTRIBUTE)
+          res.setAttribute({ d, k }, attr);
+      }
+    }
+    for (size_t d = 0; d <= D; d++)
+    {
+      for (size_t dp = 0; dp <= D; dp++)
+      {
+        if (conn.getIncidence(d, dp).size() > 0 && res.getConnectivity().getIncidence(d, dp).size() == 0)
+          res.getConnectivity().compute(d, dp);
+      }
+    }
+
+    // Release the polytope transformations of the previous numbering
+    Mesh previous(std::move(*this));
+    *this = std::move(res);
+    return *this;
+  }
+
   Mesh<Context::Local>&
   Mesh<Context::Local>::setVertexCoordinates(Index idx, const Math::SpatialVector<Real>& coords)
   {
     m_vertices.col(idx) = coords;
+    m_geometricFactors.clear();
+    updateRevision();
     return *this;
   }
 
@@ -292,6 +550,8 @@ namespace Rodin::Geometry
   Mesh<Context::Local>::setVertexCoordinates(Index idx, Real xi, size_t i)
   {
     m_vertices.col(idx).coeffRef(i) = xi;
+    m_geometricFactors.clear();
+    updateRevision();
     return *this;
   }
 
@@ -320,6 +580,9 @@ namespace Rodin::Geometry
       const std::pair<size_t, Index> p, PolytopeTransformation* trans)
   {
     m_transformationIndex[p.first].write([&](auto& obj) { obj[p.second] = trans; });
+    if (p.first < m_geometricFactors.size())
+      m_geometricFactors[p.first].reset();
+    updateRevision();
     return *this;
   }
 
@@ -377,21 +640,112 @@ namespace Rodin::Geometry
     }
   }
 
+  Mesh<Context::Local>& Mesh<Context::Local>::computeGeometricFactors(size_t d)
+  {
+    assert(0 < d && d <= getDimension());
+    if (m_geometricFactors.size() <= d)
+      m_geometricFactors.resize(getDimension() + 1);
+    m_geometricFactors[d].reset();
+
+    // The transformation of a simplex is affine, hence its factors may be
+    // evaluated at any reference point.
+    const size_t count = getPolytopeCount(d);
+    GeometricFactors factors(d, getSpaceDimension(), getRevision());
+    factors.reserve(count);
+    for (Index i = 0; i < count; i++)
+    {
+      const Polytope polytope(d, i, *this);
+      const Polytope::Type g = polytope.getGeometry();
+      if (Polytope::isSimplex(g))
+      {
+        const Point p(polytope, polytope.getTransformation(),
+            Math::SpatialVector<Real>(Polytope::getVertex(0, g)));
+        factors.push_back(
+            p.getJacobian(), p.getJacobianInverse(),
+            p.getJacobianDeterminant(), p.getDistortion());
+      }
+      else
+      {
+        factors.skip();
+      }
+    }
+    m_geometricFactors[d].emplace(std::move(factors));
+    return *this;
+  }
+
+  const GeometricFactors* Mesh<Context::Local>::getGeometricFactors(size_t d) const
+  {
+    if (d < m_geometricFactors.size() && m_geometricFactors[d].has_value())
+    {
+      const auto& factors = m_geometricFactors[d].value();
+      if (factors.getRevision() == getRevision())
+        return &factors;
+    }
+    return nullptr;
+  }
+
+  const PolytopeColoring& Mesh<Context::Local>::getColoring(size_t d) const
+  {
+    assert(d <= getDimension());
+    const size_t revision = getRevision();
+    const auto& cache = m_coloring.read();
+    if (d < cache.size() && cache[d].revision == revision)
+      return cache[d].coloring;
+
+    // Greedily assign to each polytope the smallest color which is not used
+    // by any of the polytopes sharing one of its vertices
+    PolytopeColoring res;
+    std::vector<Index> forbidden;
+    std::vector<std::vector<Index>> vertexColors(getVertexCount());
+    const auto& conn = getConnectivity();
+    const size_t count = getPolytopeCount(d);
+    for (Index i = 0; i < count; i++)
+    {
+      const auto& vertices = conn.getPolytope(d, i);
+      for (const Index v : vertices)
+      {
+        for (const Index c : vertexColors[v])
+          forbidden[c] = i + 1;
+      }
+      Index c = 0;
+      while (c < forbidden.size() && forbidden[c] == i + 1)
+        c++;
+      if (c == forbidden.size())
+      {
+        forbidden.push_back(0);
+        res.emplace_back();
+      }
+      res[c].push_back(i);
+      for (const Index v : vertices)
+        vertexColors[v].push_back(c);
+    }
+
+    m_coloring.write(
+        [&](auto& obj)
+        {
+          if (obj.size() <= d)
+            obj.resize(getDimension() + 1);
+          obj[d].revision = revision;
+          obj[d].coloring = std::move(res);
+        });
+    return m_coloring.read()[d].coloring;
+  }
+
   Real MeshBase::getVolume() const
   {
     Real totalVolume = 0;
-    for (auto it = getPolytope(3); !it.end(); ++it)
-      totalVolume += it->getMeasure();
+    for (const auto polytope : polytopes(3))
+      totalVolume += polytope.getMeasure();
     return totalVolume;
   }
 
   Real MeshBase::getVolume(Attribute attr) const
   {
     Real totalVolume = 0;
-    for (auto it = getPolytope(3); !it.end(); ++it)
+    for (const auto polytope : polytopes(3))
     {
-      if (it->getAttribute() == attr)
-        totalVolume += it->getMeasure();
+      if (polytope.getAttribute() == attr)
+        totalVolume += polytope.getMeasure();
     }
     return totalVolume;
   }
@@ -399,10 +753,10 @@ namespace Rodin::Geometry
   Real MeshBase::getVolume(const FlatSet<Attribute>& attrs) const
   {
     Real totalVolume = 0;
-    for (auto it = getPolytope(3); !it.end(); ++it)
+    for (const auto polytope : polytopes(3))
     {
-      if (attrs.contains(it->getAttribute()))
-        totalVolume += it->getMeasure();
+      if (attrs.contains(polytope.getAttribute()))
+        totalVolume += polytope.getMeasure();
     }
     return totalVolume;
   }
@@ -440,18 +794,18 @@ namespace Rodin::Geometry
   Real MeshBase::getArea() const
   {
     Real totalArea = 0;
-    for (auto it = getPolytope(2); !it.end(); ++it)
-      totalArea += it->getMeasure();
+    for (const auto polytope : polytopes(2))
+      totalArea += polytope.getMeasure();
     return totalArea;
   }
 
   Real MeshBase::getArea(Attribute attr) const
   {
     Real totalArea = 0;
-    for (auto it = getPolytope(2); !it.end(); ++it)
+    for (const auto polytope : polytopes(2))
     {
-      if (it->getAttribute() == attr)
-        totalArea += it->getMeasure();
+      if (polytope.getAttribute() == attr)
+        totalArea += polytope.getMeasure();
     }
     return totalArea;
   }
@@ -459,10 +813,10 @@ namespace Rodin::Geometry
   Real MeshBase::getArea(const FlatSet<Attribute>& attrs) const
   {
     Real totalArea = 0;
-    for (auto it = getPolytope(2); !it.end(); ++it)
+    for (const auto polytope : polytopes(2))
     {
-      if (attrs.contains(it->getAttribute()))
-        totalArea += it->getMeasure();
+      if (attrs.contains(polytope.getAttribute()))
+        totalArea += polytope.getMeasure();
     }
     return totalArea;
   }
@@ -470,18 +824,18 @@ namespace Rodin::Geometry
   Real MeshBase::getMeasure(size_t d) const
   {
     Real totalVolume = 0;
-    for (auto it = getPolytope(d); !it.end(); ++it)
-      totalVolume += it->getMeasure();
+    for (const auto polytope : polytopes(d))
+      totalVolume += polytope.getMeasure();
     return totalVolume;
   }
 
   Real MeshBase::getMeasure(size_t d, Attribute attr) const
   {
     Real totalVolume = 0;
-    for (auto it = getPolytope(d); !it.end(); ++it)
+    for (const auto polytope : polytopes(d))
     {
-      if (it->getAttribute() == attr)
-        totalVolume += it->getMeasure();
+      if (polytope.getAttribute() == attr)
+        totalVolume += polytope.getMeasure();
     }
     return totalVolume;
   }
@@ -489,10 +843,10 @@ namespace Rodin::Geometry
   Real MeshBase::getMeasure(size_t d, const FlatSet<Attribute>& attrs) const
   {
     Real totalMeasure = 0;
-    for (auto it = getPolytope(d); !it.end(); ++it)
+    for (const auto polytope : polytopes(d))
     {
-      if (attrs.contains(it->getAttribute()))
-        totalMeasure += it->getMeasure();
+      if (attrs.contains(polytope.getAttribute()))
+        totalMeasure += polytope.getMeasure();
     }
     return totalMeasure;
   }
@@ -855,10 +1209,8 @@ namespace Rodin::Geometry
     {
       if (it->get() == *this)
       {
-        auto pit = this->getPolytope(d, i);
-        std::unique_ptr<Polytope> parentPolytope(pit.release());
         return Point(
-            std::move(*parentPolytope),
+            Polytope(d, i, *this),
             this->getPolytopeTransformation(d, i),
             std::cref(p.getReferenceCoordinates()),
             p.getPhysicalCoordinates());
@@ -10,6 +10,8 @@
 #include <set>
 #include <string>
 #include <deque>
+#include <future>
+#include <optional>
 
 #include <boost/filesystem.hpp>
 
@@ -31,7 +33,9 @@
 #include "PolytopeCount.h"
 #include "PolytopeIndexed.h"
 #include "PolytopeIterator.h"
+#include "PolytopeRange.h"
 #include "PolytopeTransformation.h"
+#include "GeometricFactors.h"
 
 /**
  * @ingroup RodinDirectives
@@ -169,8 +173,32 @@ namespace Rodin::Geometry
   class MeshBase
   {
     public:
+      MeshBase()
+        : m_revision(getNextRevision())
+      {}
+
+      MeshBase(const MeshBase&)
+        : m_revision(getNextRevision())
+      {}
+
+      MeshBase(MeshBase&&)
+        : m_revision(getNextRevision())
+      {}
+
       virtual ~MeshBase() = default;
 
+      MeshBase& operator=(const MeshBase&)
+      {
+        updateRevision();
+        return *this;
+      }
+
+      MeshBase& operator=(MeshBase&&)
+      {
+        updateRevision();
+        return *this;
+      }
+
       constexpr
       bool operator==(const MeshBase& other) const
       {
@@ -413,6 +441,42 @@ namespace Rodin::Geometry
        */
       virtual PolytopeIterator getPolytope(size_t dimension, Index idx = 0) const = 0;
 
+      /**
+       * @brief Gets the range of the cells of the mesh.
+       *
+       * Unlike getCell(), iterating over the range yields each cell by value
+       * and does not allocate.
+       */
+      PolytopeRange<Cell> cells() const
+      {
+        return PolytopeRange<Cell>(getDimension(), *this, 0, getCellCount());
+      }
+
+      /**
+       * @brief Gets the range of the faces of the mesh.
+       */
+      PolytopeRange<Face> faces() const
+      {
+        return PolytopeRange<Face>(getDimension() - 1, *this, 0, getFaceCount());
+      }
+
+      /**
+       * @brief Gets the range of the vertices of the mesh.
+       */
+      PolytopeRange<Vertex> vertices() const
+      {
+        return PolytopeRange<Vertex>(0, *this, 0, getVertexCount());
+      }
+
+      /**
+       * @brief Gets the range of the polytopes of the given dimension.
+       * @param[in] dimension Polytope dimension
+       */
+      PolytopeRange<Polytope> polytopes(size_t dimension) const
+      {
+        return PolytopeRange<Polytope>(dimension, *this, 0, getPolytopeCount(dimension));
+      }
+
       /**
        * @brief Gets the PolytopeTransformation associated to the @f$ (d, i)
        * @f$-polytope.
@@ -421,6 +485,18 @@ namespace Rodin::Geometry
        */
       virtual const PolytopeTransformation& getPolytopeTransformation(size_t dimension, Index idx) const = 0;
 
+      /**
+       * @brief Gets the table of geometric factors of the polytopes of the
+       * given dimension.
+       * @param[in] dimension Polytope dimension
+       * @returns Pointer to the table, or `nullptr` if the geometric factors
+       * of the given dimension have not been computed at the current
+       * revision of the mesh.
+       *
+       * @see getRevision()
+       */
+      virtual const GeometricFactors* getGeometricFactors(size_t dimension) const = 0;
+
       /**
        * Gets the geometry type of the @f$ (d, i) @f$-polytope.
        * @param[in] d Polytope dimension
@@ -490,6 +566,37 @@ namespace Rodin::Geometry
           const std::pair<size_t, Index> p, PolytopeTransformation* trans) = 0;
 
       virtual const Context::Base& getContext() const = 0;
+
+      /**
+       * @brief Gets the revision of the mesh.
+       *
+       * The revision changes every time the vertices, the polytopes or the
+       * polytope transformations of the mesh are modified, and no two
+       * meshes of the program share a revision. Data computed from the
+       * geometry of a mesh may hence be reused as long as the revision of
+       * the mesh is the one at which the data was computed.
+       */
+      size_t getRevision() const
+      {
+        return m_revision;
+      }
+
+    protected:
+      /**
+       * @brief Gives a new revision to the mesh.
+       *
+       * Must be called by the methods which modify the geometry of the
+       * mesh.
+       */
+      void updateRevision()
+      {
+        m_revision = getNextRevision();
+      }
+
+    private:
+      static size_t getNextRevision();
+
+      size_t m_revision;
   };
 
   /// Type alias for Mesh<Context::Local>
@@ -505,6 +612,9 @@ namespace Rodin::Geometry
   using TransformationIndex =
     std::vector<Threads::Mutable<std::vector<PolytopeTransformation*>>>;
 
+  /// Partition of the polytopes of a given dimension into colors.
+  using PolytopeColoring = std::vector<std::vector<Index>>;
+
   /**
    *
    * @ingroup MeshTypes
@@ -776,16 +886,101 @@ namespace Rodin::Geometry
               Polytope::getVertices(Polytope::Type::Point).col(0), it->getCoordinates());
           m_vertices.col(it->getIndex()) += u(p);
         }
+        m_geometricFactors.clear();
+        updateRevision();
         return *this;
       }
 
+      /**
+       * @brief Computes a reverse Cuthill-McKee ordering of the vertices.
+       * @returns Permutation @f$ p @f$ such that @f$ p(i) @f$ is the new
+       * index of the @f$ i @f$-th vertex.
+       *
+       * The vertices are numbered by a breadth-first traversal of the graph
+       * of the vertices sharing a cell, starting from a pseudo-peripheral
+       * vertex of each connected component and visiting the neighbors by
+       * increasing degree, and the numbering is then reversed. This reduces
+       * the bandwidth and the profile of the P1 operators.
+       *
+       * @see reorder()
+       */
+      std::vector<Index> getReverseCuthillMcKeeOrdering() const;
+
+      /**
+       * @brief Renumbers the vertices with the reverse Cuthill-McKee
+       * ordering.
+       *
+       * Convenience function to call reorder(const std::vector<Index>&) with
+       * getReverseCuthillMcKeeOrdering().
+       *
+       * @returns Reference to this (for method chaining)
+       */
+      Mesh& reorder()
+      {
+        return reorder(getReverseCuthillMcKeeOrdering());
+      }
+
+      /**
+       * @brief Renumbers the vertices and the polytopes of the mesh.
+       * @param[in] permutation Permutation @f$ p @f$ such that @f$ p(i) @f$
+       * is the new index of the @f$ i @f$-th vertex
+       *
+       * The polytopes of each dimension @f$ d \geq 1 @f$ are renumbered in
+       * the lexicographic order of their sorted new vertex indices, hence
+       * the cells follow the ordering of the vertices. The vertices of each
+       * polytope keep their local order, so that the orientations are
+       * preserved.
+       *
+       * The attributes are kept, and the incidences which were computed
+       * are computed again. The geometric factors, the colorings and the
+       * polytope transformations are discarded.
+       *
+       * @note The mesh must not be a SubMesh, since its ancestry would no
+       * longer be valid.
+       *
+       * @returns Reference to this (for method chaining)
+       */
+      Mesh& reorder(const std::vector<Index>& permutation);
 
       virtual void flush() override
       {
         for (auto& mt : m_transformationIndex)
-          mt.write([](auto& obj) { obj.clear(); });
+        {
+          mt.write(
+              [](auto& obj)
+              {
+                for (PolytopeTransformation* ptr : obj)
+                  delete ptr;
+                obj.clear();
+              });
+        }
+        m_geometricFactors.clear();
+        updateRevision();
       }
 
+      /**
+       * @brief Computes the geometric factors of the polytopes of the given
+       * dimension.
+       * @param[in] dimension Polytope dimension
+       *
+       * For each simplex of dimension @f$ d @f$, the Jacobian of its
+       * transformation, its inverse, its determinant and the distortion are
+       * constant and are computed once and stored in the mesh. Points on
+       * these polytopes then read their factors from the table instead of
+       * evaluating them at each quadrature point. This is typically called
+       * for the cells and the faces of the mesh, before assembly.
+       *
+       * The table is keyed on the revision of the mesh. It is discarded by
+       * any modification of the vertex coordinates, as well as by
+       * setPolytopeTransformation(), and must then be computed again. It is
+       * kept when the mesh is moved but not when it is copied.
+       *
+       * @returns Reference to this (for method chaining)
+       *
+       * @see getGeometricFactors(size_t) const
+       */
+      Mesh& computeGeometricFactors(size_t dimension);
+
       /**
       * @brief Skins the mesh to obtain its boundary mesh
       * @returns SubMesh object to the boundary region of the mesh
@@ -891,6 +1086,10 @@ namespace Rodin::Geometry
 
       /**
       * @brief Saves a mesh to file in the given format.
+      *
+      * MEDIT meshes are written in the binary encoding when the file has
+      * the .meshb extension.
+      *
       * @param[in] filename Name of file to write
       * @param[in] fmt Mesh file format
       * @returns Reference to this (for method chaining)
@@ -899,6 +1098,25 @@ namespace Rodin::Geometry
         const boost::filesystem::path& filename,
         IO::FileFormat fmt = IO::FileFormat::MFEM, size_t precison = 16) const override;
 
+      /**
+      * @brief Saves a mesh to file in the given format without blocking.
+      *
+      * The mesh is copied, and the copy is saved on a dedicated I/O
+      * thread. Saves are written in order. The call blocks while too many
+      * saves are pending.
+      *
+      * @param[in] filename Name of file to write
+      * @param[in] fmt Mesh file format
+      * @param[in] precision Number of significant digits of the vertex
+      * coordinates
+      * @returns Future which is ready once the file is written, and which
+      * holds the exception raised while saving, if any.
+      * @see save()
+      */
+      std::future<void> saveAsync(
+        const boost::filesystem::path& filename,
+        IO::FileFormat fmt = IO::FileFormat::MFEM, size_t precision = 16) const;
+
       virtual Mesh& scale(Real c) override;
 
       const AttributeIndex& getAttributeIndex() const
@@ -916,6 +1134,18 @@ namespace Rodin::Geometry
         return m_vertices;
       }
 
+      /**
+       * @brief Gets a coloring of the polytopes of the given dimension.
+       * @param[in] d Dimension of the polytopes
+       *
+       * The polytopes of dimension @f$ d @f$ are partitioned into colors such
+       * that no two polytopes of the same color share a vertex. The coloring
+       * is computed greedily from the @f$ d \longrightarrow 0 @f$ incidence
+       * on the first call and is cached in the mesh until its revision
+       * changes.
+       */
+      const PolytopeColoring& getColoring(size_t d) const;
+
       const Context& getContext() const override
       {
         return m_context;
@@ -980,10 +1210,20 @@ namespace Rodin::Geometry
       virtual const PolytopeTransformation& getPolytopeTransformation(
           size_t dimension, Index idx) const override;
 
+      virtual const GeometricFactors* getGeometricFactors(size_t dimension) const override;
+
     protected:
       PolytopeTransformation* getDefaultPolytopeTransformation(size_t d, Index i) const;
 
     private:
+      /// Coloring of the polytopes of a dimension, with the revision of the
+      /// mesh at which it was computed
+      struct ColoringCache
+      {
+        std::optional<size_t> revision;
+        PolytopeColoring coloring;
+      };
+
       size_t m_sdim;
 
       Math::PointMatrix m_vertices;
@@ -992,8 +1232,12 @@ namespace Rodin::Geometry
       AttributeIndex m_attributeIndex;
       mutable TransformationIndex m_transformationIndex;
 
+      std::vector<std::optional<GeometricFactors>> m_geometricFactors;
+
       std::vector<FlatSet<Attribute>> m_attributes;
 
+      mutable Threads::Mutable<std::vector<ColoringCache>> m_coloring;
+
       Context m_context;
   };
 }
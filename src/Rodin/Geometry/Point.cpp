@@ -7,6 +7,7 @@
 #include "Mesh.h"
 #include "Polytope.h"
 #include "PolytopeTransformation.h"
+#include "GeometricFactors.h"
 
 #include "Point.h"
 
@@ -72,6 +73,17 @@ namespace Rodin::Geometry
       m_distortion(std::move(other.m_distortion))
   {}
 
+  const GeometricFactors* PointBase::getGeometricFactors() const
+  {
+    const auto& polytope = getPolytope();
+    const GeometricFactors* factors =
+      polytope.getMesh().getGeometricFactors(polytope.getDimension());
+    if (factors && factors->isAffine(polytope.getIndex()))
+      return factors;
+    else
+      return nullptr;
+  }
+
   const Polytope& PointBase::getPolytope() const
   {
     if (m_polytopeStorage == PolytopeStorage::Value)
@@ -116,10 +128,14 @@ namespace Rodin::Geometry
   {
     if (!m_jacobian.read().has_value())
     {
+      const GeometricFactors* factors = getGeometricFactors();
       m_jacobian.write(
           [&](auto& obj)
           {
-            obj.emplace(m_trans.get().jacobian(getReferenceCoordinates()));
+            if (factors)
+              obj.emplace(factors->getJacobian(getPolytope().getIndex()));
+            else
+              obj.emplace(m_trans.get().jacobian(getReferenceCoordinates()));
           });
     }
     assert(m_jacobian.read().has_value());
@@ -131,6 +147,16 @@ namespace Rodin::Geometry
     if (!m_jacobianInverse.read().has_value())
     {
       const auto& polytope = getPolytope();
+      if (const GeometricFactors* factors = getGeometricFactors())
+      {
+        m_jacobianInverse.write(
+            [&](auto& obj)
+            {
+              obj.emplace(factors->getJacobianInverse(polytope.getIndex()));
+            });
+        assert(m_jacobianInverse.read().has_value());
+        return m_jacobianInverse.read().value();
+      }
       const size_t rdim = Polytope::getGeometryDimension(polytope.getGeometry());
       const size_t sdim = polytope.getMesh().getSpaceDimension();
       assert(rdim <= sdim);
@@ -263,6 +289,16 @@ namespace Rodin::Geometry
   {
     if (!m_jacobianDeterminant.read().has_value())
     {
+      if (const GeometricFactors* factors = getGeometricFactors())
+      {
+        m_jacobianDeterminant.write(
+            [&](auto& obj)
+            {
+              obj.emplace(factors->getJacobianDeterminant(getPolytope().getIndex()));
+            });
+        assert(m_jacobianDeterminant.read().has_value());
+        return m_jacobianDeterminant.read().value();
+      }
       const auto& jac = getJacobian();
       const auto rows = jac.rows();
       const auto cols = jac.cols();
@@ -347,6 +383,16 @@ namespace Rodin::Geometry
   {
     if (!m_distortion.read().has_value())
     {
+      if (const GeometricFactors* factors = getGeometricFactors())
+      {
+        m_distortion.write(
+            [&](auto& obj)
+            {
+              obj.emplace(factors->getDistortion(getPolytope().getIndex()));
+            });
+        assert(m_distortion.read().has_value());
+        return m_distortion.read().value();
+      }
       const auto& jac = getJacobian();
       const auto rows = jac.rows();
       const auto cols = jac.cols();
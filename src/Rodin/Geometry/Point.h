@@ -205,6 +205,19 @@ namespace Rodin::Geometry
       virtual const Math::SpatialVector<Real>& getReferenceCoordinates() const = 0;
 
     private:
+      /**
+       * @brief Looks up the geometric factors of the polytope in the mesh.
+       * @returns Pointer to the table of the mesh if it holds the factors of
+       * the polytope, `nullptr` otherwise.
+       *
+       * If the mesh holds the geometric factors of the polytope, the
+       * Jacobian, its inverse, its determinant and the distortion are read
+       * from the table instead of being evaluated at the point. The table is
+       * looked up each time one of these quantities is first accessed, so
+       * that the point never refers to a table discarded by the mesh.
+       */
+      const GeometricFactors* getGeometricFactors() const;
+
       PolytopeStorage m_polytopeStorage;
       std::variant<const Polytope, std::reference_wrapper<const Polytope>> m_polytope;
       std::reference_wrapper<const PolytopeTransformation> m_trans;
@@ -36,12 +36,12 @@ namespace Rodin::Geometry
     return *this;
   }
 
-  Polytope* PolytopeIterator::generate() const
+  Polytope PolytopeIterator::generate() const
   {
-    if (this->end()) return nullptr;
+    assert(!this->end());
     const auto& gen = getIndexGenerator();
     const auto& index = *gen;
-    return new Polytope(getDimension(), index, getMesh());
+    return Polytope(getDimension(), index, getMesh());
   }
 
   // ---- CellIterator -------------------------------------------------------
@@ -49,12 +49,12 @@ namespace Rodin::Geometry
     : Parent(mesh.getDimension(), mesh, std::move(gen))
   {}
 
-  Cell* CellIterator::generate() const
+  Cell CellIterator::generate() const
   {
-    if (this->end()) return nullptr;
+    assert(!this->end());
     const auto& gen = getIndexGenerator();
     const auto& index = *gen;
-    return new Cell(index, getMesh());
+    return Cell(index, getMesh());
   }
 
   // ---- FaceIterator -------------------------------------------------------
@@ -62,12 +62,12 @@ namespace Rodin::Geometry
     : Parent(mesh.getDimension() - 1, mesh, std::move(gen))
   {}
 
-  Face* FaceIterator::generate() const
+  Face FaceIterator::generate() const
   {
-    if (this->end()) return nullptr;
+    assert(!this->end());
     const auto& gen = getIndexGenerator();
     const auto& index = *gen;
-    return new Face(index, getMesh());
+    return Face(index, getMesh());
   }
 
   // ---- VertexIterator -----------------------------------------------------
@@ -75,11 +75,11 @@ namespace Rodin::Geometry
     : Parent(0, mesh, std::move(gen))
   {}
 
-  Vertex* VertexIterator::generate() const
+  Vertex VertexIterator::generate() const
   {
-    if (this->end()) return nullptr;
+    assert(!this->end());
     const auto& gen = getIndexGenerator();
     const auto& index = *gen;
-    return new Vertex(index, getMesh());
+    return Vertex(index, getMesh());
   }
 }
@@ -9,8 +9,8 @@
 
 #include <memory>
 #include <utility>
+#include <optional>
 
-#include "Rodin/Threads/Unsafe.h"
 
 #include "ForwardDecls.h"
 
@@ -31,9 +31,22 @@ namespace Rodin::Geometry
 
       PolytopeIteratorBase(const PolytopeIterator&) = delete;
 
-      PolytopeIteratorBase(PolytopeIteratorBase&&) = default;
+      PolytopeIteratorBase(PolytopeIteratorBase&& other)
+        : m_dimension(other.m_dimension),
+          m_mesh(std::move(other.m_mesh)),
+          m_gen(std::move(other.m_gen)),
+          m_dirty(true)
+      {}
 
-      PolytopeIteratorBase& operator=(PolytopeIteratorBase&&) = default;
+      PolytopeIteratorBase& operator=(PolytopeIteratorBase&& other)
+      {
+        m_dimension = other.m_dimension;
+        m_mesh = std::move(other.m_mesh);
+        m_gen = std::move(other.m_gen);
+        m_dirty = true;
+        m_polytope.reset();
+        return *this;
+      }
 
       inline
       operator bool() const
@@ -56,62 +69,20 @@ namespace Rodin::Geometry
       }
 
       inline
-      const T& operator*() const noexcept
+      const T& operator*() const
       {
-        if (!m_polytope.read() || m_dirty.read())
+        if (!m_polytope || m_dirty)
         {
-          T* polytope = generate();
-          m_polytope.write(
-              [&](auto& obj)
-              {
-                obj.reset(polytope);
-              });
+          m_polytope.emplace(generate());
+          m_dirty = false;
         }
-        m_dirty.write(
-            [](auto& obj)
-            {
-              obj = false;
-            });
-        return *(m_polytope.read());
+        return *m_polytope;
       }
 
       inline
-      const T* operator->() const noexcept
+      const T* operator->() const
       {
-        if (!m_polytope.read() || m_dirty.read())
-        {
-          T* polytope = generate();
-          m_polytope.write(
-              [&](auto& obj)
-              {
-                obj.reset(polytope);
-              });
-        }
-        m_dirty.write(
-            [](auto& obj)
-            {
-              obj = false;
-            });
-        return m_polytope.read().get();
-      }
-
-      inline
-      T* release()
-      {
-        if (!m_polytope.read() || m_dirty.read())
-        {
-          return generate();
-        }
-        else
-        {
-          T* polytope = nullptr;
-          m_polytope.write(
-              [&](auto& obj)
-              {
-                polytope = obj.release();
-              });
-          return polytope;
-        }
+        return &operator*();
       }
 
       inline
@@ -142,14 +113,14 @@ namespace Rodin::Geometry
         return *m_gen;
       }
 
-      virtual T* generate() const = 0;
+      virtual T generate() const = 0;
 
     private:
       size_t m_dimension;
       std::optional<std::reference_wrapper<const MeshBase>> m_mesh;
       std::unique_ptr<IndexGeneratorBase> m_gen;
-      mutable Threads::Unsafe<bool> m_dirty;
-      mutable Threads::Unsafe<std::unique_ptr<T>> m_polytope;
+      mutable bool m_dirty = true;
+      mutable std::optional<T> m_polytope;
   };
 
   /**
@@ -185,7 +156,7 @@ namespace Rodin::Geometry
 
       PolytopeIterator& operator=(VertexIterator it);
 
-      Polytope* generate() const override;
+      Polytope generate() const override;
   };
 
   /**
@@ -209,7 +180,7 @@ namespace Rodin::Geometry
 
       CellIterator& operator=(CellIterator&&) = default;
 
-      Cell* generate() const override;
+      Cell generate() const override;
   };
 
   /**
@@ -233,7 +204,7 @@ namespace Rodin::Geometry
 
       FaceIterator& operator=(FaceIterator&&) = default;
 
-      Face* generate() const override;
+      Face generate() const override;
   };
 
   /**
@@ -257,7 +228,7 @@ namespace Rodin::Geometry
 
       VertexIterator& operator=(VertexIterator&&) = default;
 
-      Vertex* generate() const override;
+      Vertex generate() const override;
   };
 }
 
@@ -0,0 +1,155 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_GEOMETRY_POLYTOPERANGE_H
+#define RODIN_GEOMETRY_POLYTOPERANGE_H
+
+#include <iterator>
+#include <type_traits>
+
+#include "ForwardDecls.h"
+#include "Polytope.h"
+
+namespace Rodin::Geometry
+{
+  /**
+   * @brief Represents a contiguous range of polytopes of a mesh.
+   *
+   * Dereferencing an iterator of the range yields a polytope by value, so
+   * that iterating over the range does not allocate.
+   *
+   * # Utilization
+   *
+   * @code{cpp}
+   * for (auto cell : mesh.cells())
+   *   std::cout << cell.getIndex() << " " << cell.getAttribute() << std::endl;
+   * @endcode
+   *
+   * @tparam T Polytope, Cell, Face or Vertex.
+   */
+  template <class T>
+  class PolytopeRange
+  {
+    static_assert(std::is_base_of_v<Polytope, T>);
+
+    public:
+      class Iterator
+      {
+        public:
+          using iterator_category = std::forward_iterator_tag;
+
+          using value_type = T;
+
+          using difference_type = std::ptrdiff_t;
+
+          using pointer = void;
+
+          using reference = T;
+
+          Iterator() = default;
+
+          Iterator(size_t dimension, const MeshBase& mesh, Index index)
+            : m_dimension(dimension), m_mesh(&mesh), m_index(index)
+          {}
+
+          Iterator(const Iterator&) = default;
+
+          Iterator& operator=(const Iterator&) = default;
+
+          T operator*() const
+          {
+            assert(m_mesh);
+            if constexpr (std::is_same_v<T, Polytope>)
+              return Polytope(m_dimension, m_index, *m_mesh);
+            else
+              return T(m_index, *m_mesh);
+          }
+
+          Iterator& operator++()
+          {
+            ++m_index;
+            return *this;
+          }
+
+          Iterator operator++(int)
+          {
+            Iterator res = *this;
+            ++m_index;
+            return res;
+          }
+
+          bool operator==(const Iterator& other) const
+          {
+            return m_index == other.m_index;
+          }
+
+          bool operator!=(const Iterator& other) const
+          {
+            return m_index != other.m_index;
+          }
+
+          Index getIndex() const
+          {
+            return m_index;
+          }
+
+        private:
+          size_t m_dimension = 0;
+          const MeshBase* m_mesh = nullptr;
+          Index m_index = 0;
+      };
+
+      /**
+       * @brief Constructs the range of polytopes of dimension @p dimension
+       * with indices in @f$ [first, last) @f$.
+       */
+      PolytopeRange(size_t dimension, const MeshBase& mesh, Index first, Index last)
+        : m_dimension(dimension), m_mesh(mesh), m_first(first), m_last(last)
+      {
+        assert(first <= last);
+      }
+
+      PolytopeRange(const PolytopeRange&) = default;
+
+      Iterator begin() const
+      {
+        return Iterator(m_dimension, m_mesh.get(), m_first);
+      }
+
+      Iterator end() const
+      {
+        return Iterator(m_dimension, m_mesh.get(), m_last);
+      }
+
+      size_t size() const
+      {
+        return m_last - m_first;
+      }
+
+      bool empty() const
+      {
+        return m_first == m_last;
+      }
+
+      size_t getDimension() const
+      {
+        return m_dimension;
+      }
+
+      const MeshBase& getMesh() const
+      {
+        return m_mesh.get();
+      }
+
+    private:
+      size_t m_dimension;
+      std::reference_wrapper<const MeshBase> m_mesh;
+      Index m_first;
+      Index m_last;
+  };
+}
+
+#endif
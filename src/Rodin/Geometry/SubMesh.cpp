@@ -73,9 +73,8 @@ namespace Rodin::Geometry
       }
       i = find->get_left();
     }
-    std::unique_ptr<Polytope> childPolytope(getPolytope(d, i).release());
     return Point(
-        std::move(*childPolytope),
+        Polytope(d, i, *this),
         getPolytopeTransformation(d, i),
         std::cref(p.getReferenceCoordinates()), p.getPhysicalCoordinates());
   }
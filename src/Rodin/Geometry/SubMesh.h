@@ -105,6 +105,8 @@ namespace Rodin::Geometry
 
           Builder& include(size_t d, const IndexSet& indices);
 
+          Builder& include(size_t d, const Incidence::Range& indices);
+
           SubMesh finalize();
 
         private:
@@ -71,6 +71,14 @@ namespace Rodin::Geometry
     return *this;
   }
 
+  SubMesh<Context::Local>::Builder&
+  SubMesh<Context::Local>::Builder::include(size_t d, const Incidence::Range& indices)
+  {
+    for (const Index parentIdx : indices)
+      include(d, parentIdx);
+    return *this;
+  }
+
   SubMesh<Context::Local> SubMesh<Context::Local>::Builder::finalize()
   {
     assert(m_parent.has_value());
@@ -91,18 +99,22 @@ namespace Rodin::Geometry
         const auto& pInc = parent.getConnectivity().getIncidence(d, dp);
         if (pInc.size() > 0)
         {
-          Incidence cInc(m_s2ps[d].size());
+          Incidence cInc;
+          cInc.reserve(m_s2ps[d].size());
+          std::vector<Index> row;
+          // The child indices are contiguous and visited in increasing order
           for (auto it = m_s2ps[d].left.begin(); it != m_s2ps[d].left.end(); ++it)
           {
-            const Index cIdx = it->get_left();
+            assert(it->get_left() == cInc.size());
             const Index pIdx = it->get_right();
-            cInc[cIdx].reserve(pInc[pIdx].size());
+            row.clear();
             for (const Index p : pInc[pIdx])
             {
               auto find = m_s2ps[dp].right.find(p);
               if (find != m_s2ps[dp].right.end())
-                cInc[cIdx].insert_unique(find->get_left());
+                row.push_back(find->get_left());
             }
+            cInc.push_back(row.begin(), row.end());
           }
           // Manually set the incidence
           conn.setIncidence({ d, dp }, std::move(cInc));
@@ -7,14 +7,12 @@
 #include "Rodin/Types.h"
 
 #include "ForwardDecls.h"
+#include "Incidence.h"
 
 namespace Rodin::Geometry
 {
   /// Standard type for representing material attributes in a mesh.
   using Attribute = std::size_t;
-
-  /// Represents the incidence of a polytope.
-  using Incidence = std::vector<IndexSet>;
 }
 
 #endif
@@ -0,0 +1,250 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <unordered_map>
+
+#include "Rodin/Alert/MemberFunctionException.h"
+
+#include "UniformRefinement.h"
+
+namespace Rodin::Geometry
+{
+  UniformRefinement::MeshType UniformRefinement::refine()
+  {
+    const auto& mesh = getMesh();
+    const auto& conn = mesh.getConnectivity();
+    const size_t D = mesh.getDimension();
+    const size_t sdim = mesh.getSpaceDimension();
+    const size_t nv = mesh.getVertexCount();
+    const size_t nc = mesh.getCellCount();
+    const size_t nf = D > 1 ? mesh.getFaceCount() : 0;
+
+    // Midpoints of the edges
+    m_vertices.resize(nv);
+    for (Index i = 0; i < nv; i++)
+      m_vertices[i] = { i, i };
+    std::unordered_map<Index, Index> midpoints;
+    midpoints.reserve(3 * nv);
+    const auto midpoint =
+      [&](Index a, Index b) -> Index
+      {
+        if (a > b)
+          std::swap(a, b);
+        const auto [it, inserted] = midpoints.try_emplace(a * nv + b, m_vertices.size());
+        if (inserted)
+          m_vertices.emplace_back(a, b);
+        return it->second;
+      };
+
+    const auto check =
+      [&](Polytope::Type g)
+      {
+        if (g != Polytope::Type::Segment && g != Polytope::Type::Triangle && g != Polytope::Type::Tetrahedron)
+        {
+          Alert::MemberFunctionException(*this, __func__)
+            << "Uniform refinement is only supported for simplicial meshes."
+            << Alert::Raise;
+        }
+      };
+
+    for (size_t d : { D, D - 1 })
+    {
+      if (d == 0 || (d == D - 1 && nf == 0))
+        continue;
+      for (Index i = 0; i < mesh.getPolytopeCount(d); i++)
+      {
+        check(mesh.getGeometry(d, i));
+        const auto& vs = conn.getPolytope(d, i);
+        for (int p = 0; p < vs.size(); p++)
+        {
+          for (int q = p + 1; q < vs.size(); q++)
+            midpoint(vs(p), vs(q));
+        }
+      }
+    }
+
+    MeshType::Builder build;
+    build.initialize(sdim).nodes(m_vertices.size());
+    for (const auto& [a, b] : m_vertices)
+    {
+      if (a == b)
+        build.vertex(Math::Vector<Real>(mesh.getVertexCoordinates(a)));
+      else
+        build.vertex(Math::Vector<Real>(0.5 * (mesh.getVertexCoordinates(a) + mesh.getVertexCoordinates(b))));
+    }
+
+    // Children of a polytope, given the midpoint of each of its edges
+    const auto children =
+      [&](size_t d, Index i, const auto& add)
+      {
+        const auto& vs = conn.getPolytope(d, i);
+        switch (mesh.getGeometry(d, i))
+        {
+          case Polytope::Type::Segment:
+          {
+            const Index m = midpoint(vs(0), vs(1));
+            add(Polytope::Type::Segment, { vs(0), m });
+            add(Polytope::Type::Segment, { m, vs(1) });
+            break;
+          }
+          case Polytope::Type::Triangle:
+          {
+            const Index m01 = midpoint(vs(0), vs(1));
+            const Index m12 = midpoint(vs(1), vs(2));
+            const Index m02 = midpoint(vs(0), vs(2));
+            add(Polytope::Type::Triangle, { vs(0), m01, m02 });
+            add(Polytope::Type::Triangle, { m01, vs(1), m12 });
+            add(Polytope::Type::Triangle, { m02, m12, vs(2) });
+            add(Polytope::Type::Triangle, { m01, m12, m02 });
+            break;
+          }
+          case Polytope::Type::Tetrahedron:
+          {
+            const Index m01 = midpoint(vs(0), vs(1));
+            const Index m02 = midpoint(vs(0), vs(2));
+            const Index m03 = midpoint(vs(0), vs(3));
+            const Index m12 = midpoint(vs(1), vs(2));
+            const Index m13 = midpoint(vs(1), vs(3));
+            const Index m23 = midpoint(vs(2), vs(3));
+            add(Polytope::Type::Tetrahedron, { vs(0), m01, m02, m03 });
+            add(Polytope::Type::Tetrahedron, { m01, vs(1), m12, m13 });
+            add(Polytope::Type::Tetrahedron, { m02, m12, vs(2), m23 });
+            add(Polytope::Type::Tetrahedron, { m03, m13, m23, vs(3) });
+
+            // Split the octahedron along its shortest diagonal. The four
+            // children are the tetrahedra joining the diagonal to the edges
+            // of the cycle of the remaining vertices.
+            const auto x = [&](Index v) { return mesh.getVertexCoordinates(vs(v)); };
+            const Real l0 = (x(0) + x(2) - x(1) - x(3)).squaredNorm();
+            const Real l1 = (x(0) + x(1) - x(2) - x(3)).squaredNorm();
+            const Real l2 = (x(0) + x(3) - x(1) - x(2)).squaredNorm();
+            std::array<Index, 2> diagonal;
+            std::array<Index, 4> cycle;
+            if (l0 <= l1 && l0 <= l2)
+            {
+              diagonal = { m02, m13 };
+              cycle = { m01, m03, m23, m12 };
+            }
+            else if (l1 <= l2)
+            {
+              diagonal = { m01, m23 };
+              cycle = { m02, m03, m13, m12 };
+            }
+            else
+            {
+              diagonal = { m03, m12 };
+              cycle = { m01, m02, m23, m13 };
+            }
+            // Orient the children as the parent
+            const auto y =
+              [&](Index v) -> Math::SpatialVector<Real>
+              {
+                const auto& [a, b] = m_vertices[v];
+                return 0.5 * (mesh.getVertexCoordinates(a) + mesh.getVertexCoordinates(b));
+              };
+            const auto orientation =
+              [](const auto& p0, const auto& p1, const auto& p2, const auto& p3)
+              {
+                Eigen::Matrix<Real, 3, 3> jacobian;
+                jacobian << p1 - p0, p2 - p0, p3 - p0;
+                return jacobian.determinant();
+              };
+            if (orientation(y(diagonal[0]), y(diagonal[1]), y(cycle[0]), y(cycle[1]))
+                * orientation(x(0), x(1), x(2), x(3)) < 0)
+            {
+              std::swap(cycle[1], cycle[3]);
+            }
+            for (size_t k = 0; k < 4; k++)
+            {
+              add(Polytope::Type::Tetrahedron,
+                  { diagonal[0], diagonal[1], cycle[k], cycle[(k + 1) % 4] });
+            }
+            break;
+          }
+          default:
+          {
+            assert(false);
+            break;
+          }
+        }
+      };
+
+    m_parents.clear();
+    m_children.assign(1, 0);
+    m_parents.reserve((1 << D) * nc);
+    m_children.reserve(nc + 1);
+    build.reserve(D, (1 << D) * nc);
+    for (Index i = 0; i < nc; i++)
+    {
+      children(D, i,
+          [&](Polytope::Type g, std::initializer_list<Index> child)
+          {
+            build.polytope(g, IndexArray{{ child }});
+            m_parents.push_back(i);
+          });
+      m_children.push_back(m_parents.size());
+    }
+
+    std::vector<Index> faces;
+    if (nf > 0)
+    {
+      faces.reserve((1 << (D - 1)) * nf);
+      build.reserve(D - 1, (1 << (D - 1)) * nf);
+      for (Index i = 0; i < nf; i++)
+      {
+        children(D - 1, i,
+            [&](Polytope::Type g, std::initializer_list<Index> child)
+            {
+              build.polytope(g, IndexArray{{ child }});
+              faces.push_back(i);
+            });
+      }
+    }
+
+    MeshType res = build.finalize();
+    for (Index i = 0; i < m_parents.size(); i++)
+    {
+      const Attribute attr = mesh.getAttribute(D, m_parents[i]);
+      if (attr != RODIN_DEFAULT_POLYTOPE_ATTRIBUTE)
+        res.setAttribute({ D, i }, attr);
+    }
+    for (Index i = 0; i < faces.size(); i++)
+    {
+      const Attribute attr = mesh.getAttribute(D - 1, faces[i]);
+      if (attr != RODIN_DEFAULT_POLYTOPE_ATTRIBUTE)
+        res.setAttribute({ D - 1, i }, attr);
+    }
+    return res;
+  }
+
+  Math::SparseMatrix<Real> UniformRefinement::getP1Prolongation(size_t vdim) const
+  {
+    assert(vdim > 0);
+    const size_t nc = getMesh().getVertexCount();
+    const size_t nf = m_vertices.size();
+    std::vector<Eigen::Triplet<Real>> triplets;
+    triplets.reserve(2 * nf * vdim);
+    for (size_t c = 0; c < vdim; c++)
+    {
+      for (Index i = 0; i < nf; i++)
+      {
+        const auto& [a, b] = m_vertices[i];
+        if (a == b)
+        {
+          triplets.emplace_back(i + c * nf, a + c * nc, 1.0);
+        }
+        else
+        {
+          triplets.emplace_back(i + c * nf, a + c * nc, 0.5);
+          triplets.emplace_back(i + c * nf, b + c * nc, 0.5);
+        }
+      }
+    }
+    Math::SparseMatrix<Real> res(nf * vdim, nc * vdim);
+    res.setFromTriplets(triplets.begin(), triplets.end());
+    return res;
+  }
+}
@@ -0,0 +1,130 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_GEOMETRY_UNIFORMREFINEMENT_H
+#define RODIN_GEOMETRY_UNIFORMREFINEMENT_H
+
+#include <vector>
+#include <utility>
+#include <functional>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/SparseMatrix.h"
+
+#include "Mesh.h"
+#include "ForwardDecls.h"
+
+namespace Rodin::Geometry
+{
+  /**
+   * @brief Red uniform refinement of a simplicial mesh.
+   *
+   * Each edge is split at its midpoint, and each cell is split in @f$ 2^d
+   * @f$ children: segments in 2 segments, triangles in 4 triangles and
+   * tetrahedra in 8 tetrahedra. The interior octahedron of a tetrahedron is
+   * split along its shortest diagonal. The faces present in the coarse mesh
+   * are refined in the same way. The children inherit the attribute of their
+   * parent.
+   *
+   * The vertices of the coarse mesh keep their indices in the refined mesh,
+   * and the children of each coarse cell are numbered consecutively.
+   *
+   * @code{.cpp}
+   * UniformRefinement refinement(coarse);
+   * Mesh fine = refinement.refine();
+   * @endcode
+   */
+  class UniformRefinement
+  {
+    public:
+      using MeshType = Mesh<Context::Local>;
+
+      /**
+       * @brief Constructs the refinement of @p mesh, which must outlive the
+       * object.
+       */
+      UniformRefinement(const MeshType& mesh)
+        : m_mesh(mesh)
+      {}
+
+      UniformRefinement(const UniformRefinement&) = default;
+
+      UniformRefinement(UniformRefinement&&) = default;
+
+      /**
+       * @brief Gets the coarse mesh.
+       */
+      const MeshType& getMesh() const
+      {
+        return m_mesh.get();
+      }
+
+      /**
+       * @brief Computes the refined mesh and the parent/child maps.
+       */
+      MeshType refine();
+
+      /**
+       * @brief Gets the coarse cell containing the @p i-th cell of the
+       * refined mesh.
+       */
+      Index getParent(Index i) const
+      {
+        assert(i < m_parents.size());
+        return m_parents[i];
+      }
+
+      /**
+       * @brief Gets the range @f$ [begin, end) @f$ of the indices of the
+       * children of the @p i-th cell of the coarse mesh.
+       */
+      std::pair<Index, Index> getChildren(Index i) const
+      {
+        assert(i + 1 < m_children.size());
+        return { m_children[i], m_children[i + 1] };
+      }
+
+      /**
+       * @brief Gets the two coarse vertices whose midpoint is the @p i-th
+       * vertex of the refined mesh.
+       *
+       * For a vertex of the coarse mesh, both indices are equal to @p i.
+       */
+      const std::pair<Index, Index>& getVertexParents(Index i) const
+      {
+        assert(i < m_vertices.size());
+        return m_vertices[i];
+      }
+
+      /**
+       * @brief Gets the matrix which interpolates the P1 functions of the
+       * coarse mesh on the refined mesh.
+       * @param[in] vdim Vector dimension of the P1 space
+       *
+       * The degrees of freedom are ordered as in Variational::P1, i.e. the
+       * @f$ c @f$-th component of the @f$ i @f$-th vertex is the degree of
+       * freedom @f$ i + c N @f$, where @f$ N @f$ is the vertex count.
+       */
+      Math::SparseMatrix<Real> getP1Prolongation(size_t vdim = 1) const;
+
+      /**
+       * @brief Gets the transpose of the P1 prolongation, which maps the
+       * residuals of the refined mesh to the coarse mesh.
+       */
+      Math::SparseMatrix<Real> getP1Restriction(size_t vdim = 1) const
+      {
+        return getP1Prolongation(vdim).transpose();
+      }
+
+    private:
+      std::reference_wrapper<const MeshType> m_mesh;
+      std::vector<Index> m_parents;
+      std::vector<Index> m_children;
+      std::vector<std::pair<Index, Index>> m_vertices;
+  };
+}
+
+#endif
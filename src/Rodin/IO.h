@@ -8,6 +8,7 @@
 #define RODIN_IO_H
 
 #include "IO/ForwardDecls.h"
+#include "IO/Helpers.h"
 #include "IO/Loader.h"
 #include "IO/Printer.h"
 
@@ -30,6 +30,21 @@ namespace Rodin::IO
     MEDIT ///< MEDIT file format
   };
 
+  namespace MEDIT
+  {
+    /**
+     * @brief Encoding of a MEDIT file.
+     *
+     * The binary encoding is the one of the .meshb and .solb files read and
+     * written by MMG.
+     */
+    enum class Encoding
+    {
+      ASCII, ///< Plain text
+      Binary ///< Binary encoding
+    };
+  }
+
   template <FileFormat fmt, class Trait>
   class MeshLoader;
 
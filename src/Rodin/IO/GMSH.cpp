@@ -0,0 +1,553 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <limits>
+#include <cstdint>
+#include <algorithm>
+#include <type_traits>
+#include <boost/algorithm/string.hpp>
+
+#include "Rodin/Alert.h"
+#include "Rodin/Configure.h"
+
+#include "GMSH.h"
+
+namespace Rodin::IO
+{
+  namespace
+  {
+    constexpr Index InvalidNode = std::numeric_limits<Index>::max();
+
+    template <class T>
+    void swapBytes(T& v)
+    {
+      char* p = reinterpret_cast<char*>(&v);
+      std::reverse(p, p + sizeof(T));
+    }
+
+    /**
+     * Reads count values from the stream. In the binary encoding the values
+     * are read with a single call to std::istream::read, and the size_t
+     * fields are data-size bytes wide. The caller checks the state of the
+     * stream.
+     */
+    template <class T>
+    void read(std::istream& is, const GMSH::MeshFormat& fmt, T* out, size_t count)
+    {
+      if (count == 0)
+        return;
+      if (fmt.fileType == GMSH::FileType::ASCII)
+      {
+        for (size_t i = 0; i < count && is; i++)
+          is >> out[i];
+        return;
+      }
+      if constexpr (std::is_same_v<T, size_t>)
+      {
+        if (fmt.dataSize != sizeof(size_t))
+        {
+          assert(fmt.dataSize == sizeof(uint32_t));
+          std::vector<uint32_t> buffer(count);
+          is.read(reinterpret_cast<char*>(buffer.data()), count * sizeof(uint32_t));
+          for (size_t i = 0; i < count; i++)
+          {
+            if (fmt.swap)
+              swapBytes(buffer[i]);
+            out[i] = buffer[i];
+          }
+          return;
+        }
+      }
+      is.read(reinterpret_cast<char*>(out), count * sizeof(T));
+      if (fmt.swap)
+      {
+        for (size_t i = 0; i < count; i++)
+          swapBytes(out[i]);
+      }
+    }
+
+    Geometry::Attribute toAttribute(int tag)
+    {
+      return static_cast<Geometry::Attribute>(tag < 0 ? -tag : tag);
+    }
+  }
+
+  std::optional<Geometry::Polytope::Type> GMSH::getGeometry(int elementType)
+  {
+    switch (elementType)
+    {
+      case 1:
+        return Geometry::Polytope::Type::Segment;
+      case 2:
+        return Geometry::Polytope::Type::Triangle;
+      case 3:
+        return Geometry::Polytope::Type::Quadrilateral;
+      case 4:
+        return Geometry::Polytope::Type::Tetrahedron;
+      case 6:
+        return Geometry::Polytope::Type::TriangularPrism;
+      case 15:
+        return Geometry::Polytope::Type::Point;
+      default:
+        return {};
+    }
+  }
+
+  std::optional<size_t> GMSH::getNodeCount(int elementType)
+  {
+    static constexpr std::array<size_t, 32> s_nodes =
+    {
+      0, 2, 3, 4, 4, 8, 6, 5, 3, 6, 9, 10, 27, 18, 14, 1,
+      8, 20, 15, 13, 9, 10, 12, 15, 15, 21, 4, 5, 6, 20, 35, 56
+    };
+    if (elementType > 0 && static_cast<size_t>(elementType) < s_nodes.size())
+      return s_nodes[elementType];
+    else if (elementType == 92)
+      return 64;
+    else if (elementType == 93)
+      return 125;
+    else
+      return {};
+  }
+
+  void MeshLoader<FileFormat::GMSH, Context::Local>::load(std::istream& is)
+  {
+    m_format = { "", GMSH::FileType::ASCII, sizeof(size_t), false };
+    m_physicalNames.clear();
+    for (auto& entities : m_entities)
+      entities.clear();
+    m_minNodeTag = 0;
+    m_nodeIndex.clear();
+    m_coordinates.clear();
+    m_nodeAttributes.clear();
+    m_elements.clear();
+
+    bool format = false;
+    std::string line;
+    while (std::getline(is, line))
+    {
+      boost::algorithm::trim(line);
+      if (line.empty() || line.rfind("$End", 0) == 0)
+        continue;
+      if (line == "$MeshFormat")
+      {
+        readMeshFormat(is);
+        format = true;
+      }
+      else if (!format)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Expected $MeshFormat section before " << line << "."
+          << Alert::Raise;
+      }
+      else if (line == "$PhysicalNames")
+      {
+        readPhysicalNames(is);
+      }
+      else if (line == "$Entities")
+      {
+        readEntities(is);
+      }
+      else if (line == "$Nodes")
+      {
+        readNodes(is);
+      }
+      else if (line == "$Elements")
+      {
+        readElements(is);
+      }
+      else if (line.front() == '$')
+      {
+        skipSection(is, line.substr(1));
+      }
+      else
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Unexpected line \"" << line << "\" outside of a section."
+          << Alert::Raise;
+      }
+    }
+
+    if (!format)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Missing $MeshFormat section."
+        << Alert::Raise;
+    }
+
+    size_t dimension = 0;
+    for (const auto& [g, elements] : m_elements)
+      dimension = std::max(dimension, Geometry::Polytope::getGeometryDimension(g));
+
+    // Gmsh always stores three coordinates. Drop the trailing ones which
+    // vanish on all the nodes.
+    const size_t vertexCount = m_nodeAttributes.size();
+    size_t sdim = std::max<size_t>(dimension, 1);
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+      for (size_t k = sdim; k < 3; k++)
+      {
+        if (m_coordinates[3 * i + k] != 0)
+          sdim = k + 1;
+      }
+    }
+
+    Math::PointMatrix vertices(sdim, vertexCount);
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+      for (size_t k = 0; k < sdim; k++)
+        vertices(k, i) = m_coordinates[3 * i + k];
+    }
+
+    ObjectType::Builder build;
+    build.initialize(sdim);
+    build.nodes(vertexCount);
+    build.setVertices(std::move(vertices));
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+      if (m_nodeAttributes[i] != RODIN_DEFAULT_POLYTOPE_ATTRIBUTE)
+        build.attribute({ 0, i }, m_nodeAttributes[i]);
+    }
+
+    std::array<size_t, 4> offsets = { 0, 0, 0, 0 };
+    for (auto& [g, elements] : m_elements)
+    {
+      const size_t d = Geometry::Polytope::getGeometryDimension(g);
+      const size_t n = Geometry::Polytope::getVertexCount(g);
+      const size_t count = elements.attributes.size();
+      build.reserve(d, offsets[d] + count);
+      for (size_t i = 0; i < count; i++)
+      {
+        IndexArray vs(n);
+        std::copy_n(elements.vertices.begin() + i * n, n, vs.begin());
+        if (g == Geometry::Polytope::Type::Quadrilateral)
+          std::swap(vs(2), vs(3));
+        build.polytope(g, std::move(vs));
+        if (elements.attributes[i] != RODIN_DEFAULT_POLYTOPE_ATTRIBUTE)
+          build.attribute({ d, offsets[d] + i }, elements.attributes[i]);
+      }
+      offsets[d] += count;
+    }
+    getObject() = build.finalize();
+
+    m_nodeIndex.clear();
+    m_coordinates.clear();
+    m_nodeAttributes.clear();
+    m_elements.clear();
+  }
+
+  void MeshLoader<FileFormat::GMSH, Context::Local>::readMeshFormat(std::istream& is)
+  {
+    int fileType;
+    size_t dataSize;
+    is >> m_format.version >> fileType >> dataSize;
+    if (!is)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to read the $MeshFormat section."
+        << Alert::Raise;
+    }
+    if (m_format.version != "4.1")
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Unsupported MSH version " << m_format.version
+        << ". Only version 4.1 is supported."
+        << Alert::Raise;
+    }
+    is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+    if (fileType == 0)
+    {
+      m_format.fileType = GMSH::FileType::ASCII;
+      m_format.dataSize = sizeof(size_t);
+      m_format.swap = false;
+    }
+    else if (fileType == 1)
+    {
+      if (dataSize != sizeof(uint32_t) && dataSize != sizeof(uint64_t))
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Unsupported data size " << dataSize << "."
+          << Alert::Raise;
+      }
+      m_format.fileType = GMSH::FileType::Binary;
+      m_format.dataSize = dataSize;
+
+      // The integer 1 written in binary gives the endianness of the file
+      int one = 0;
+      is.read(reinterpret_cast<char*>(&one), sizeof(one));
+      if (one == 1)
+      {
+        m_format.swap = false;
+      }
+      else
+      {
+        swapBytes(one);
+        if (!is || one != 1)
+        {
+          Alert::MemberFunctionException(*this, __func__)
+            << "Failed to determine the endianness of the binary file."
+            << Alert::Raise;
+        }
+        m_format.swap = true;
+      }
+    }
+    else
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Unknown file type " << fileType << "."
+        << Alert::Raise;
+    }
+  }
+
+  void MeshLoader<FileFormat::GMSH, Context::Local>::readPhysicalNames(std::istream& is)
+  {
+    // The $PhysicalNames section is written in ASCII in both encodings
+    size_t count;
+    is >> count;
+    for (size_t i = 0; i < count && is; i++)
+    {
+      size_t d;
+      Geometry::Attribute tag;
+      std::string name;
+      is >> d >> tag;
+      std::getline(is, name);
+      boost::algorithm::trim(name);
+      boost::algorithm::trim_if(name, boost::algorithm::is_any_of("\""));
+      m_physicalNames[{ d, tag }] = std::move(name);
+    }
+    if (!is)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to read the $PhysicalNames section."
+        << Alert::Raise;
+    }
+  }
+
+  void MeshLoader<FileFormat::GMSH, Context::Local>::readEntities(std::istream& is)
+  {
+    std::array<size_t, 4> counts;
+    read(is, m_format, counts.data(), counts.size());
+    std::vector<int> tags;
+    for (size_t d = 0; d < counts.size() && is; d++)
+    {
+      for (size_t i = 0; i < counts[d] && is; i++)
+      {
+        int tag;
+        read(is, m_format, &tag, 1);
+
+        // A point entity has its coordinates, the others their bounding box
+        std::array<Real, 6> box;
+        read(is, m_format, box.data(), d == 0 ? 3 : 6);
+
+        size_t physicalCount;
+        read(is, m_format, &physicalCount, 1);
+        tags.resize(physicalCount);
+        read(is, m_format, tags.data(), physicalCount);
+        if (physicalCount > 0)
+          m_entities[d][tag] = toAttribute(tags.front());
+
+        if (d > 0)
+        {
+          size_t boundingCount;
+          read(is, m_format, &boundingCount, 1);
+          tags.resize(boundingCount);
+          read(is, m_format, tags.data(), boundingCount);
+        }
+      }
+    }
+    if (!is)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to read the $Entities section."
+        << Alert::Raise;
+    }
+  }
+
+  void MeshLoader<FileFormat::GMSH, Context::Local>::readNodes(std::istream& is)
+  {
+    std::array<size_t, 4> header;
+    read(is, m_format, header.data(), header.size());
+    if (!is)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to read the header of the $Nodes section."
+        << Alert::Raise;
+    }
+    const auto [blockCount, nodeCount, minTag, maxTag] = header;
+
+    m_minNodeTag = minTag;
+    m_nodeIndex.assign(nodeCount > 0 ? maxTag - minTag + 1 : 0, InvalidNode);
+    m_coordinates.resize(3 * nodeCount);
+    m_nodeAttributes.assign(nodeCount, RODIN_DEFAULT_POLYTOPE_ATTRIBUTE);
+
+    Index index = 0;
+    std::vector<size_t> tags;
+    std::vector<Real> coordinates;
+    for (size_t b = 0; b < blockCount; b++)
+    {
+      std::array<int, 3> block;
+      size_t count;
+      read(is, m_format, block.data(), block.size());
+      read(is, m_format, &count, 1);
+      const auto [entityDimension, entityTag, parametric] = block;
+
+      // Parametric nodes carry entityDimension parametric coordinates
+      // after x y z, which are discarded.
+      const size_t stride = 3 + (parametric ? entityDimension : 0);
+      tags.resize(count);
+      read(is, m_format, tags.data(), count);
+      coordinates.resize(stride * count);
+      read(is, m_format, coordinates.data(), coordinates.size());
+      if (!is)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Failed to read node block " << b << " of entity ("
+          << entityDimension << ", " << entityTag << ")."
+          << Alert::Raise;
+      }
+      if (index + count > nodeCount)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Node blocks hold more than the " << nodeCount << " declared nodes."
+          << Alert::Raise;
+      }
+      for (size_t i = 0; i < count; i++)
+      {
+        const size_t tag = tags[i];
+        if (tag < minTag || tag > maxTag || m_nodeIndex[tag - minTag] != InvalidNode)
+        {
+          Alert::MemberFunctionException(*this, __func__)
+            << "Invalid node tag " << tag << "."
+            << Alert::Raise;
+        }
+        m_nodeIndex[tag - minTag] = index;
+        std::copy_n(coordinates.begin() + i * stride, 3, m_coordinates.begin() + 3 * index);
+        index++;
+      }
+    }
+    if (index != nodeCount)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Expected " << nodeCount << " nodes but read " << index << "."
+        << Alert::Raise;
+    }
+  }
+
+  void MeshLoader<FileFormat::GMSH, Context::Local>::readElements(std::istream& is)
+  {
+    std::array<size_t, 4> header;
+    read(is, m_format, header.data(), header.size());
+    if (!is)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to read the header of the $Elements section."
+        << Alert::Raise;
+    }
+    const size_t blockCount = header[0];
+
+    std::vector<size_t> data;
+    for (size_t b = 0; b < blockCount; b++)
+    {
+      std::array<int, 3> block;
+      size_t count;
+      read(is, m_format, block.data(), block.size());
+      read(is, m_format, &count, 1);
+      const auto [entityDimension, entityTag, elementType] = block;
+      if (!is || entityDimension < 0 || entityDimension > 3)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Failed to read the header of element block " << b << "."
+          << Alert::Raise;
+      }
+
+      const auto n = GMSH::getNodeCount(elementType);
+      if (!n)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Unknown element type " << elementType << "."
+          << Alert::Raise;
+      }
+      const auto g = GMSH::getGeometry(elementType);
+      if (!g)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Unsupported element type " << elementType << " in entity ("
+          << entityDimension << ", " << entityTag << ")."
+          << Alert::Raise;
+      }
+
+      // Each element is its tag followed by the tags of its nodes
+      const size_t record = 1 + *n;
+      data.resize(record * count);
+      read(is, m_format, data.data(), data.size());
+      if (!is)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Failed to read element block " << b << " of entity ("
+          << entityDimension << ", " << entityTag << ")."
+          << Alert::Raise;
+      }
+
+      const Geometry::Attribute attribute = getAttribute(entityDimension, entityTag);
+      const auto getNode =
+        [&](size_t tag)
+        {
+          const size_t k = tag - m_minNodeTag;
+          if (tag < m_minNodeTag || k >= m_nodeIndex.size() || m_nodeIndex[k] == InvalidNode)
+          {
+            Alert::MemberFunctionException(*this, __func__)
+              << "Invalid node tag " << tag << " in element block " << b << "."
+              << Alert::Raise;
+          }
+          return m_nodeIndex[k];
+        };
+
+      if (*g == Geometry::Polytope::Type::Point)
+      {
+        for (size_t i = 0; i < count; i++)
+          m_nodeAttributes[getNode(data[i * record + 1])] = attribute;
+      }
+      else
+      {
+        auto& elements = m_elements[*g];
+        elements.vertices.reserve(elements.vertices.size() + *n * count);
+        elements.attributes.reserve(elements.attributes.size() + count);
+        for (size_t i = 0; i < count; i++)
+        {
+          for (size_t k = 0; k < *n; k++)
+            elements.vertices.push_back(getNode(data[i * record + 1 + k]));
+          elements.attributes.push_back(attribute);
+        }
+      }
+    }
+  }
+
+  void MeshLoader<FileFormat::GMSH, Context::Local>::skipSection(
+      std::istream& is, const std::string& name)
+  {
+    const std::string end = "$End" + name;
+    std::string line;
+    while (std::getline(is, line))
+    {
+      boost::algorithm::trim(line);
+      if (line == end)
+        return;
+    }
+    Alert::MemberFunctionException(*this, __func__)
+      << "Missing " << end << " for section $" << name << "."
+      << Alert::Raise;
+  }
+
+  Geometry::Attribute
+  MeshLoader<FileFormat::GMSH, Context::Local>::getAttribute(size_t d, int entity) const
+  {
+    const auto it = m_entities[d].find(entity);
+    if (it == m_entities[d].end())
+      return toAttribute(entity);
+    else
+      return it->second;
+  }
+}
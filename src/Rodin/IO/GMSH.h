@@ -0,0 +1,140 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_IO_GMSH_H
+#define RODIN_IO_GMSH_H
+
+#include <map>
+#include <array>
+#include <string>
+#include <optional>
+#include <unordered_map>
+
+#include "Rodin/Types.h"
+#include "Rodin/Context.h"
+#include "Rodin/Geometry/Types.h"
+#include "Rodin/Geometry/Polytope.h"
+
+#include "ForwardDecls.h"
+#include "MeshLoader.h"
+
+namespace Rodin::IO::GMSH
+{
+  /**
+   * @brief Encoding of a MSH file, as given in the $MeshFormat section.
+   */
+  enum class FileType
+  {
+    ASCII = 0, ///< Plain text
+    Binary = 1 ///< Binary encoding
+  };
+
+  /**
+   * @brief Contents of the $MeshFormat section of a MSH file.
+   */
+  struct MeshFormat
+  {
+    /// Version of the file format
+    std::string version;
+
+    /// Encoding of the file
+    FileType fileType;
+
+    /// Size in bytes of the size_t fields of a binary file
+    size_t dataSize;
+
+    /// Whether the binary data has the opposite endianness of the host
+    bool swap;
+  };
+
+  /**
+   * @brief Gets the geometry of a Gmsh element type, if it is supported.
+   */
+  std::optional<Geometry::Polytope::Type> getGeometry(int elementType);
+
+  /**
+   * @brief Gets the number of nodes of a Gmsh element type, if the type is
+   * known.
+   */
+  std::optional<size_t> getNodeCount(int elementType);
+}
+
+namespace Rodin::IO
+{
+  /**
+   * @ingroup MeshLoaderSpecializations
+   * @brief Specialization for loading Gmsh meshes in the MSH 4.1 format.
+   *
+   * Both the ASCII and binary encodings are supported. The nodes and
+   * elements of each entity block are read with a single bulk read in the
+   * binary encoding.
+   *
+   * The attribute of an element is the first physical tag of the entity it
+   * belongs to. If the entity has no physical tag, or the file has no
+   * $Entities section, the attribute is the entity tag. Point elements
+   * (type 15) set the attribute of their vertex.
+   */
+  template <>
+  class MeshLoader<IO::FileFormat::GMSH, Context::Local>
+    : public MeshLoaderBase<Context::Local>
+  {
+    public:
+      using ContextType = Context::Local;
+
+      using ObjectType = Geometry::Mesh<ContextType>;
+
+      MeshLoader(ObjectType& mesh)
+        : MeshLoaderBase<Context::Local>(mesh)
+      {}
+
+      void load(std::istream& is) override;
+
+      /**
+       * @brief Gets the physical names of the last loaded file, indexed by
+       * the dimension and the physical tag.
+       */
+      const std::map<std::pair<size_t, Geometry::Attribute>, std::string>& getPhysicalNames() const
+      {
+        return m_physicalNames;
+      }
+
+    private:
+      /**
+       * Elements of a single geometry, with their vertices stored
+       * contiguously.
+       */
+      struct Elements
+      {
+        std::vector<Index> vertices;
+        std::vector<Geometry::Attribute> attributes;
+      };
+
+      void readMeshFormat(std::istream& is);
+
+      void readPhysicalNames(std::istream& is);
+
+      void readEntities(std::istream& is);
+
+      void readNodes(std::istream& is);
+
+      void readElements(std::istream& is);
+
+      void skipSection(std::istream& is, const std::string& name);
+
+      Geometry::Attribute getAttribute(size_t d, int entity) const;
+
+      GMSH::MeshFormat m_format;
+      std::map<std::pair<size_t, Geometry::Attribute>, std::string> m_physicalNames;
+      std::array<std::unordered_map<int, Geometry::Attribute>, 4> m_entities;
+      size_t m_minNodeTag;
+      std::vector<Index> m_nodeIndex;
+      std::vector<Real> m_coordinates;
+      std::vector<Geometry::Attribute> m_nodeAttributes;
+      std::map<Geometry::Polytope::Type, Elements> m_elements;
+  };
+}
+
+#endif
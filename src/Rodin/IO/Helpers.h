@@ -0,0 +1,37 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_IO_HELPERS_H
+#define RODIN_IO_HELPERS_H
+
+#include <istream>
+#include <optional>
+
+#include "ForwardDecls.h"
+
+namespace Rodin::IO
+{
+  /**
+   * @brief Detects the format of a mesh file from its header.
+   * @param[in,out] input Input stream, positioned at the start of the file
+   *
+   * The first nonempty line of the stream is compared to the headers of the
+   * supported formats:
+   * - `MFEM mesh v1.0`, `MFEM mesh v1.1`, `MFEM mesh v1.2` and `MFEM NC
+   *   mesh v1.0` for FileFormat::MFEM,
+   * - `$MeshFormat` for FileFormat::GMSH, in both the ASCII and the binary
+   *   encodings,
+   * - `MeshVersionFormatted` for the ASCII encoding of FileFormat::MEDIT.
+   *
+   * The stream is rewound to its initial position afterwards.
+   *
+   * @returns The format of the file, or `std::nullopt` if the header is not
+   * recognized.
+   */
+  std::optional<FileFormat> getMeshFormat(std::istream& input);
+}
+
+#endif
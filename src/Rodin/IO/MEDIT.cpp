@@ -4,12 +4,540 @@
  *       (See accompanying file LICENSE or copy at
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
+#include <charconv>
+#include <limits>
+#include <cstring>
+#include <numeric>
 #include <boost/algorithm/string.hpp>
+#include <boost/filesystem/operations.hpp>
+
+#include "Rodin/Configure.h"
+#include "Rodin/Threads/ThreadPool.h"
 
 #include "MEDIT.h"
 
 namespace Rodin::IO
 {
+  namespace
+  {
+    /**
+     * Number of entities between two consecutive checkpoints of a section.
+     * Each block of entities between checkpoints is parsed as one task.
+     */
+    constexpr size_t CheckpointInterval = 4096;
+
+    /**
+     * Minimum number of bytes handed to a single task when parsing a
+     * whitespace separated list of numbers.
+     */
+    constexpr size_t MinimumChunkSize = 65536;
+
+    /**
+     * Section of a MEDIT file, with a cursor to every CheckpointInterval-th
+     * entity of the section.
+     */
+    struct Section
+    {
+      MEDIT::Keyword keyword;
+      size_t count;
+      std::vector<MEDIT::Cursor> checkpoints;
+    };
+
+    bool isBlank(char c)
+    {
+      return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+    }
+
+    bool isWhitespace(char c)
+    {
+      return isBlank(c) || c == '\n';
+    }
+
+    size_t getChunkCount()
+    {
+#ifdef RODIN_MULTITHREADED
+      return Threads::getGlobalThreadPool().getThreadCount();
+#else
+      return 1;
+#endif
+    }
+
+    /**
+     * Calls loop(start, end) over blocks of [0, count), in parallel on the
+     * global thread pool if Rodin is multithreaded.
+     */
+    template <class F>
+    void parallelLoop(size_t count, const F& loop)
+    {
+      if (count == 0)
+        return;
+#ifdef RODIN_MULTITHREADED
+      auto& threadPool = Threads::getGlobalThreadPool();
+      threadPool.pushLoop(0, count, loop);
+      threadPool.waitForTasks();
+#else
+      loop(0, count);
+#endif
+    }
+
+    /**
+     * Calls parse(cursor, i) for each entity i of the section, where the
+     * cursor is positioned at the beginning of the entity. The blocks of
+     * entities between checkpoints are parsed in parallel.
+     *
+     * @returns The first line which failed to parse, or zero if all the
+     * entities were successfully parsed.
+     */
+    template <class F>
+    size_t parseSection(const Section& section, const F& parse)
+    {
+      std::vector<size_t> failures(section.checkpoints.size(), 0);
+      parallelLoop(section.checkpoints.size(),
+          [&](const Index start, const Index end)
+          {
+            for (Index c = start; c < end; c++)
+            {
+              MEDIT::Cursor cursor = section.checkpoints[c];
+              const size_t first = c * CheckpointInterval;
+              const size_t last = std::min(first + CheckpointInterval, section.count);
+              for (size_t i = first; i < last; i++)
+              {
+                cursor.skipWhitespace();
+                if (!parse(cursor, i) || !cursor.isEndOfLine())
+                {
+                  failures[c] = cursor.getLineNumber();
+                  break;
+                }
+                cursor.skipLine();
+              }
+            }
+          });
+      for (const size_t line : failures)
+      {
+        if (line > 0)
+          return line;
+      }
+      return 0;
+    }
+
+    /**
+     * Adds the vertices and their attributes to the mesh being built.
+     */
+    void addVertices(Geometry::Mesh<Context::Local>::Builder& build,
+        Math::PointMatrix&& vertices, const std::vector<Geometry::Attribute>& attributes)
+    {
+      build.nodes(attributes.size());
+      build.setVertices(std::move(vertices));
+      for (size_t i = 0; i < attributes.size(); i++)
+      {
+        if (attributes[i] != RODIN_DEFAULT_POLYTOPE_ATTRIBUTE)
+          build.attribute({ 0, i }, attributes[i]);
+      }
+    }
+
+    /**
+     * Adds the polytopes of geometry g to the mesh being built, where the
+     * (zero based) vertices of polytope i are stored contiguously in
+     * vertices. The vertices of quadrilaterals are given in the MEDIT
+     * ordering. The offsets hold the number of polytopes already added in
+     * each dimension.
+     */
+    void addPolytopes(Geometry::Mesh<Context::Local>::Builder& build,
+        std::array<size_t, 4>& offsets, Geometry::Polytope::Type g,
+        const std::vector<Index>& vertices, const std::vector<Geometry::Attribute>& attributes)
+    {
+      const size_t d = Geometry::Polytope::getGeometryDimension(g);
+      const size_t n = Geometry::Polytope::getVertexCount(g);
+      const size_t count = attributes.size();
+      assert(vertices.size() == count * n);
+      build.reserve(d, count);
+      for (size_t i = 0; i < count; i++)
+      {
+        IndexArray vs(n);
+        std::copy_n(vertices.begin() + i * n, n, vs.begin());
+        if (g == Geometry::Polytope::Type::Quadrilateral)
+          std::swap(vs(2), vs(3));
+        build.polytope(g, std::move(vs));
+        if (attributes[i] != RODIN_DEFAULT_POLYTOPE_ATTRIBUTE)
+          build.attribute({ d, offsets[d] + i }, attributes[i]);
+      }
+      offsets[d] += count;
+    }
+
+    /**
+     * Gets the geometry of the polytopes listed under the keyword.
+     */
+    std::optional<Geometry::Polytope::Type> getGeometry(MEDIT::Keyword kw)
+    {
+      switch (kw)
+      {
+        case MEDIT::Keyword::Edges:
+          return Geometry::Polytope::Type::Segment;
+        case MEDIT::Keyword::Triangles:
+          return Geometry::Polytope::Type::Triangle;
+        case MEDIT::Keyword::Quadrilaterals:
+          return Geometry::Polytope::Type::Quadrilateral;
+        case MEDIT::Keyword::Tetrahedra:
+          return Geometry::Polytope::Type::Tetrahedron;
+        default:
+          return {};
+      }
+    }
+
+    template <class T>
+    T load(const char* p, bool swap)
+    {
+      char bytes[sizeof(T)];
+      std::memcpy(bytes, p, sizeof(T));
+      if (swap)
+        std::reverse(bytes, bytes + sizeof(T));
+      T res;
+      std::memcpy(&res, bytes, sizeof(T));
+      return res;
+    }
+
+    template <class T>
+    const char* parseNumber(const char* begin, const char* end, T& value)
+    {
+      if (begin != end && *begin == '+')
+        ++begin;
+      const auto [ptr, ec] = std::from_chars(begin, end, value);
+      if (ec != std::errc() || (ptr != end && !isWhitespace(*ptr) && *ptr != '#'))
+        return nullptr;
+      return ptr;
+    }
+  }
+
+  MEDIT::MappedFile::MappedFile(const boost::filesystem::path& filename)
+    : m_begin(nullptr), m_end(nullptr)
+  {
+    boost::system::error_code ec;
+    const auto size = boost::filesystem::file_size(filename, ec);
+    if (ec)
+    {
+      Alert::Exception()
+        << "Failed to open " << filename << " for reading."
+        << Alert::Raise;
+    }
+
+    // Empty files cannot be mapped
+    if (size == 0)
+      return;
+
+    try
+    {
+      m_file.open(filename.string());
+    }
+    catch (const std::exception& e)
+    {
+      Alert::Exception()
+        << "Failed to map " << filename << " into memory: " << e.what()
+        << Alert::Raise;
+    }
+    m_begin = m_file.data();
+    m_end = m_begin + m_file.size();
+  }
+
+  bool MEDIT::Cursor::skipWhitespace()
+  {
+    while (m_it != m_end)
+    {
+      const char c = *m_it;
+      if (c == '\n')
+      {
+        m_line++;
+        m_it++;
+      }
+      else if (isBlank(c))
+      {
+        m_it++;
+      }
+      else if (c == '#')
+      {
+        skipLine();
+      }
+      else
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void MEDIT::Cursor::skipLine()
+  {
+    const void* nl = std::memchr(m_it, '\n', m_end - m_it);
+    if (nl)
+    {
+      m_it = static_cast<const char*>(nl) + 1;
+      m_line++;
+    }
+    else
+    {
+      m_it = m_end;
+    }
+  }
+
+  bool MEDIT::Cursor::isEndOfLine()
+  {
+    while (m_it != m_end && isBlank(*m_it))
+      m_it++;
+    return m_it == m_end || *m_it == '\n' || *m_it == '#';
+  }
+
+  std::optional<std::string_view> MEDIT::Cursor::getKeyword()
+  {
+    while (m_it != m_end && isBlank(*m_it))
+      m_it++;
+    const char* begin = m_it;
+    while (m_it != m_end && std::isalpha(static_cast<unsigned char>(*m_it)))
+      m_it++;
+    if (begin == m_it)
+      return {};
+    return std::string_view(begin, m_it - begin);
+  }
+
+  std::optional<size_t> MEDIT::Cursor::getUnsignedInteger()
+  {
+    while (m_it != m_end && isBlank(*m_it))
+      m_it++;
+    size_t value;
+    const char* ptr = parseNumber(m_it, m_end, value);
+    if (!ptr)
+      return {};
+    m_it = ptr;
+    return value;
+  }
+
+  std::optional<Rodin::Real> MEDIT::Cursor::getReal()
+  {
+    while (m_it != m_end && isBlank(*m_it))
+      m_it++;
+    Rodin::Real value;
+    const char* ptr = parseNumber(m_it, m_end, value);
+    if (!ptr)
+      return {};
+    m_it = ptr;
+    return value;
+  }
+
+  bool MEDIT::parseReals(const char* begin, const char* end, Rodin::Real* out, size_t count)
+  {
+    if (count == 0)
+      return true;
+
+    // Split the buffer into chunks which start and end on whitespace
+    const size_t size = end - begin;
+    const size_t chunks =
+      std::max<size_t>(1, std::min(4 * getChunkCount(), size / MinimumChunkSize));
+    std::vector<const char*> bounds(chunks + 1);
+    bounds[0] = begin;
+    bounds[chunks] = end;
+    for (size_t c = 1; c < chunks; c++)
+    {
+      const char* it = std::max(bounds[c - 1], begin + c * (size / chunks));
+      while (it != end && !isWhitespace(*it))
+        it++;
+      bounds[c] = it;
+    }
+
+    // Count the numbers in each chunk to know where each chunk starts
+    std::vector<size_t> offsets(chunks + 1, 0);
+    parallelLoop(chunks,
+        [&](const Index start, const Index stop)
+        {
+          for (Index c = start; c < stop; c++)
+          {
+            size_t n = 0;
+            bool token = false;
+            for (const char* it = bounds[c]; it != bounds[c + 1]; ++it)
+            {
+              const bool ws = isWhitespace(*it);
+              n += !ws && !token;
+              token = !ws;
+            }
+            offsets[c + 1] = n;
+          }
+        });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    if (offsets[chunks] < count)
+      return false;
+
+    std::vector<uint8_t> success(chunks, true);
+    parallelLoop(chunks,
+        [&](const Index start, const Index stop)
+        {
+          for (Index c = start; c < stop; c++)
+          {
+            const char* it = bounds[c];
+            const char* last = bounds[c + 1];
+            for (size_t i = offsets[c]; i < std::min(offsets[c + 1], count); i++)
+            {
+              while (isWhitespace(*it))
+                it++;
+              it = parseNumber(it, last, out[i]);
+              if (!it)
+              {
+                success[c] = false;
+                break;
+              }
+            }
+          }
+        });
+    return std::all_of(success.begin(), success.end(), [](uint8_t b) { return b; });
+  }
+
+  std::optional<MEDIT::BinaryReader>
+  MEDIT::BinaryReader::open(const char* begin, const char* end)
+  {
+    const size_t size = end - begin;
+    if (size < 8)
+      return {};
+    bool swap;
+    if (load<int32_t>(begin, false) == 1)
+      swap = false;
+    else if (load<int32_t>(begin, true) == 1)
+      swap = true;
+    else
+      return {};
+    const int32_t version = load<int32_t>(begin + 4, swap);
+    if (version < 1 || version > 4)
+      return {};
+    return BinaryReader(begin, size, version, swap);
+  }
+
+  int32_t MEDIT::BinaryReader::readWord(size_t offset) const
+  {
+    assert(offset + 4 <= m_size);
+    return load<int32_t>(m_data + offset, m_swap);
+  }
+
+  int64_t MEDIT::BinaryReader::readInteger(size_t offset) const
+  {
+    assert(offset + getIntegerSize() <= m_size);
+    if (m_version >= 4)
+      return load<int64_t>(m_data + offset, m_swap);
+    else
+      return load<int32_t>(m_data + offset, m_swap);
+  }
+
+  uint64_t MEDIT::BinaryReader::readPosition(size_t offset) const
+  {
+    assert(offset + getPositionSize() <= m_size);
+    if (m_version >= 3)
+      return load<uint64_t>(m_data + offset, m_swap);
+    else
+      return load<uint32_t>(m_data + offset, m_swap);
+  }
+
+  Rodin::Real MEDIT::BinaryReader::readReal(size_t offset) const
+  {
+    assert(offset + getRealSize() <= m_size);
+    if (m_version == 1)
+      return load<float>(m_data + offset, m_swap);
+    else
+      return load<double>(m_data + offset, m_swap);
+  }
+
+  void MEDIT::BinaryReader::readReals(size_t offset, Rodin::Real* out, size_t count) const
+  {
+    assert(offset + count * getRealSize() <= m_size);
+    if constexpr (std::is_same_v<Rodin::Real, double>)
+    {
+      if (m_version >= 2 && !m_swap)
+      {
+        std::memcpy(out, m_data + offset, count * sizeof(double));
+        return;
+      }
+    }
+    parallelLoop(count,
+        [&](const Index start, const Index stop)
+        {
+          for (Index i = start; i < stop; i++)
+            out[i] = readReal(offset + i * getRealSize());
+        });
+  }
+
+  size_t MEDIT::BinaryWriter::getVersion(size_t size, size_t integer)
+  {
+    if (integer >= static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+      return 4;
+    else if (size >= static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+      return 3;
+    else
+      return 2;
+  }
+
+  MEDIT::BinaryWriter::BinaryWriter(std::ostream& os, size_t version)
+    : m_os(os), m_version(version), m_offset(0)
+  {
+    assert(m_version >= 2 && m_version <= 4);
+    m_buffer.reserve(BufferSize);
+  }
+
+  MEDIT::BinaryWriter& MEDIT::BinaryWriter::writeHeader()
+  {
+    writeWord(1);
+    writeWord(m_version);
+    return *this;
+  }
+
+  MEDIT::BinaryWriter& MEDIT::BinaryWriter::writeKeyword(Keyword kw, size_t size)
+  {
+    writeWord(toBinaryCode(kw));
+    const uint64_t next =
+      (kw == Keyword::End) ? 0 : getOffset() + getPositionSize() + size;
+    if (m_version >= 3)
+      append<uint64_t>(next);
+    else
+      append<uint32_t>(next);
+    return *this;
+  }
+
+  MEDIT::BinaryWriter& MEDIT::BinaryWriter::writeWord(int32_t v)
+  {
+    append(v);
+    return *this;
+  }
+
+  MEDIT::BinaryWriter& MEDIT::BinaryWriter::writeInteger(int64_t v)
+  {
+    if (m_version >= 4)
+      append<int64_t>(v);
+    else
+      append<int32_t>(v);
+    return *this;
+  }
+
+  MEDIT::BinaryWriter& MEDIT::BinaryWriter::writeReal(Rodin::Real v)
+  {
+    append<double>(v);
+    return *this;
+  }
+
+  MEDIT::BinaryWriter& MEDIT::BinaryWriter::writeReals(const Rodin::Real* data, size_t count)
+  {
+    if constexpr (std::is_same_v<Rodin::Real, double>)
+    {
+      flush();
+      m_os.write(reinterpret_cast<const char*>(data), count * sizeof(double));
+      m_offset += count * sizeof(double);
+    }
+    else
+    {
+      for (size_t i = 0; i < count; i++)
+        writeReal(data[i]);
+    }
+    return *this;
+  }
+
+  MEDIT::BinaryWriter& MEDIT::BinaryWriter::flush()
+  {
+    m_os.write(m_buffer.data(), m_buffer.size());
+    m_offset += m_buffer.size();
+    m_buffer.clear();
+    return *this;
+  }
   std::istream& MeshLoader<FileFormat::MEDIT, Context::Local>::getline(std::istream& is, std::string& line)
   {
     m_currentLineNumber++;
@@ -225,6 +753,20 @@ namespace Rodin::IO
 
   void MeshLoader<FileFormat::MEDIT, Context::Local>::load(std::istream& is)
   {
+    // Binary files start with the integer 1, in either byte order
+    const auto c = is.peek();
+    if (c == 0 || c == 1)
+    {
+      const std::string buffer{ std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+      const auto reader = MEDIT::BinaryReader::open(buffer.data(), buffer.data() + buffer.size());
+      if (!reader)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Failed to read the header of the binary mesh." << Alert::Raise;
+      }
+      readBinary(*reader);
+      return;
+    }
     readVersion(is);
     readDimension(is);
     m_build.initialize(m_spaceDimension);
@@ -232,6 +774,299 @@ namespace Rodin::IO
     getObject() = m_build.finalize();
   }
 
+  void MeshLoader<FileFormat::MEDIT, Context::Local>::readBinary(const MEDIT::BinaryReader& reader)
+  {
+    m_version = reader.getVersion();
+
+    const size_t realSize = reader.getRealSize();
+    const size_t integerSize = reader.getIntegerSize();
+
+    std::optional<size_t> dimension;
+    std::array<size_t, 4> offsets = { 0, 0, 0, 0 };
+    size_t pos = reader.getHeaderSize();
+    while (pos + 4 <= reader.getSize())
+    {
+      const size_t start = pos;
+      const int32_t code = reader.readWord(pos);
+      const auto kw = MEDIT::fromBinaryCode(code);
+      if (kw && *kw == MEDIT::Keyword::End)
+        break;
+      pos += 4;
+      if (pos + reader.getPositionSize() > reader.getSize())
+        break;
+      const size_t next = reader.readPosition(pos);
+      pos += reader.getPositionSize();
+
+      if (kw == MEDIT::Keyword::Dimension)
+      {
+        dimension = reader.readWord(pos);
+        m_spaceDimension = *dimension;
+        m_build.initialize(m_spaceDimension);
+      }
+      else if (kw == MEDIT::Keyword::Vertices || (kw && getGeometry(*kw)))
+      {
+        if (!dimension)
+        {
+          Alert::MemberFunctionException(*this, __func__)
+            << "Failed to parse dimension of mesh." << Alert::Raise;
+        }
+
+        const size_t count = reader.readInteger(pos);
+        pos += integerSize;
+        m_count[*kw] = count;
+
+        const size_t sdim = m_spaceDimension;
+        const size_t n =
+          (*kw == MEDIT::Keyword::Vertices) ? 0 : Geometry::Polytope::getVertexCount(*getGeometry(*kw));
+        const size_t record =
+          (*kw == MEDIT::Keyword::Vertices) ? sdim * realSize + integerSize : (n + 1) * integerSize;
+        if (pos + count * record > reader.getSize())
+        {
+          Alert::MemberFunctionException(*this, __func__)
+            << "Unexpected end of file while reading "
+            << std::quoted(MEDIT::toCharString(*kw)) << "." << Alert::Raise;
+        }
+
+        std::vector<Geometry::Attribute> attributes(count);
+        if (*kw == MEDIT::Keyword::Vertices)
+        {
+          Math::PointMatrix vertices(sdim, count);
+          parallelLoop(count,
+              [&](const Index start, const Index stop)
+              {
+                for (Index i = start; i < stop; i++)
+                {
+                  const size_t p = pos + i * record;
+                  for (size_t k = 0; k < sdim; k++)
+                    vertices(k, i) = reader.readReal(p + k * realSize);
+                  attributes[i] = reader.readInteger(p + sdim * realSize);
+                }
+              });
+          addVertices(m_build, std::move(vertices), attributes);
+        }
+        else
+        {
+          std::vector<Index> vertices(count * n);
+          std::vector<uint8_t> valid(count, true);
+          parallelLoop(count,
+              [&](const Index start, const Index stop)
+              {
+                for (Index i = start; i < stop; i++)
+                {
+                  const size_t p = pos + i * record;
+                  for (size_t k = 0; k < n; k++)
+                  {
+                    const int64_t v = reader.readInteger(p + k * integerSize);
+                    valid[i] = valid[i] && v > 0;
+                    vertices[i * n + k] = v - 1;
+                  }
+                  attributes[i] = reader.readInteger(p + n * integerSize);
+                }
+              });
+          const auto it = std::find(valid.begin(), valid.end(), false);
+          if (it != valid.end())
+          {
+            Alert::MemberFunctionException(*this, __func__)
+              << "Invalid vertex index in " << *getGeometry(*kw) << " "
+              << std::distance(valid.begin(), it) << "."
+              << Alert::Raise;
+          }
+          addPolytopes(m_build, offsets, *getGeometry(*kw), vertices, attributes);
+        }
+      }
+
+      // Positions only move forward, anything else marks the last keyword
+      if (next <= start)
+        break;
+      pos = next;
+    }
+
+    if (!dimension)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to parse dimension of mesh." << Alert::Raise;
+    }
+
+    getObject() = m_build.finalize();
+  }
+
+  void MeshLoader<FileFormat::MEDIT, Context::Local>::load(const boost::filesystem::path& filename)
+  {
+    const MEDIT::MappedFile file(filename);
+    if (const auto reader = MEDIT::BinaryReader::open(file.begin(), file.end()))
+    {
+      readBinary(*reader);
+      return;
+    }
+
+    // Locate every section in a single pass over the file
+    std::optional<size_t> version, dimension;
+    std::vector<Section> sections;
+    MEDIT::Cursor cursor(file.begin(), file.end());
+    while (cursor.skipWhitespace())
+    {
+      if (!std::isalpha(static_cast<unsigned char>(*cursor.getPosition())))
+      {
+        cursor.skipLine();
+        continue;
+      }
+      const auto kw = cursor.getKeyword();
+      assert(kw);
+      const auto entity = MEDIT::toKeyword(std::string(*kw).c_str());
+      if (!entity)
+      {
+        Alert::Warning() << "Ignoring unrecognized keyword: " << *kw << Alert::Raise;
+        cursor.skipLine();
+        continue;
+      }
+      if (*entity == MEDIT::Keyword::End)
+        break;
+
+      cursor.skipWhitespace();
+      const auto value = cursor.getUnsignedInteger();
+      switch (*entity)
+      {
+        case MEDIT::Keyword::MeshVersionFormatted:
+        {
+          if (!value)
+          {
+            Alert::MemberFunctionException(*this, __func__)
+              << "Failed to parse version number of mesh." << Alert::Raise;
+          }
+          version = *value;
+          cursor.skipLine();
+          continue;
+        }
+        case MEDIT::Keyword::Dimension:
+        {
+          if (!value)
+          {
+            Alert::MemberFunctionException(*this, __func__)
+              << "Failed to parse dimension of mesh." << Alert::Raise;
+          }
+          dimension = *value;
+          cursor.skipLine();
+          continue;
+        }
+        default:
+          break;
+      }
+
+      if (!value)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Failed to determine number of "
+          << std::quoted(std::string(*kw)) << "." << Alert::Raise;
+      }
+      cursor.skipLine();
+
+      m_pos[*entity] = std::istream::pos_type(cursor.getPosition() - file.begin());
+      m_count[*entity] = *value;
+
+      Section section{ *entity, *value, {} };
+      section.checkpoints.reserve((*value + CheckpointInterval - 1) / CheckpointInterval);
+      for (size_t i = 0; i < *value; i++)
+      {
+        if (!cursor.skipWhitespace())
+        {
+          Alert::MemberFunctionException(*this, __func__)
+            << "Unexpected end of file while reading "
+            << std::quoted(std::string(*kw)) << "." << Alert::Raise;
+        }
+        if (i % CheckpointInterval == 0)
+          section.checkpoints.push_back(cursor);
+        cursor.skipLine();
+      }
+      sections.push_back(std::move(section));
+    }
+
+    if (!version)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to parse version number of mesh." << Alert::Raise;
+    }
+
+    if (!dimension)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to parse dimension of mesh." << Alert::Raise;
+    }
+
+    m_version = *version;
+    m_spaceDimension = *dimension;
+    m_build.initialize(m_spaceDimension);
+
+    // Parse the entities of each section in parallel
+    std::array<size_t, 4> offsets = { 0, 0, 0, 0 };
+    for (const auto& section : sections)
+    {
+      if (section.keyword == MEDIT::Keyword::Vertices)
+      {
+        const size_t sdim = m_spaceDimension;
+        Math::PointMatrix vertices(sdim, section.count);
+        std::vector<Geometry::Attribute> attributes(section.count);
+        const size_t line = parseSection(section,
+            [&](MEDIT::Cursor& c, size_t i)
+            {
+              for (size_t k = 0; k < sdim; k++)
+              {
+                const auto x = c.getReal();
+                if (!x)
+                  return false;
+                vertices(k, i) = *x;
+              }
+              const auto attr = c.getUnsignedInteger();
+              if (!attr)
+                return false;
+              attributes[i] = *attr;
+              return true;
+            });
+        if (line > 0)
+        {
+          Alert::MemberFunctionException(*this, __func__)
+            << "Failed to parse Vertex on line "
+            << std::to_string(line)
+            << "."
+            << Alert::Raise;
+        }
+        addVertices(m_build, std::move(vertices), attributes);
+      }
+      else if (const auto g = getGeometry(section.keyword))
+      {
+        const size_t n = Geometry::Polytope::getVertexCount(*g);
+        std::vector<Index> vertices(section.count * n);
+        std::vector<Geometry::Attribute> attributes(section.count);
+        const size_t line = parseSection(section,
+            [&](MEDIT::Cursor& c, size_t i)
+            {
+              for (size_t k = 0; k < n; k++)
+              {
+                const auto v = c.getUnsignedInteger();
+                if (!v || *v == 0)
+                  return false;
+                vertices[i * n + k] = *v - 1;
+              }
+              const auto attr = c.getUnsignedInteger();
+              if (!attr)
+                return false;
+              attributes[i] = *attr;
+              return true;
+            });
+        if (line > 0)
+        {
+          Alert::MemberFunctionException(*this, __func__)
+            << "Failed to parse " << *g << " on line "
+            << std::to_string(line)
+            << "."
+            << Alert::Raise;
+        }
+        addPolytopes(m_build, offsets, *g, vertices, attributes);
+      }
+    }
+
+    getObject() = m_build.finalize();
+  }
+
   void MeshPrinter<FileFormat::MEDIT, Context::Local>::printDimension(std::ostream& os)
   {
     const auto& mesh = getObject();
@@ -353,8 +1188,93 @@ namespace Rodin::IO
     os << '\n' << IO::MEDIT::Keyword::End;
   }
 
+  void MeshPrinter<FileFormat::MEDIT, Context::Local>::printBinary(std::ostream& os, bool pEnd)
+  {
+    const auto& mesh = getObject();
+    const size_t sdim = mesh.getSpaceDimension();
+    const size_t vertexCount = mesh.getVertexCount();
+
+    static constexpr std::array<std::pair<MEDIT::Keyword, Geometry::Polytope::Type>, 4> s_sections =
+    {{
+      { MEDIT::Keyword::Edges, Geometry::Polytope::Type::Segment },
+      { MEDIT::Keyword::Triangles, Geometry::Polytope::Type::Triangle },
+      { MEDIT::Keyword::Quadrilaterals, Geometry::Polytope::Type::Quadrilateral },
+      { MEDIT::Keyword::Tetrahedra, Geometry::Polytope::Type::Tetrahedron }
+    }};
+
+    // Upper bound on the size of the file, assuming 64-bit fields
+    size_t size = 64 + 8 + vertexCount * (sdim + 1) * 8;
+    size_t integer = vertexCount + 1;
+    for (const auto& [kw, g] : s_sections)
+    {
+      if (Geometry::Polytope::getGeometryDimension(g) > mesh.getDimension())
+        continue;
+      const size_t count = mesh.getPolytopeCount(g);
+      size += 24 + count * (Geometry::Polytope::getVertexCount(g) + 1) * 8;
+      integer = std::max(integer, count);
+    }
+
+    MEDIT::BinaryWriter out(os, MEDIT::BinaryWriter::getVersion(size, integer));
+    const size_t integerSize = out.getIntegerSize();
+
+    out.writeHeader();
+    out.writeKeyword(MEDIT::Keyword::Dimension, 4);
+    out.writeWord(sdim);
+
+    out.writeKeyword(MEDIT::Keyword::Vertices,
+        integerSize + vertexCount * (sdim * out.getRealSize() + integerSize));
+    out.writeInteger(vertexCount);
+    const auto& vertices = mesh.getVertices();
+    for (size_t i = 0; i < vertexCount; i++)
+    {
+      for (size_t k = 0; k < sdim; k++)
+        out.writeReal(vertices(k, i));
+      out.writeInteger(mesh.getAttribute(0, i));
+    }
+
+    const auto& conn = mesh.getConnectivity();
+    for (const auto& [kw, g] : s_sections)
+    {
+      const size_t d = Geometry::Polytope::getGeometryDimension(g);
+      if (d > mesh.getDimension())
+        continue;
+      const size_t n = Geometry::Polytope::getVertexCount(g);
+      const size_t count = mesh.getPolytopeCount(g);
+      if (count == 0)
+        continue;
+      out.writeKeyword(kw, integerSize + count * (n + 1) * integerSize);
+      out.writeInteger(count);
+      for (Index i = 0; i < mesh.getPolytopeCount(d); i++)
+      {
+        if (mesh.getGeometry(d, i) != g)
+          continue;
+        const auto& vs = conn.getPolytope(d, i);
+        if (g == Geometry::Polytope::Type::Quadrilateral)
+        {
+          out.writeInteger(vs(0) + 1).writeInteger(vs(1) + 1)
+             .writeInteger(vs(3) + 1).writeInteger(vs(2) + 1);
+        }
+        else
+        {
+          for (size_t k = 0; k < n; k++)
+            out.writeInteger(vs(k) + 1);
+        }
+        out.writeInteger(mesh.getAttribute(d, i));
+      }
+    }
+
+    if (pEnd)
+      out.writeKeyword(MEDIT::Keyword::End, 0);
+    out.flush();
+  }
+
   void MeshPrinter<FileFormat::MEDIT, Context::Local>::print(std::ostream& os, bool pEnd)
   {
+    if (m_encoding == MEDIT::Encoding::Binary)
+    {
+      printBinary(os, pEnd);
+      return;
+    }
     printVersion(os);
     printDimension(os);
     printEntities(os);
@@ -8,8 +8,11 @@
 #define RODIN_IO_MEDIT_H
 
 #include <iomanip>
+#include <string_view>
 #include <boost/bimap.hpp>
 #include <boost/spirit/home/x3.hpp>
+#include <boost/filesystem/path.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
 
 #include "Rodin/Types.h"
 #include "Rodin/Alert.h"
@@ -503,6 +506,341 @@ namespace Rodin::IO::MEDIT
       return {};
     }
   };
+
+  /**
+   * @brief Read-only memory mapping of a MEDIT file.
+   */
+  class MappedFile
+  {
+    public:
+      MappedFile(const boost::filesystem::path& filename);
+
+      const char* begin() const
+      {
+        return m_begin;
+      }
+
+      const char* end() const
+      {
+        return m_end;
+      }
+
+    private:
+      boost::iostreams::mapped_file_source m_file;
+      const char* m_begin;
+      const char* m_end;
+  };
+
+  /**
+   * @brief Forward cursor over the contents of a MEDIT file held in memory.
+   *
+   * Keeps track of the current line number so that parsing errors can be
+   * reported in the same way as the stream based loaders.
+   */
+  class Cursor
+  {
+    public:
+      Cursor(const char* begin, const char* end, size_t line = 1)
+        : m_it(begin), m_end(end), m_line(line)
+      {}
+
+      /**
+       * @brief Skips whitespace, empty lines and comments.
+       * @returns False if the end of the buffer was reached.
+       */
+      bool skipWhitespace();
+
+      /**
+       * @brief Moves the cursor to the beginning of the next line.
+       */
+      void skipLine();
+
+      /**
+       * @brief Skips the blanks on the current line.
+       * @returns True if nothing but blanks or a comment remain on the line.
+       */
+      bool isEndOfLine();
+
+      std::optional<std::string_view> getKeyword();
+
+      std::optional<size_t> getUnsignedInteger();
+
+      std::optional<Rodin::Real> getReal();
+
+      const char* getPosition() const
+      {
+        return m_it;
+      }
+
+      size_t getLineNumber() const
+      {
+        return m_line;
+      }
+
+      bool end() const
+      {
+        return m_it == m_end;
+      }
+
+    private:
+      const char* m_it;
+      const char* m_end;
+      size_t m_line;
+  };
+
+  /**
+   * @brief Parses the first @p count whitespace separated real numbers of
+   * [begin, end) into @p out.
+   *
+   * The buffer is split into chunks at whitespace boundaries. The numbers
+   * in each chunk are counted and then parsed in parallel.
+   *
+   * @returns True if @p count numbers could be parsed.
+   */
+  bool parseReals(const char* begin, const char* end, Rodin::Real* out, size_t count);
+
+  /**
+   * @brief Gets the code which identifies the keyword in the binary
+   * encoding.
+   */
+  inline
+  constexpr
+  int toBinaryCode(Keyword kw)
+  {
+    switch (kw)
+    {
+      case Keyword::MeshVersionFormatted:
+        return 1;
+      case Keyword::Dimension:
+        return 3;
+      case Keyword::Vertices:
+        return 4;
+      case Keyword::Edges:
+        return 5;
+      case Keyword::Triangles:
+        return 6;
+      case Keyword::Quadrilaterals:
+        return 7;
+      case Keyword::Tetrahedra:
+        return 8;
+      case Keyword::Corners:
+        return 13;
+      case Keyword::Ridges:
+        return 14;
+      case Keyword::RequiredVertices:
+        return 15;
+      case Keyword::RequiredEdges:
+        return 16;
+      case Keyword::NormalAtVertices:
+        return 20;
+      case Keyword::End:
+        return 54;
+      case Keyword::Tangents:
+        return 59;
+      case Keyword::Normals:
+        return 60;
+      case Keyword::TangentAtVertices:
+        return 61;
+      case Keyword::SolAtVertices:
+        return 62;
+      case Keyword::SolAtEdges:
+        return 63;
+      case Keyword::SolAtTriangles:
+        return 64;
+      case Keyword::SolAtQuadrilaterals:
+        return 65;
+      case Keyword::SolAtTetrahedra:
+        return 66;
+      case Keyword::SolAtPentahedra:
+        return 67;
+      case Keyword::SolAtHexahedra:
+        return 68;
+    }
+    return 0;
+  }
+
+  inline
+  std::optional<Keyword> fromBinaryCode(int code)
+  {
+    for (int i = 0; i <= static_cast<int>(Keyword::End); i++)
+    {
+      const Keyword kw = static_cast<Keyword>(i);
+      if (toBinaryCode(kw) == code)
+        return kw;
+    }
+    return {};
+  }
+
+  /**
+   * @brief Reader for the binary encoding of MEDIT files.
+   *
+   * The version stored in the header determines the width of the fields.
+   * Version 1 stores reals as 32-bit floats and version 2 as 64-bit floats.
+   * Version 3 also stores the keyword positions on 64 bits, and version 4
+   * stores the integers on 64 bits as well. Files written on a machine of
+   * different endianness are detected from the header and byte swapped.
+   *
+   * All the reads take an absolute offset into the buffer so that distinct
+   * blocks may be read concurrently.
+   */
+  class BinaryReader
+  {
+    public:
+      /**
+       * @brief Checks the header of the buffer [begin, end).
+       * @returns A reader if the buffer holds a binary MEDIT file.
+       */
+      static std::optional<BinaryReader> open(const char* begin, const char* end);
+
+      size_t getVersion() const
+      {
+        return m_version;
+      }
+
+      size_t getSize() const
+      {
+        return m_size;
+      }
+
+      bool isByteSwapped() const
+      {
+        return m_swap;
+      }
+
+      size_t getRealSize() const
+      {
+        return m_version == 1 ? 4 : 8;
+      }
+
+      size_t getIntegerSize() const
+      {
+        return m_version >= 4 ? 8 : 4;
+      }
+
+      size_t getPositionSize() const
+      {
+        return m_version >= 3 ? 8 : 4;
+      }
+
+      /**
+       * @brief Offset of the first keyword.
+       */
+      size_t getHeaderSize() const
+      {
+        return 8;
+      }
+
+      int32_t readWord(size_t offset) const;
+
+      int64_t readInteger(size_t offset) const;
+
+      uint64_t readPosition(size_t offset) const;
+
+      Rodin::Real readReal(size_t offset) const;
+
+      /**
+       * @brief Reads @p count consecutive reals starting at @p offset.
+       *
+       * Copies the whole block at once when the file stores native 64-bit
+       * floats.
+       */
+      void readReals(size_t offset, Rodin::Real* out, size_t count) const;
+
+    private:
+      BinaryReader(const char* data, size_t size, size_t version, bool swap)
+        : m_data(data), m_size(size), m_version(version), m_swap(swap)
+      {}
+
+      const char* m_data;
+      size_t m_size;
+      size_t m_version;
+      bool m_swap;
+  };
+
+  /**
+   * @brief Buffered writer for the binary encoding of MEDIT files.
+   *
+   * Fields are accumulated in a buffer which is written to the stream in
+   * large blocks.
+   */
+  class BinaryWriter
+  {
+    public:
+      static constexpr size_t BufferSize = 1 << 24;
+
+      /**
+       * @brief Gets the lowest version able to store a file of @p size
+       * bytes whose integers are all smaller than @p integer.
+       */
+      static size_t getVersion(size_t size, size_t integer);
+
+      BinaryWriter(std::ostream& os, size_t version);
+
+      BinaryWriter(const BinaryWriter&) = delete;
+
+      size_t getVersion() const
+      {
+        return m_version;
+      }
+
+      size_t getRealSize() const
+      {
+        return 8;
+      }
+
+      size_t getIntegerSize() const
+      {
+        return m_version >= 4 ? 8 : 4;
+      }
+
+      size_t getPositionSize() const
+      {
+        return m_version >= 3 ? 8 : 4;
+      }
+
+      /**
+       * @brief Number of bytes written so far, including those which are
+       * still buffered.
+       */
+      size_t getOffset() const
+      {
+        return m_offset + m_buffer.size();
+      }
+
+      BinaryWriter& writeHeader();
+
+      /**
+       * @brief Writes the keyword code followed by the position of the next
+       * keyword, where @p size is the number of bytes which follow the
+       * position.
+       */
+      BinaryWriter& writeKeyword(Keyword kw, size_t size);
+
+      BinaryWriter& writeWord(int32_t v);
+
+      BinaryWriter& writeInteger(int64_t v);
+
+      BinaryWriter& writeReal(Rodin::Real v);
+
+      BinaryWriter& writeReals(const Rodin::Real* data, size_t count);
+
+      BinaryWriter& flush();
+
+    private:
+      template <class T>
+      void append(const T& v)
+      {
+        const char* p = reinterpret_cast<const char*>(&v);
+        m_buffer.insert(m_buffer.end(), p, p + sizeof(T));
+        if (m_buffer.size() >= BufferSize)
+          flush();
+      }
+
+      std::ostream& m_os;
+      size_t m_version;
+      size_t m_offset;
+      std::vector<char> m_buffer;
+  };
 }
 
 namespace Rodin::IO
@@ -531,6 +869,15 @@ namespace Rodin::IO
 
       void load(std::istream& is) override;
 
+      /**
+       * @brief Loads the mesh from a memory-mapped file.
+       *
+       * The file is scanned once to locate each section, after which the
+       * entities of every section are parsed in parallel chunks directly
+       * into the vertex and connectivity arrays.
+       */
+      void load(const boost::filesystem::path& filename) override;
+
       std::istream& getline(std::istream& is, std::string& line);
       std::string skipEmptyLines(std::istream& is);
       void readVersion(std::istream& is);
@@ -558,6 +905,8 @@ namespace Rodin::IO
       }
 
     private:
+      void readBinary(const MEDIT::BinaryReader& reader);
+
       Rodin::Geometry::Mesh<Rodin::Context::Local>::Builder m_build;
 
       size_t m_version;
@@ -580,9 +929,22 @@ namespace Rodin::IO
       using Parent = MeshPrinterBase<ContextType>;
 
       MeshPrinter(const ObjectType& mesh)
-        : MeshPrinterBase(mesh)
+        : MeshPrinterBase(mesh),
+          m_encoding(MEDIT::Encoding::ASCII)
       {}
 
+      /**
+       * @brief Sets the encoding of the printed mesh.
+       *
+       * The binary encoding corresponds to the .meshb files. The stream
+       * should then be opened in binary mode.
+       */
+      MeshPrinter& setEncoding(MEDIT::Encoding encoding)
+      {
+        m_encoding = encoding;
+        return *this;
+      }
+
       void print(std::ostream& os) override
       {
         print(os, true);
@@ -594,6 +956,11 @@ namespace Rodin::IO
       void printDimension(std::ostream& os);
       void printEntities(std::ostream& os);
       void printEnd(std::ostream& os);
+
+      void printBinary(std::ostream& os, bool printEnd);
+
+    private:
+      MEDIT::Encoding m_encoding;
   };
 
   template <class Range>
@@ -616,6 +983,12 @@ namespace Rodin::IO
 
       void load(std::istream& is) override;
 
+      /**
+       * @brief Loads the solution from a memory-mapped file, parsing the
+       * values in parallel chunks.
+       */
+      void load(const boost::filesystem::path& filename) override;
+
       std::istream& getline(std::istream& is, std::string& line);
       std::string skipEmptyLines(std::istream& is);
 
@@ -624,6 +997,8 @@ namespace Rodin::IO
       void readData(std::istream& is);
 
     private:
+      void readBinary(const MEDIT::BinaryReader& reader);
+
       size_t m_version;
       size_t m_spaceDimension;
       size_t m_currentLineNumber;
@@ -641,11 +1016,29 @@ namespace Rodin::IO
       using Parent = GridFunctionPrinterBase<FESType>;
 
       GridFunctionPrinter(const ObjectType& gf)
-        : Parent(gf)
+        : Parent(gf),
+          m_encoding(MEDIT::Encoding::ASCII)
       {}
 
+      /**
+       * @brief Sets the encoding of the printed solution.
+       *
+       * The binary encoding corresponds to the .solb files. The stream
+       * should then be opened in binary mode.
+       */
+      GridFunctionPrinter& setEncoding(MEDIT::Encoding encoding)
+      {
+        m_encoding = encoding;
+        return *this;
+      }
+
       void print(std::ostream& os) override
       {
+        if (m_encoding == MEDIT::Encoding::Binary)
+        {
+          printBinary(os);
+          return;
+        }
         printVersion(os);
         printDimension(os);
         printData(os);
@@ -698,6 +1091,68 @@ namespace Rodin::IO
       {
         os << '\n' << IO::MEDIT::Keyword::End;
       }
+
+      void printBinary(std::ostream& os)
+      {
+        const auto& gf = this->getObject();
+        const auto& fes = gf.getFiniteElementSpace();
+        const auto& mesh = fes.getMesh();
+        const size_t vdim = fes.getVectorDimension();
+        const size_t count = mesh.getVertexCount();
+
+        // Same values as in the ASCII encoding
+        size_t values = count * vdim;
+        if constexpr (Utility::IsSpecialization<FES, Variational::P1>::Value)
+        {
+          assert(gf.getData().size() >= 0);
+          values = gf.getData().size();
+        }
+
+        const size_t block = 8 + 2 * 4 + values * 8;
+        MEDIT::BinaryWriter out(os, MEDIT::BinaryWriter::getVersion(64 + block, count));
+        const size_t integerSize = out.getIntegerSize();
+
+        out.writeHeader();
+        out.writeKeyword(MEDIT::Keyword::Dimension, 4);
+        out.writeWord(mesh.getSpaceDimension());
+
+        out.writeKeyword(MEDIT::Keyword::SolAtVertices,
+            integerSize + 2 * 4 + values * out.getRealSize());
+        out.writeInteger(count);
+        out.writeWord(1); // Only one solution
+        out.writeWord((vdim > 1) ? MEDIT::SolutionType::Vector : MEDIT::SolutionType::Real);
+
+        if constexpr (Utility::IsSpecialization<FES, Variational::P1>::Value)
+        {
+          const auto& data = gf.getData();
+          out.writeReals(data.data(), values);
+        }
+        else
+        {
+          for (auto it = mesh.getVertex(); !it.end(); ++it)
+          {
+            const Geometry::Point p(*it, it->getTransformation(),
+                Geometry::Polytope::getVertices(Geometry::Polytope::Type::Point).col(0),
+                it->getCoordinates());
+            const auto v = gf(p);
+            if constexpr (std::is_arithmetic_v<std::decay_t<decltype(v)>>)
+            {
+              out.writeReal(v);
+            }
+            else
+            {
+              for (size_t i = 0; i < vdim; i++)
+                out.writeReal(v(i));
+            }
+          }
+        }
+
+        out.writeKeyword(MEDIT::Keyword::End, 0);
+        out.flush();
+      }
+
+    private:
+      MEDIT::Encoding m_encoding;
   };
 }
 
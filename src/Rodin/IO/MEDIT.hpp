@@ -18,11 +18,146 @@ namespace Rodin::IO
     Variational::P1<Range, Geometry::Mesh<Context::Local>>>
   ::load(std::istream& is)
   {
+    // Binary files start with the integer 1, in either byte order
+    const auto c = is.peek();
+    if (c == 0 || c == 1)
+    {
+      const std::string buffer{ std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>() };
+      const auto reader = MEDIT::BinaryReader::open(buffer.data(), buffer.data() + buffer.size());
+      if (!reader)
+        Alert::Exception() << "Failed to read the header of the binary solution." << Alert::Raise;
+      readBinary(*reader);
+      return;
+    }
     readVersion(is);
     readDimension(is);
     readData(is);
   }
 
+  template <class Range>
+  void GridFunctionLoader<FileFormat::MEDIT,
+    Variational::P1<Range, Geometry::Mesh<Context::Local>>>
+  ::load(const boost::filesystem::path& filename)
+  {
+    auto& gf = this->getObject();
+
+    const MEDIT::MappedFile file(filename);
+    if (const auto reader = MEDIT::BinaryReader::open(file.begin(), file.end()))
+    {
+      readBinary(*reader);
+      return;
+    }
+
+    MEDIT::Cursor cursor(file.begin(), file.end());
+
+    const auto expect =
+      [&](MEDIT::Keyword expected)
+      {
+        cursor.skipWhitespace();
+        const auto kw = cursor.getKeyword();
+        if (!kw || *kw != MEDIT::toCharString(expected))
+        {
+          Alert::Exception() << "Expected keyword " << expected
+                             << " on line " << cursor.getLineNumber()
+                             << Alert::Raise;
+        }
+      };
+
+    const auto read =
+      [&](const char* what) -> size_t
+      {
+        cursor.skipWhitespace();
+        const auto value = cursor.getUnsignedInteger();
+        if (!value)
+        {
+          Alert::Exception() << "Failed to parse " << what << " at line "
+                             << cursor.getLineNumber()
+                             << Alert::Raise;
+        }
+        return *value;
+      };
+
+    expect(MEDIT::Keyword::MeshVersionFormatted);
+    m_version = read("version number");
+    expect(MEDIT::Keyword::Dimension);
+    m_spaceDimension = read("dimension");
+    expect(MEDIT::Keyword::SolAtVertices);
+    const size_t size = read("solution size");
+    const size_t solCount = read("solution count");
+    read("solution type");
+    assert(solCount == 1);
+
+    auto& data = gf.getData();
+    assert(data.size() >= 0);
+    assert(static_cast<size_t>(data.size()) % size == 0);
+    if (!MEDIT::parseReals(cursor.getPosition(), file.end(), data.data(), data.size()))
+    {
+      Alert::Exception() << "Failed to parse solution values after line "
+                         << cursor.getLineNumber()
+                         << Alert::Raise;
+    }
+    gf.setWeights();
+  }
+
+  template <class Range>
+  void GridFunctionLoader<FileFormat::MEDIT,
+    Variational::P1<Range, Geometry::Mesh<Context::Local>>>
+  ::readBinary(const MEDIT::BinaryReader& reader)
+  {
+    auto& gf = this->getObject();
+    auto& data = gf.getData();
+    m_version = reader.getVersion();
+
+    const size_t integerSize = reader.getIntegerSize();
+    size_t pos = reader.getHeaderSize();
+    while (pos + 4 <= reader.getSize())
+    {
+      const size_t start = pos;
+      const auto kw = MEDIT::fromBinaryCode(reader.readWord(pos));
+      if (kw && *kw == MEDIT::Keyword::End)
+        break;
+      pos += 4;
+      if (pos + reader.getPositionSize() > reader.getSize())
+        break;
+      const size_t next = reader.readPosition(pos);
+      pos += reader.getPositionSize();
+
+      if (kw == MEDIT::Keyword::Dimension)
+      {
+        m_spaceDimension = reader.readWord(pos);
+      }
+      else if (kw == MEDIT::Keyword::SolAtVertices)
+      {
+        const size_t size = reader.readInteger(pos);
+        pos += integerSize;
+        const size_t solCount = reader.readWord(pos);
+        pos += 4;
+        assert(solCount == 1);
+        pos += 4 * solCount; // Solution types
+
+        assert(data.size() >= 0);
+        assert(static_cast<size_t>(data.size()) % size == 0);
+        if (pos + data.size() * reader.getRealSize() > reader.getSize())
+        {
+          Alert::Exception() << "Unexpected end of file while reading "
+                             << MEDIT::Keyword::SolAtVertices << "."
+                             << Alert::Raise;
+        }
+        reader.readReals(pos, data.data(), data.size());
+        gf.setWeights();
+        return;
+      }
+
+      if (next <= start)
+        break;
+      pos = next;
+    }
+
+    Alert::Exception() << "Expected keyword " << MEDIT::Keyword::SolAtVertices
+                       << " in binary solution."
+                       << Alert::Raise;
+  }
+
   template <class Range>
   std::istream& GridFunctionLoader<FileFormat::MEDIT,
     Variational::P1<Range, Geometry::Mesh<Context::Local>>>
@@ -0,0 +1,475 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <charconv>
+#include <sstream>
+#include <fstream>
+#include <hdf5.h>
+#include <boost/filesystem/operations.hpp>
+
+#include "Rodin/Alert.h"
+
+#include "XDMF.h"
+
+namespace Rodin::IO
+{
+  static_assert(std::is_same_v<hid_t, int64_t>);
+
+  namespace
+  {
+    /**
+     * Writes a dataset at the given path of the HDF5 file, creating the
+     * intermediate groups.
+     */
+    void writeDataset(hid_t file, const std::string& path, hid_t fileType, hid_t memoryType,
+        const std::vector<hsize_t>& dimensions, const void* data)
+    {
+      const hid_t lcpl = H5Pcreate(H5P_LINK_CREATE);
+      H5Pset_create_intermediate_group(lcpl, 1);
+      const hid_t space = H5Screate_simple(dimensions.size(), dimensions.data(), nullptr);
+      const hid_t dataset =
+        H5Dcreate2(file, path.c_str(), fileType, space, lcpl, H5P_DEFAULT, H5P_DEFAULT);
+      herr_t status = dataset < 0 ? -1 : 0;
+      const bool empty =
+        std::find(dimensions.begin(), dimensions.end(), 0) != dimensions.end();
+      if (status >= 0 && !empty)
+        status = H5Dwrite(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data);
+      if (dataset >= 0)
+        H5Dclose(dataset);
+      H5Sclose(space);
+      H5Pclose(lcpl);
+      if (status < 0)
+      {
+        Alert::Exception()
+          << "Failed to write dataset " << path << "."
+          << Alert::Raise;
+      }
+    }
+
+    std::string escape(const std::string& str)
+    {
+      std::string res;
+      res.reserve(str.size());
+      for (const char c : str)
+      {
+        switch (c)
+        {
+          case '&':
+            res += "&amp;";
+            break;
+          case '<':
+            res += "&lt;";
+            break;
+          case '>':
+            res += "&gt;";
+            break;
+          case '"':
+            res += "&quot;";
+            break;
+          default:
+            res += c;
+        }
+      }
+      return res;
+    }
+
+    void printDataItem(std::ostream& os, const std::string& dimensions,
+        const char* numberType, const std::string& h5filename, const std::string& path)
+    {
+      os << "          <DataItem Dimensions=\"" << dimensions
+         << "\" NumberType=\"" << numberType
+         << "\" Precision=\"8\" Format=\"HDF\">"
+         << escape(h5filename) << ':' << escape(path) << "</DataItem>\n";
+    }
+
+    /**
+     * Gets the number of components of a field as stored in the file. Two
+     * dimensional vectors are padded with a zero, since XDMF vectors have
+     * three components.
+     */
+    size_t getComponentCount(size_t vdim)
+    {
+      return vdim == 2 ? 3 : vdim;
+    }
+
+    const char* getAttributeType(size_t vdim)
+    {
+      if (vdim == 1)
+        return "Scalar";
+      else if (vdim <= 3)
+        return "Vector";
+      else
+        return "Matrix";
+    }
+
+    const char* getTopologyType(Geometry::Polytope::Type g)
+    {
+      switch (g)
+      {
+        case Geometry::Polytope::Type::Point:
+          return "Polyvertex";
+        case Geometry::Polytope::Type::Segment:
+          return "Polyline";
+        case Geometry::Polytope::Type::Triangle:
+          return "Triangle";
+        case Geometry::Polytope::Type::Quadrilateral:
+          return "Quadrilateral";
+        case Geometry::Polytope::Type::Tetrahedron:
+          return "Tetrahedron";
+        case Geometry::Polytope::Type::TriangularPrism:
+          return "Wedge";
+      }
+      return nullptr;
+    }
+
+    /**
+     * Gets the code of the geometry in a mixed XDMF topology.
+     */
+    int64_t getTopologyCode(Geometry::Polytope::Type g)
+    {
+      switch (g)
+      {
+        case Geometry::Polytope::Type::Point:
+          return 1;
+        case Geometry::Polytope::Type::Segment:
+          return 2;
+        case Geometry::Polytope::Type::Triangle:
+          return 4;
+        case Geometry::Polytope::Type::Quadrilateral:
+          return 5;
+        case Geometry::Polytope::Type::Tetrahedron:
+          return 6;
+        case Geometry::Polytope::Type::TriangularPrism:
+          return 8;
+      }
+      return 0;
+    }
+  }
+
+  bool XDMF::MeshData::operator==(const MeshData& other) const
+  {
+    return sdim == other.sdim
+      && vertexCount == other.vertexCount
+      && topologyType == other.topologyType
+      && cellCount == other.cellCount
+      && nodesPerElement == other.nodesPerElement
+      && vertices == other.vertices
+      && topology == other.topology
+      && attributes == other.attributes;
+  }
+
+  XDMF::XDMF(const boost::filesystem::path& filename, size_t capacity)
+    : m_filename(filename),
+      m_h5filename(boost::filesystem::path(filename).replace_extension(".h5")),
+      m_file(-1),
+      m_stepCount(0),
+      m_meshCount(0),
+      m_queue(capacity)
+  {
+    m_file = H5Fcreate(m_h5filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if (m_file < 0)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to create " << m_h5filename << "."
+        << Alert::Raise;
+    }
+    writeIndex(m_grids);
+  }
+
+  XDMF::~XDMF()
+  {
+    m_queue.wait();
+    if (m_file >= 0)
+      H5Fclose(m_file);
+  }
+
+  XDMF& XDMF::setMesh(const Geometry::Mesh<Context::Local>& mesh)
+  {
+    m_mesh = std::cref(mesh);
+    return *this;
+  }
+
+  XDMF& XDMF::write(Real time)
+  {
+    {
+      std::lock_guard lock(m_mutex);
+      if (m_error)
+        std::rethrow_exception(std::exchange(m_error, nullptr));
+    }
+
+    if (!m_mesh)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "No mesh was set."
+        << Alert::Raise;
+    }
+
+    Step step;
+    step.time = time;
+    step.index = m_stepCount;
+
+    std::shared_ptr<const MeshData> mesh = snapshot(m_mesh->get());
+    step.fields.reserve(m_fields.size());
+    for (const auto& field : m_fields)
+    {
+      auto& f = step.fields.emplace_back(field());
+      const size_t count = f.center == Center::Node ? mesh->vertexCount : mesh->cellCount;
+      if (f.values.size() != count * f.vdim)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Field \"" << f.name << "\" has " << f.values.size()
+          << " values but " << count * f.vdim << " were expected. "
+          << "The grid function should be defined on the mesh of the time series."
+          << Alert::Raise;
+      }
+    }
+
+    if (m_lastMesh && *m_lastMesh == *mesh)
+    {
+      step.mesh = m_lastMesh;
+      step.meshIndex = m_meshCount - 1;
+      step.writeMesh = false;
+    }
+    else
+    {
+      m_lastMesh = std::move(mesh);
+      step.mesh = m_lastMesh;
+      step.meshIndex = m_meshCount++;
+      step.writeMesh = true;
+    }
+
+    m_queue.push(
+        [this, step = std::move(step)]()
+        {
+          // Steps following a failed step are dropped
+          {
+            std::lock_guard lock(m_mutex);
+            if (m_error)
+              return;
+          }
+          try
+          {
+            writeStep(step);
+          }
+          catch (...)
+          {
+            std::lock_guard lock(m_mutex);
+            m_error = std::current_exception();
+          }
+        });
+    m_stepCount++;
+    return *this;
+  }
+
+  XDMF& XDMF::flush()
+  {
+    m_queue.wait();
+    std::lock_guard lock(m_mutex);
+    if (m_error)
+      std::rethrow_exception(std::exchange(m_error, nullptr));
+    return *this;
+  }
+
+  void XDMF::checkName(const std::string& name)
+  {
+    if (name.empty() || name.find('/') != std::string::npos)
+    {
+      Alert::Exception()
+        << "Invalid field name \"" << name << "\"."
+        << Alert::Raise;
+    }
+  }
+
+  std::shared_ptr<XDMF::MeshData> XDMF::snapshot(const Geometry::Mesh<Context::Local>& mesh)
+  {
+    auto res = std::make_shared<MeshData>();
+
+    // The vertex matrix is stored column major, which is the row major
+    // layout of the vertexCount x sdim dataset. XDMF has no one dimensional
+    // geometry, so one dimensional vertices are padded with a zero.
+    const auto& vertices = mesh.getVertices();
+    res->sdim = std::max<size_t>(mesh.getSpaceDimension(), 2);
+    res->vertexCount = mesh.getVertexCount();
+    if (res->sdim == mesh.getSpaceDimension())
+    {
+      res->vertices.assign(vertices.data(), vertices.data() + vertices.size());
+    }
+    else
+    {
+      res->vertices.resize(res->sdim * res->vertexCount, 0);
+      for (size_t i = 0; i < res->vertexCount; i++)
+        res->vertices[i * res->sdim] = vertices(0, i);
+    }
+
+    const size_t d = mesh.getDimension();
+    const auto& conn = mesh.getConnectivity();
+    res->cellCount = mesh.getCellCount();
+    res->attributes.resize(res->cellCount);
+
+    bool mixed = false;
+    for (size_t i = 1; i < res->cellCount && !mixed; i++)
+      mixed = mesh.getGeometry(d, i) != mesh.getGeometry(d, 0);
+
+    if (res->cellCount == 0)
+    {
+      res->topologyType = "Polyvertex";
+      res->nodesPerElement = 1;
+    }
+    else if (mixed)
+    {
+      res->topologyType = "Mixed";
+      res->nodesPerElement = 0;
+    }
+    else
+    {
+      const auto g = mesh.getGeometry(d, 0);
+      res->topologyType = getTopologyType(g);
+      res->nodesPerElement = Geometry::Polytope::getVertexCount(g);
+      res->topology.reserve(res->cellCount * res->nodesPerElement);
+    }
+
+    for (size_t i = 0; i < res->cellCount; i++)
+    {
+      const auto g = mesh.getGeometry(d, i);
+      const auto& vertices = conn.getPolytope(d, i);
+      if (mixed)
+      {
+        res->topology.push_back(getTopologyCode(g));
+        if (g == Geometry::Polytope::Type::Point || g == Geometry::Polytope::Type::Segment)
+          res->topology.push_back(vertices.size());
+      }
+      const size_t offset = res->topology.size();
+      res->topology.insert(res->topology.end(), vertices.begin(), vertices.end());
+
+      // Rodin orders the vertices of a quadrilateral as a tensor product
+      if (g == Geometry::Polytope::Type::Quadrilateral)
+        std::swap(res->topology[offset + 2], res->topology[offset + 3]);
+
+      res->attributes[i] = mesh.getAttribute(d, i);
+    }
+    return res;
+  }
+
+  void XDMF::writeStep(const Step& step)
+  {
+    const auto& mesh = *step.mesh;
+    const std::string h5filename = m_h5filename.filename().string();
+    const std::string meshPath = "/Mesh/" + std::to_string(step.meshIndex);
+    const bool mixed = mesh.topologyType == "Mixed";
+
+    const std::vector<hsize_t> topologyDimensions =
+      mixed ? std::vector<hsize_t>{ mesh.topology.size() }
+            : std::vector<hsize_t>{ mesh.cellCount, mesh.nodesPerElement };
+    if (step.writeMesh)
+    {
+      writeDataset(m_file, meshPath + "/Geometry", H5T_IEEE_F64LE, H5T_NATIVE_DOUBLE,
+          { mesh.vertexCount, mesh.sdim }, mesh.vertices.data());
+      writeDataset(m_file, meshPath + "/Topology", H5T_STD_I64LE, H5T_NATIVE_INT64,
+          topologyDimensions, mesh.topology.data());
+      writeDataset(m_file, meshPath + "/Attribute", H5T_STD_I64LE, H5T_NATIVE_INT64,
+          { mesh.cellCount }, mesh.attributes.data());
+    }
+
+    const std::string stepPath = "/Step/" + std::to_string(step.index);
+    std::vector<Real> padded;
+    for (const auto& f : step.fields)
+    {
+      const size_t count = f.values.size() / f.vdim;
+      const size_t components = getComponentCount(f.vdim);
+      const Real* data = f.values.data();
+      if (components != f.vdim)
+      {
+        padded.assign(count * components, 0);
+        for (size_t i = 0; i < count; i++)
+          std::copy_n(f.values.begin() + i * f.vdim, f.vdim, padded.begin() + i * components);
+        data = padded.data();
+      }
+      writeDataset(m_file, stepPath + "/" + f.name, H5T_IEEE_F64LE, H5T_NATIVE_DOUBLE,
+          { count, components }, data);
+    }
+
+    if (H5Fflush(m_file, H5F_SCOPE_LOCAL) < 0)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to flush " << m_h5filename << "."
+        << Alert::Raise;
+    }
+
+    // Shortest representation which reads back to the same time
+    std::array<char, 32> time;
+    const auto r = std::to_chars(time.begin(), time.end(), step.time);
+
+    std::ostringstream os;
+    os << "      <Grid Name=\"Step" << step.index << "\" GridType=\"Uniform\">\n"
+       << "        <Time Value=\"" << std::string_view(time.data(), r.ptr - time.data()) << "\"/>\n"
+       << "        <Topology TopologyType=\"" << mesh.topologyType
+       << "\" NumberOfElements=\"" << mesh.cellCount << '"';
+    if (!mixed)
+      os << " NodesPerElement=\"" << mesh.nodesPerElement << '"';
+    os << ">\n";
+    printDataItem(os,
+        mixed ? std::to_string(mesh.topology.size())
+              : std::to_string(mesh.cellCount) + " " + std::to_string(mesh.nodesPerElement),
+        "Int", h5filename, meshPath + "/Topology");
+    os << "        </Topology>\n"
+       << "        <Geometry GeometryType=\"" << (mesh.sdim == 2 ? "XY" : "XYZ") << "\">\n";
+    printDataItem(os,
+        std::to_string(mesh.vertexCount) + " " + std::to_string(mesh.sdim),
+        "Float", h5filename, meshPath + "/Geometry");
+    os << "        </Geometry>\n"
+       << "        <Attribute Name=\"attribute\" AttributeType=\"Scalar\" Center=\"Cell\">\n";
+    printDataItem(os, std::to_string(mesh.cellCount), "Int", h5filename, meshPath + "/Attribute");
+    os << "        </Attribute>\n";
+    for (const auto& f : step.fields)
+    {
+      const size_t count = f.values.size() / f.vdim;
+      const size_t components = getComponentCount(f.vdim);
+      os << "        <Attribute Name=\"" << escape(f.name)
+         << "\" AttributeType=\"" << getAttributeType(f.vdim)
+         << "\" Center=\"" << (f.center == Center::Node ? "Node" : "Cell") << "\">\n";
+      printDataItem(os,
+          std::to_string(count) + " " + std::to_string(components),
+          "Float", h5filename, stepPath + "/" + f.name);
+      os << "        </Attribute>\n";
+    }
+    os << "      </Grid>\n";
+
+    m_grids += os.str();
+    writeIndex(m_grids);
+  }
+
+  void XDMF::writeIndex(const std::string& grids)
+  {
+    // Write to a temporary file which replaces the index, so that readers
+    // never see a partially written index.
+    const boost::filesystem::path tmp = boost::filesystem::path(m_filename) += ".tmp";
+    {
+      std::ofstream os(tmp.c_str());
+      os << "<?xml version=\"1.0\"?>\n"
+         << "<Xdmf Version=\"3.0\">\n"
+         << "  <Domain>\n"
+         << "    <Grid Name=\"TimeSeries\" GridType=\"Collection\" CollectionType=\"Temporal\">\n"
+         << grids
+         << "    </Grid>\n"
+         << "  </Domain>\n"
+         << "</Xdmf>\n";
+      if (!os)
+      {
+        Alert::MemberFunctionException(*this, __func__)
+          << "Failed to write " << tmp << "."
+          << Alert::Raise;
+      }
+    }
+    boost::system::error_code ec;
+    boost::filesystem::rename(tmp, m_filename, ec);
+    if (ec)
+    {
+      Alert::MemberFunctionException(*this, __func__)
+        << "Failed to write " << m_filename << ": " << ec.message() << "."
+        << Alert::Raise;
+    }
+  }
+}
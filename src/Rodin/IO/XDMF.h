@@ -0,0 +1,267 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2022.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_IO_XDMF_H
+#define RODIN_IO_XDMF_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <boost/filesystem/path.hpp>
+
+#include "Rodin/Configure.h"
+
+#ifndef RODIN_USE_HDF5
+#error "Rodin/IO/XDMF.h requires Rodin to be built with RODIN_USE_HDF5."
+#endif
+
+#include "Rodin/Types.h"
+#include "Rodin/Context.h"
+#include "Rodin/Threads/TaskQueue.h"
+#include "Rodin/Geometry/Mesh.h"
+#include "Rodin/Geometry/Point.h"
+#include "Rodin/Geometry/Polytope.h"
+#include "Rodin/Variational/ForwardDecls.h"
+#include "Rodin/Variational/P0/ForwardDecls.h"
+#include "Rodin/Variational/P1/ForwardDecls.h"
+#include "Rodin/Utility/IsSpecialization.h"
+
+#include "ForwardDecls.h"
+
+namespace Rodin::IO
+{
+  /**
+   * @brief Writes a time series of a mesh and of grid functions defined on
+   * it in the XDMF format.
+   *
+   * The heavy data is stored as binary datasets in an HDF5 file next to the
+   * XDMF index: writing to `Output.xdmf` also creates `Output.h5`. Each call
+   * to write() takes a snapshot of the mesh and of the registered grid
+   * functions, and hands it to a background thread which appends the
+   * datasets to the HDF5 file and rewrites the index, so that the files
+   * are readable after every step.
+   *
+   * The mesh is written at the first step and only written again if its
+   * vertices, cells or cell attributes have changed. The cell attributes are
+   * written as the `attribute` cell field.
+   *
+   * @code{.cpp}
+   * IO::XDMF xdmf("Output.xdmf");
+   * xdmf.setMesh(mesh).add("u", u);
+   * for (size_t i = 0; i < n; i++)
+   * {
+   *   // Compute u at time t
+   *   xdmf.write(t);
+   * }
+   * @endcode
+   */
+  class XDMF
+  {
+    public:
+      /**
+       * @brief Where the values of a field are located.
+       */
+      enum class Center
+      {
+        Node, ///< One value per vertex
+        Cell  ///< One value per cell
+      };
+
+      /**
+       * @brief Snapshot of the values of a field at a step.
+       *
+       * The values are stored contiguously per vertex or per cell.
+       */
+      struct Field
+      {
+        std::string name;
+        Center center;
+        size_t vdim;
+        std::vector<Real> values;
+      };
+
+      /**
+       * @brief Creates the XDMF index and its HDF5 file, truncating
+       * existing files.
+       * @param[in] filename Path of the XDMF index
+       * @param[in] capacity Number of steps which may be pending before
+       * write() blocks
+       */
+      XDMF(const boost::filesystem::path& filename, size_t capacity = 2);
+
+      XDMF(const XDMF&) = delete;
+
+      XDMF& operator=(const XDMF&) = delete;
+
+      /**
+       * @brief Writes the pending steps and closes the files.
+       */
+      ~XDMF();
+
+      /**
+       * @brief Sets the mesh of the time series.
+       *
+       * Only a reference to the mesh is kept. It is read at every call to
+       * write().
+       */
+      XDMF& setMesh(const Geometry::Mesh<Context::Local>& mesh);
+
+      /**
+       * @brief Registers a grid function written at every step.
+       *
+       * Only a reference to the grid function is kept. P1 functions are
+       * written at the vertices and P0 functions at the cells. Other
+       * functions are evaluated at the vertices.
+       *
+       * @param[in] name Name of the field, which may not contain '/'.
+       * @param[in] gf Grid function defined on the mesh of the time series
+       */
+      template <class FES>
+      XDMF& add(const std::string& name, const Variational::GridFunction<FES>& gf)
+      {
+        using GridFunctionType = Variational::GridFunction<FES>;
+        static_assert(std::is_same_v<typename GridFunctionType::ScalarType, Real>,
+            "XDMF output only supports real valued grid functions.");
+        checkName(name);
+        m_fields.emplace_back(
+            [name, &gf]()
+            {
+              using RangeType = typename GridFunctionType::RangeType;
+              const auto& fes = gf.getFiniteElementSpace();
+              const auto& mesh = fes.getMesh();
+              const auto& data = gf.getData();
+              Field res{ name, Center::Node, fes.getVectorDimension(), {} };
+              if constexpr (std::is_same_v<RangeType, Real> &&
+                  Utility::IsSpecialization<FES, Variational::P1>::Value)
+              {
+                res.values.assign(data.data(), data.data() + data.size());
+              }
+              else if constexpr (std::is_same_v<RangeType, Real> &&
+                  Utility::IsSpecialization<FES, Variational::P0>::Value)
+              {
+                res.center = Center::Cell;
+                res.values.assign(data.data(), data.data() + data.size());
+              }
+              else
+              {
+                res.values.reserve(mesh.getVertexCount() * res.vdim);
+                for (auto it = mesh.getVertex(); !it.end(); ++it)
+                {
+                  const Geometry::Point p(*it, it->getTransformation(),
+                      Geometry::Polytope::getVertices(Geometry::Polytope::Type::Point).col(0),
+                      it->getCoordinates());
+                  if constexpr (std::is_same_v<RangeType, Real>)
+                  {
+                    res.values.push_back(gf(p));
+                  }
+                  else
+                  {
+                    const Math::Vector<Real> v = gf(p);
+                    res.values.insert(res.values.end(), v.data(), v.data() + v.size());
+                  }
+                }
+              }
+              return res;
+            });
+        return *this;
+      }
+
+      /**
+       * @brief Takes a snapshot of the mesh and of the grid functions, and
+       * queues it for writing.
+       *
+       * Blocks while the number of pending steps is equal to the capacity.
+       * Rethrows any error raised while writing a previous step.
+       *
+       * @param[in] time Time of the step
+       */
+      XDMF& write(Real time);
+
+      /**
+       * @brief Blocks until all the pending steps are written.
+       *
+       * Rethrows any error raised while writing a previous step.
+       */
+      XDMF& flush();
+
+      /**
+       * @brief Gets the number of steps queued so far.
+       */
+      size_t getStepCount() const
+      {
+        return m_stepCount;
+      }
+
+      /**
+       * @brief Gets the number of distinct meshes written so far.
+       */
+      size_t getMeshCount() const
+      {
+        return m_meshCount;
+      }
+
+    private:
+      /**
+       * Snapshot of the mesh, laid out as in the HDF5 file.
+       */
+      struct MeshData
+      {
+        size_t sdim;
+        size_t vertexCount;
+        std::vector<Real> vertices;
+        std::string topologyType;
+        size_t cellCount;
+        size_t nodesPerElement;
+        std::vector<int64_t> topology;
+        std::vector<int64_t> attributes;
+
+        bool operator==(const MeshData& other) const;
+      };
+
+      struct Step
+      {
+        Real time;
+        size_t index;
+        size_t meshIndex;
+        std::shared_ptr<const MeshData> mesh;
+        bool writeMesh;
+        std::vector<Field> fields;
+      };
+
+      static void checkName(const std::string& name);
+
+      static std::shared_ptr<MeshData> snapshot(const Geometry::Mesh<Context::Local>& mesh);
+
+      void writeStep(const Step& step);
+
+      void writeIndex(const std::string& grids);
+
+      boost::filesystem::path m_filename;
+      boost::filesystem::path m_h5filename;
+      int64_t m_file;
+
+      std::optional<std::reference_wrapper<const Geometry::Mesh<Context::Local>>> m_mesh;
+      std::vector<std::function<Field()>> m_fields;
+      std::shared_ptr<const MeshData> m_lastMesh;
+      size_t m_stepCount;
+      size_t m_meshCount;
+
+      // Only accessed by the writer thread
+      std::string m_grids;
+
+      std::mutex m_mutex;
+      std::exception_ptr m_error;
+      Threads::TaskQueue m_queue;
+  };
+}
+
+#endif
@@ -13,5 +13,8 @@
 #include "Math/Matrix.h"
 #include "Math/Constants.h"
 #include "Math/SparseMatrix.h"
+#include "Math/LinearOperator.h"
+#include "Math/BlockSparseMatrix.h"
+#include "Math/HMatrix.h"
 
 #endif
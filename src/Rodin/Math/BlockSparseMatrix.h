@@ -7,22 +7,449 @@
 #ifndef RODIN_MATH_BLOCKSPARSEMATRIX_H
 #define RODIN_MATH_BLOCKSPARSEMATRIX_H
 
-#include <Eigen/Core>
-#include <unsupported/Eigen/SparseExtra>
-// #include <unsupported/Eigen/src/SparseExtra/BlockSparseMatrix.h>
+#include <vector>
+#include <cassert>
+#include <optional>
+#include <algorithm>
+
+#include <Eigen/Sparse>
+
+#include "Rodin/Configure.h"
 
 #include "Rodin/Types.h"
+#include "Rodin/Threads/ThreadPool.h"
 
-#include "ForwardDecls.h"
+#include "Vector.h"
+#include "SparseMatrix.h"
+
+namespace Rodin::Math
+{
+  template <class Number>
+  class BlockSparseMatrix;
+}
+
+namespace Eigen::internal
+{
+  template <class Number>
+  struct traits<Rodin::Math::BlockSparseMatrix<Number>>
+    : public Eigen::internal::traits<Eigen::SparseMatrix<Number>>
+  {};
+}
 
 namespace Rodin::Math
 {
   /**
-   * @brief Sparse matrix type
+   * @brief Sparse matrix with dense @f$ b \times b @f$ blocks, stored in the
+   * block compressed sparse row (BSR) format.
+   *
+   * The matrix has @f$ m \times n @f$ blocks, and the rows and columns are
+   * ordered by component, as the degrees of freedom of the vector valued
+   * finite element spaces: the row @f$ i + c m @f$ is the row @f$ c @f$ of
+   * the block row @f$ i @f$, for @f$ 0 \leq c < b @f$. Hence the block @f$
+   * (i, j) @f$ couples all the components of the node @f$ i @f$ with all
+   * the components of the node @f$ j @f$. Each block is stored contiguously,
+   * in row major order.
+   *
+   * The product with a vector uses fixed size kernels for @f$ b = 2 @f$ and
+   * @f$ b = 3 @f$, and under RODIN_MULTITHREADED the block rows are
+   * distributed over the global thread pool. The matrix is accepted by the
+   * Eigen iterative solvers, in the same way as Math::LinearOperator.
+   *
+   * @see Assembly::Sequential<Math::BlockSparseMatrix, BilinearForm>
    */
-  // using BlockSparseMatrix = Eigen::BlockSparseMatrix<Real>;
-}
+  template <class Number>
+  class BlockSparseMatrix : public Eigen::EigenBase<BlockSparseMatrix<Number>>
+  {
+    public:
+      using Scalar = Number;
+
+      using RealScalar = Number;
+
+      using StorageIndex = int;
+
+      enum
+      {
+        ColsAtCompileTime = Eigen::Dynamic,
+        MaxColsAtCompileTime = Eigen::Dynamic,
+        IsRowMajor = false
+      };
+
+      using ScalarType = Number;
+
+      using VectorType = Vector<ScalarType>;
+
+      using SparseMatrixType = SparseMatrix<ScalarType>;
+
+      /**
+       * @brief Minimum number of block rows for the product to be computed
+       * in parallel.
+       */
+      static constexpr size_t ParallelThreshold = 1024;
+
+      /**
+       * @brief Constructs an empty matrix.
+       */
+      BlockSparseMatrix()
+        : BlockSparseMatrix(0, 0, 1)
+      {}
+
+      /**
+       * @brief Constructs a matrix of @p blockRows by @p blockCols blocks of
+       * size @p blockSize, without any nonzero block.
+       */
+      BlockSparseMatrix(size_t blockRows, size_t blockCols, size_t blockSize)
+        : m_blockSize(blockSize), m_blockRows(blockRows), m_blockCols(blockCols),
+          m_outer(blockRows + 1, 0)
+      {
+        assert(blockSize > 0);
+      }
+
+      /**
+       * @brief Converts the sparse matrix @p A, whose rows and columns are
+       * ordered by component, to blocks of size @p blockSize.
+       */
+      BlockSparseMatrix(const SparseMatrixType& A, size_t blockSize)
+        : BlockSparseMatrix(A.rows() / blockSize, A.cols() / blockSize, blockSize)
+      {
+        assert(A.rows() % blockSize == 0);
+        assert(A.cols() % blockSize == 0);
+        std::vector<std::vector<StorageIndex>> pattern(m_blockRows);
+        for (Index j = 0; j < A.outerSize(); j++)
+        {
+          for (typename SparseMatrixType::InnerIterator it(A, j); it; ++it)
+            pattern[it.row() % m_blockRows].push_back(it.col() % m_blockCols);
+        }
+        setPattern(pattern);
+        for (Index j = 0; j < A.outerSize(); j++)
+        {
+          for (typename SparseMatrixType::InnerIterator it(A, j); it; ++it)
+            coeffRef(it.row(), it.col()) += it.value();
+        }
+      }
+
+      BlockSparseMatrix(const BlockSparseMatrix&) = default;
+
+      BlockSparseMatrix(BlockSparseMatrix&&) = default;
+
+      BlockSparseMatrix& operator=(const BlockSparseMatrix&) = default;
+
+      BlockSparseMatrix& operator=(BlockSparseMatrix&&) = default;
+
+      Eigen::Index rows() const
+      {
+        return m_blockRows * m_blockSize;
+      }
+
+      Eigen::Index cols() const
+      {
+        return m_blockCols * m_blockSize;
+      }
 
+      size_t getBlockSize() const
+      {
+        return m_blockSize;
+      }
+
+      size_t getBlockRows() const
+      {
+        return m_blockRows;
+      }
+
+      size_t getBlockCols() const
+      {
+        return m_blockCols;
+      }
+
+      /**
+       * @brief Gets the number of stored blocks.
+       */
+      size_t getNonZeroBlocks() const
+      {
+        return m_inner.size();
+      }
+
+      /**
+       * @brief Sets the nonzero blocks and sets their values to zero.
+       * @param[in] pattern Column indices of the nonzero blocks of each block
+       * row, possibly unsorted and repeated
+       */
+      BlockSparseMatrix& setPattern(std::vector<std::vector<StorageIndex>>& pattern)
+      {
+        assert(pattern.size() == m_blockRows);
+        m_outer.assign(m_blockRows + 1, 0);
+        m_inner.clear();
+        for (size_t i = 0; i < m_blockRows; i++)
+        {
+          auto& row = pattern[i];
+          std::sort(row.begin(), row.end());
+          row.erase(std::unique(row.begin(), row.end()), row.end());
+          assert(row.empty() || static_cast<size_t>(row.back()) < m_blockCols);
+          m_inner.insert(m_inner.end(), row.begin(), row.end());
+          m_outer[i + 1] = m_inner.size();
+        }
+        m_values.assign(m_inner.size() * m_blockSize * m_blockSize, ScalarType(0));
+        return *this;
+      }
+
+      /**
+       * @brief Sets the values of the nonzero blocks to zero, keeping the
+       * pattern.
+       */
+      BlockSparseMatrix& setZero()
+      {
+        std::fill(m_values.begin(), m_values.end(), ScalarType(0));
+        return *this;
+      }
+
+      /**
+       * @brief Gets the position of the block @f$ (i, j) @f$ among the stored
+       * blocks, if it is stored.
+       */
+      std::optional<Index> getBlockPosition(Index i, Index j) const
+      {
+        assert(i < m_blockRows);
+        const auto begin = m_inner.begin() + m_outer[i];
+        const auto end = m_inner.begin() + m_outer[i + 1];
+        const auto it = std::lower_bound(begin, end, static_cast<StorageIndex>(j));
+        if (it == end || static_cast<Index>(*it) != j)
+          return std::nullopt;
+        return it - m_inner.begin();
+      }
+
+      /**
+       * @brief Gets the row major values of the @p k-th stored block.
+       */
+      ScalarType* getBlock(Index k)
+      {
+        return m_values.data() + k * m_blockSize * m_blockSize;
+      }
+
+      const ScalarType* getBlock(Index k) const
+      {
+        return m_values.data() + k * m_blockSize * m_blockSize;
+      }
+
+      const std::vector<StorageIndex>& getOuterIndices() const
+      {
+        return m_outer;
+      }
+
+      const std::vector<StorageIndex>& getInnerIndices() const
+      {
+        return m_inner;
+      }
+
+      /**
+       * @brief Gets the entry @f$ (r, s) @f$, which must belong to a stored
+       * block.
+       */
+      ScalarType& coeffRef(Index r, Index s)
+      {
+        const auto k = getBlockPosition(r % m_blockRows, s % m_blockCols);
+        assert(k.has_value());
+        return getBlock(*k)[(r / m_blockRows) * m_blockSize + s / m_blockCols];
+      }
+
+      /**
+       * @brief Gets the entry @f$ (r, s) @f$.
+       */
+      ScalarType coeff(Index r, Index s) const
+      {
+        const auto k = getBlockPosition(r % m_blockRows, s % m_blockCols);
+        if (!k)
+          return ScalarType(0);
+        return getBlock(*k)[(r / m_blockRows) * m_blockSize + s / m_blockCols];
+      }
+
+      /**
+       * @brief Gets the diagonal of the square matrix.
+       */
+      VectorType diagonal() const
+      {
+        assert(m_blockRows == m_blockCols);
+        const size_t n = m_blockRows;
+        VectorType res = VectorType::Zero(n * m_blockSize);
+        for (size_t i = 0; i < n; i++)
+        {
+          const auto k = getBlockPosition(i, i);
+          if (!k)
+            continue;
+          for (size_t c = 0; c < m_blockSize; c++)
+            res(i + c * n) = getBlock(*k)[c * m_blockSize + c];
+        }
+        return res;
+      }
+
+      /**
+       * @brief Computes @f$ y = A x @f$.
+       */
+      void apply(const VectorType& x, VectorType& y) const
+      {
+        assert(x.size() == cols());
+        y.setZero(rows());
+        multiplyAdd(x.data(), y.data(), ScalarType(1));
+      }
+
+      /**
+       * @brief Computes @f$ y \leftarrow y + \alpha A x @f$ on contiguous
+       * arrays ordered by component.
+       *
+       * The components of each node are read and written in place with a
+       * stride, hence no reordered copy of the vectors is made.
+       */
+      void multiplyAdd(const ScalarType* x, ScalarType* y, const ScalarType& alpha) const
+      {
+        switch (m_blockSize)
+        {
+          case 1:
+          {
+            multiply<1>(x, y, alpha);
+            break;
+          }
+          case 2:
+          {
+            multiply<2>(x, y, alpha);
+            break;
+          }
+          case 3:
+          {
+            multiply<3>(x, y, alpha);
+            break;
+          }
+          default:
+          {
+            multiply<Eigen::Dynamic>(x, y, alpha);
+            break;
+          }
+        }
+      }
+
+      /**
+       * @brief Converts the matrix to a Math::SparseMatrix, with the rows and
+       * columns ordered by component.
+       */
+      SparseMatrixType toSparseMatrix() const
+      {
+        const size_t b = m_blockSize;
+        std::vector<Eigen::Triplet<ScalarType>> triplets;
+        triplets.reserve(m_values.size());
+        for (size_t i = 0; i < m_blockRows; i++)
+        {
+          for (StorageIndex k = m_outer[i]; k < m_outer[i + 1]; k++)
+          {
+            const size_t j = m_inner[k];
+            const ScalarType* block = getBlock(k);
+            for (size_t r = 0; r < b; r++)
+            {
+              for (size_t s = 0; s < b; s++)
+                triplets.emplace_back(i + r * m_blockRows, j + s * m_blockCols, block[r * b + s]);
+            }
+          }
+        }
+        SparseMatrixType res(rows(), cols());
+        res.setFromTriplets(triplets.begin(), triplets.end());
+        return res;
+      }
+
+      template <class Rhs>
+      Eigen::Product<BlockSparseMatrix, Rhs, Eigen::AliasFreeProduct>
+      operator*(const Eigen::MatrixBase<Rhs>& x) const
+      {
+        return Eigen::Product<BlockSparseMatrix, Rhs, Eigen::AliasFreeProduct>(*this, x.derived());
+      }
+
+    private:
+      /**
+       * @brief Adds the product with the vector @p x, ordered by component,
+       * to @p y on the block rows of the given range.
+       */
+      template <int B>
+      void multiply(
+          const ScalarType* x, ScalarType* y, const ScalarType& alpha,
+          size_t begin, size_t end) const
+      {
+        using BlockType =
+          Eigen::Matrix<ScalarType, B, B, B == 1 ? Eigen::ColMajor : Eigen::RowMajor>;
+        using SegmentType = Eigen::Matrix<ScalarType, B, 1>;
+        using StrideType = Eigen::InnerStride<Eigen::Dynamic>;
+        const Index b = m_blockSize;
+        const StrideType xs(m_blockCols);
+        const StrideType ys(m_blockRows);
+        SegmentType s(b);
+        for (size_t i = begin; i < end; i++)
+        {
+          s.setZero();
+          for (StorageIndex k = m_outer[i]; k < m_outer[i + 1]; k++)
+          {
+            s.noalias() +=
+              Eigen::Map<const BlockType>(getBlock(k), b, b)
+              * Eigen::Map<const SegmentType, 0, StrideType>(x + m_inner[k], b, xs);
+          }
+          Eigen::Map<SegmentType, 0, StrideType>(y + i, b, ys) += alpha * s;
+        }
+      }
+
+      template <int B>
+      void multiply(const ScalarType* x, ScalarType* y, const ScalarType& alpha) const
+      {
+#ifdef RODIN_MULTITHREADED
+        if (m_blockRows >= ParallelThreshold)
+        {
+          auto& threadPool = Threads::getGlobalThreadPool();
+          threadPool.pushLoop(0, m_blockRows,
+              [&](const size_t start, const size_t stop)
+              {
+                multiply<B>(x, y, alpha, start, stop);
+              });
+          threadPool.waitForTasks();
+          return;
+        }
 #endif
+        multiply<B>(x, y, alpha, 0, m_blockRows);
+      }
 
+      size_t m_blockSize;
+      size_t m_blockRows;
+      size_t m_blockCols;
+      std::vector<StorageIndex> m_outer;
+      std::vector<StorageIndex> m_inner;
+      std::vector<ScalarType> m_values;
+  };
+}
+
+namespace Eigen::internal
+{
+  template <class Number, class Rhs>
+  struct generic_product_impl<
+    Rodin::Math::BlockSparseMatrix<Number>, Rhs, SparseShape, DenseShape, GemvProduct>
+    : generic_product_impl_base<
+        Rodin::Math::BlockSparseMatrix<Number>, Rhs,
+        generic_product_impl<Rodin::Math::BlockSparseMatrix<Number>, Rhs>>
+  {
+    using Scalar = typename Product<Rodin::Math::BlockSparseMatrix<Number>, Rhs>::Scalar;
 
+    template <class Dest>
+    static void scaleAndAddTo(
+        Dest& dst, const Rodin::Math::BlockSparseMatrix<Number>& lhs, const Rhs& rhs,
+        const Scalar& alpha)
+    {
+      // Evaluates the right hand side only if it is not contiguous
+      const Eigen::Ref<const Rodin::Math::Vector<Number>> x(rhs);
+      assert(x.size() == lhs.cols());
+      assert(dst.size() == lhs.rows());
+      if constexpr (
+          bool(Dest::Flags & DirectAccessBit) && int(Dest::InnerStrideAtCompileTime) == 1)
+      {
+        lhs.multiplyAdd(x.data(), dst.data(), alpha);
+      }
+      else
+      {
+        Rodin::Math::Vector<Number> y = Rodin::Math::Vector<Number>::Zero(lhs.rows());
+        lhs.multiplyAdd(x.data(), y.data(), alpha);
+        dst += y;
+      }
+    }
+  };
+}
+
+#endif
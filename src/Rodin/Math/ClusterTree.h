@@ -0,0 +1,226 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_MATH_CLUSTERTREE_H
+#define RODIN_MATH_CLUSTERTREE_H
+
+#include <cmath>
+#include <array>
+#include <vector>
+#include <numeric>
+#include <cassert>
+#include <algorithm>
+
+#include "Rodin/Types.h"
+
+#include "Vector.h"
+#include "Matrix.h"
+
+namespace Rodin::Math
+{
+  /**
+   * @brief Binary space partitioning tree of a set of indices.
+   *
+   * Each index @f$ i @f$ is given an axis aligned bounding box (its support)
+   * @f$ [a_i, b_i] \subset \mathbb{R}^s @f$. The tree is built by recursively
+   * splitting the indices of a node in two halves, at the median of the box
+   * centers along the longest side of the node's bounding box, until the
+   * nodes contain at most a given number of indices.
+   *
+   * The indices are permuted so that the indices of every node are stored
+   * contiguously in the range @f$ [\mathrm{begin}, \mathrm{end}) @f$ of
+   * getIndices().
+   *
+   * @see HMatrix
+   */
+  class ClusterTree
+  {
+    public:
+      /**
+       * @brief Node of the cluster tree.
+       */
+      struct Node
+      {
+        /// Position of the first index of the node in getIndices().
+        size_t begin;
+
+        /// Position past the last index of the node in getIndices().
+        size_t end;
+
+        /// Lower corner of the bounding box of the node.
+        SpatialVector<Real> min;
+
+        /// Upper corner of the bounding box of the node.
+        SpatialVector<Real> max;
+
+        /// Positions of the children in getNodes(), if the node is not a leaf.
+        std::array<size_t, 2> children;
+
+        size_t size() const
+        {
+          return end - begin;
+        }
+
+        bool isLeaf() const
+        {
+          return children[0] == children[1];
+        }
+
+        /**
+         * @brief Gets the diameter of the bounding box of the node.
+         */
+        Real getDiameter() const
+        {
+          return (max - min).norm();
+        }
+
+        /**
+         * @brief Gets the distance between the bounding boxes of two nodes.
+         */
+        Real getDistance(const Node& other) const
+        {
+          assert(min.size() == other.min.size());
+          Real res = 0;
+          for (int k = 0; k < min.size(); k++)
+          {
+            const Real gap = std::max({ Real(0), min(k) - other.max(k), other.min(k) - max(k) });
+            res += gap * gap;
+          }
+          return std::sqrt(res);
+        }
+      };
+
+      ClusterTree() = default;
+
+      /**
+       * @brief Builds the cluster tree of the boxes @f$ [a_i, b_i] @f$.
+       * @param[in] min Matrix of size @f$ s \times n @f$ whose @f$ i @f$-th
+       * column is the lower corner @f$ a_i @f$
+       * @param[in] max Matrix of size @f$ s \times n @f$ whose @f$ i @f$-th
+       * column is the upper corner @f$ b_i @f$
+       * @param[in] leafSize Maximal number of indices of a leaf
+       */
+      ClusterTree(const Matrix<Real>& min, const Matrix<Real>& max, size_t leafSize)
+      {
+        assert(min.rows() == max.rows());
+        assert(min.cols() == max.cols());
+        assert(min.rows() <= RODIN_MAXIMAL_SPACE_DIMENSION);
+        assert(leafSize > 0);
+        const size_t n = min.cols();
+        m_indices.resize(n);
+        std::iota(m_indices.begin(), m_indices.end(), 0);
+        if (n == 0)
+          return;
+
+        std::vector<Real> center(n);
+        std::vector<size_t> stack;
+        m_nodes.push_back(Node{ 0, n, {}, {}, { 0, 0 } });
+        stack.push_back(0);
+        while (stack.size() > 0)
+        {
+          const size_t k = stack.back();
+          stack.pop_back();
+          const size_t begin = m_nodes[k].begin;
+          const size_t end = m_nodes[k].end;
+
+          SpatialVector<Real> lo = min.col(m_indices[begin]);
+          SpatialVector<Real> hi = max.col(m_indices[begin]);
+          for (size_t p = begin + 1; p < end; p++)
+          {
+            lo = lo.cwiseMin(min.col(m_indices[p]));
+            hi = hi.cwiseMax(max.col(m_indices[p]));
+          }
+          m_nodes[k].min = lo;
+          m_nodes[k].max = hi;
+
+          if (end - begin <= leafSize)
+            continue;
+
+          Eigen::Index axis;
+          (hi - lo).maxCoeff(&axis);
+          for (size_t p = begin; p < end; p++)
+          {
+            const Index i = m_indices[p];
+            center[i] = 0.5 * (min(axis, i) + max(axis, i));
+          }
+          const size_t mid = begin + (end - begin) / 2;
+          std::nth_element(
+              m_indices.begin() + begin, m_indices.begin() + mid, m_indices.begin() + end,
+              [&](Index a, Index b) { return center[a] < center[b]; });
+
+          const size_t left = m_nodes.size();
+          m_nodes.push_back(Node{ begin, mid, {}, {}, { 0, 0 } });
+          m_nodes.push_back(Node{ mid, end, {}, {}, { 0, 0 } });
+          m_nodes[k].children = { left, left + 1 };
+          stack.push_back(left);
+          stack.push_back(left + 1);
+        }
+      }
+
+      ClusterTree(const ClusterTree&) = default;
+
+      ClusterTree(ClusterTree&&) = default;
+
+      ClusterTree& operator=(const ClusterTree&) = default;
+
+      ClusterTree& operator=(ClusterTree&&) = default;
+
+      /**
+       * @brief Gets the root node, which is always at position zero.
+       */
+      const Node& getRoot() const
+      {
+        assert(m_nodes.size() > 0);
+        return m_nodes[0];
+      }
+
+      const Node& getNode(size_t k) const
+      {
+        assert(k < m_nodes.size());
+        return m_nodes[k];
+      }
+
+      const std::vector<Node>& getNodes() const
+      {
+        return m_nodes;
+      }
+
+      /**
+       * @brief Gets the permuted indices.
+       */
+      const std::vector<Index>& getIndices() const
+      {
+        return m_indices;
+      }
+
+      /**
+       * @brief Gets a pointer to the first index of the node.
+       */
+      const Index* getIndices(const Node& node) const
+      {
+        return m_indices.data() + node.begin;
+      }
+
+      /**
+       * @brief Gets the number of indices in the tree.
+       */
+      size_t size() const
+      {
+        return m_indices.size();
+      }
+
+      bool empty() const
+      {
+        return m_nodes.empty();
+      }
+
+    private:
+      std::vector<Node> m_nodes;
+      std::vector<Index> m_indices;
+  };
+}
+
+#endif
@@ -0,0 +1,451 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_MATH_HMATRIX_H
+#define RODIN_MATH_HMATRIX_H
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cassert>
+#include <functional>
+
+#include "Rodin/Types.h"
+
+#include "Vector.h"
+#include "Matrix.h"
+#include "ClusterTree.h"
+#include "LinearOperator.h"
+
+namespace Rodin::Math
+{
+  template <class Number>
+  class HMatrix;
+}
+
+namespace Rodin::FormLanguage
+{
+  template <class Number>
+  struct Traits<Math::HMatrix<Number>>
+  {
+    using ScalarType = Number;
+  };
+}
+
+namespace Rodin::Math
+{
+  /**
+   * @brief Hierarchical matrix.
+   *
+   * Represents a @f$ m \times n @f$ matrix @f$ A @f$ whose row and column
+   * indices are organized in two ClusterTree objects. The matrix is
+   * partitioned in blocks @f$ A|_{\sigma \times \tau} @f$ of pairs of
+   * clusters. A pair is admissible if
+   * @f[
+   *   \min \{ \mathrm{diam}(\sigma), \mathrm{diam}(\tau) \} \leq \eta \
+   *   \mathrm{dist}(\sigma, \tau) \ ,
+   * @f]
+   * in which case the block is approximated by a low-rank product @f$ U V^T
+   * @f$, computed with the adaptive cross approximation (ACA) with partial
+   * pivoting. The remaining blocks, which are pairs of leaves, are stored
+   * densely.
+   *
+   * The entries of the matrix are only accessed through a generator function
+   * which computes the submatrix @f$ A|_{R \times C} @f$ for sets of rows
+   * @f$ R @f$ and columns @f$ C @f$. For asymptotically smooth kernels, only
+   * @f$ \mathcal{O}(k (m + n) \log (m + n)) @f$ entries are computed and
+   * stored, where @f$ k @f$ is the rank of the admissible blocks.
+   *
+   * @see ClusterTree, Assembly::Sequential, Assembly::Multithreaded
+   */
+  template <class Number>
+  class HMatrix
+  {
+    public:
+      using ScalarType = Number;
+
+      using VectorType = Vector<ScalarType>;
+
+      using MatrixType = Matrix<ScalarType>;
+
+      /**
+       * @brief Function computing the submatrix @f$ A|_{R \times C} @f$.
+       *
+       * The function is called with the @f$ m @f$ row indices @f$ R @f$, the
+       * @f$ n @f$ column indices @f$ C @f$ and a matrix of size @f$ m \times
+       * n @f$ which must be overwritten with the submatrix.
+       */
+      using GeneratorType =
+        std::function<void(const Index* rows, size_t m, const Index* cols, size_t n, MatrixType& res)>;
+
+      /**
+       * @brief Block of the partition.
+       */
+      struct Block
+      {
+        /// Position of the row cluster in the row tree.
+        size_t row;
+
+        /// Position of the column cluster in the column tree.
+        size_t col;
+
+        /// Whether the pair of clusters is admissible.
+        bool admissible;
+
+        /// Whether the block is stored as a low-rank product.
+        bool lowRank;
+
+        /// Dense storage of the block.
+        MatrixType dense;
+
+        /// Left factor of the low-rank product.
+        MatrixType U;
+
+        /// Right factor of the low-rank product.
+        MatrixType V;
+
+        size_t getRank() const
+        {
+          return lowRank ? U.cols() : std::min(dense.rows(), dense.cols());
+        }
+      };
+
+      HMatrix()
+        : m_eta(0)
+      {}
+
+      /**
+       * @brief Builds the block partition of the matrix.
+       * @param[in] rowTree Cluster tree of the row indices
+       * @param[in] colTree Cluster tree of the column indices
+       * @param[in] eta Admissibility parameter @f$ \eta > 0 @f$
+       *
+       * The blocks are not assembled.
+       */
+      HMatrix(ClusterTree rowTree, ClusterTree colTree, Real eta)
+        : m_rowTree(std::move(rowTree)), m_colTree(std::move(colTree)), m_eta(eta)
+      {
+        assert(eta > 0);
+        if (m_rowTree.empty() || m_colTree.empty())
+          return;
+        std::vector<std::pair<size_t, size_t>> stack;
+        stack.emplace_back(0, 0);
+        while (stack.size() > 0)
+        {
+          const auto [r, c] = stack.back();
+          stack.pop_back();
+          const auto& rn = m_rowTree.getNode(r);
+          const auto& cn = m_colTree.getNode(c);
+          const Real dist = rn.getDistance(cn);
+          if (dist > 0 && std::min(rn.getDiameter(), cn.getDiameter()) <= m_eta * dist)
+          {
+            m_blocks.push_back(Block{ r, c, true, false, {}, {}, {} });
+          }
+          else if (rn.isLeaf() && cn.isLeaf())
+          {
+            m_blocks.push_back(Block{ r, c, false, false, {}, {}, {} });
+          }
+          else if (rn.isLeaf())
+          {
+            stack.emplace_back(r, cn.children[0]);
+            stack.emplace_back(r, cn.children[1]);
+          }
+          else if (cn.isLeaf())
+          {
+            stack.emplace_back(rn.children[0], c);
+            stack.emplace_back(rn.children[1], c);
+          }
+          else
+          {
+            for (const size_t rc : rn.children)
+              for (const size_t cc : cn.children)
+                stack.emplace_back(rc, cc);
+          }
+        }
+      }
+
+      HMatrix(const HMatrix&) = default;
+
+      HMatrix(HMatrix&&) = default;
+
+      HMatrix& operator=(const HMatrix&) = default;
+
+      HMatrix& operator=(HMatrix&&) = default;
+
+      /**
+       * @brief Assembles all the blocks of the matrix.
+       * @param[in] generator Function computing the submatrices of @f$ A @f$
+       * @param[in] tolerance Relative tolerance of the cross approximation
+       */
+      HMatrix& assemble(const GeneratorType& generator, Real tolerance)
+      {
+        for (size_t k = 0; k < m_blocks.size(); k++)
+          assemble(k, generator, tolerance);
+        return *this;
+      }
+
+      /**
+       * @brief Assembles the @f$ k @f$-th block of the matrix.
+       *
+       * Distinct blocks may be assembled concurrently, provided that each
+       * thread uses its own generator.
+       *
+       * If the cross approximation of an admissible block does not converge
+       * before its rank makes the low-rank storage larger than the dense
+       * storage, the block is stored densely.
+       */
+      HMatrix& assemble(size_t k, const GeneratorType& generator, Real tolerance)
+      {
+        assert(k < m_blocks.size());
+        auto& block = m_blocks[k];
+        const auto& rn = m_rowTree.getNode(block.row);
+        const auto& cn = m_colTree.getNode(block.col);
+        const Index* rows = m_rowTree.getIndices(rn);
+        const Index* cols = m_colTree.getIndices(cn);
+        block.lowRank = block.admissible && aca(block, rows, rn.size(), cols, cn.size(), generator, tolerance);
+        if (block.lowRank)
+        {
+          block.dense.resize(0, 0);
+        }
+        else
+        {
+          block.U.resize(0, 0);
+          block.V.resize(0, 0);
+          block.dense.resize(rn.size(), cn.size());
+          generator(rows, rn.size(), cols, cn.size(), block.dense);
+        }
+        return *this;
+      }
+
+      /**
+       * @brief Computes @f$ y = A x @f$.
+       */
+      void apply(const VectorType& x, VectorType& y) const
+      {
+        assert(static_cast<size_t>(x.size()) == cols());
+        y.resize(rows());
+        y.setZero();
+        VectorType xs, ys;
+        for (const auto& block : m_blocks)
+        {
+          const auto& rn = m_rowTree.getNode(block.row);
+          const auto& cn = m_colTree.getNode(block.col);
+          const Index* ri = m_rowTree.getIndices(rn);
+          const Index* ci = m_colTree.getIndices(cn);
+          xs.resize(cn.size());
+          for (size_t q = 0; q < cn.size(); q++)
+            xs.coeffRef(q) = x.coeff(ci[q]);
+          if (block.lowRank)
+            ys.noalias() = block.U * (block.V.transpose() * xs);
+          else
+            ys.noalias() = block.dense * xs;
+          for (size_t p = 0; p < rn.size(); p++)
+            y.coeffRef(ri[p]) += ys.coeff(p);
+        }
+      }
+
+      VectorType operator*(const VectorType& x) const
+      {
+        VectorType res;
+        apply(x, res);
+        return res;
+      }
+
+      /**
+       * @brief Gets the matrix-free linear operator whose action is given by
+       * apply().
+       *
+       * The matrix must outlive the returned object.
+       */
+      LinearOperator<ScalarType> getLinearOperator() const
+      {
+        return LinearOperator<ScalarType>(rows(), cols(),
+            [this](const VectorType& x, VectorType& y)
+            {
+              apply(x, y);
+            });
+      }
+
+      /**
+       * @brief Converts the matrix to a dense matrix.
+       */
+      MatrixType toDense() const
+      {
+        MatrixType res(rows(), cols());
+        res.setZero();
+        for (const auto& block : m_blocks)
+        {
+          const auto& rn = m_rowTree.getNode(block.row);
+          const auto& cn = m_colTree.getNode(block.col);
+          const Index* ri = m_rowTree.getIndices(rn);
+          const Index* ci = m_colTree.getIndices(cn);
+          const MatrixType sub = block.lowRank ? MatrixType(block.U * block.V.transpose()) : block.dense;
+          for (size_t q = 0; q < cn.size(); q++)
+            for (size_t p = 0; p < rn.size(); p++)
+              res(ri[p], ci[q]) = sub(p, q);
+        }
+        return res;
+      }
+
+      size_t rows() const
+      {
+        return m_rowTree.size();
+      }
+
+      size_t cols() const
+      {
+        return m_colTree.size();
+      }
+
+      /**
+       * @brief Gets the number of scalars stored in the blocks.
+       */
+      size_t getStorageSize() const
+      {
+        size_t res = 0;
+        for (const auto& block : m_blocks)
+          res += block.dense.size() + block.U.size() + block.V.size();
+        return res;
+      }
+
+      const std::vector<Block>& getBlocks() const
+      {
+        return m_blocks;
+      }
+
+      const ClusterTree& getRowTree() const
+      {
+        return m_rowTree;
+      }
+
+      const ClusterTree& getColumnTree() const
+      {
+        return m_colTree;
+      }
+
+      Real getAdmissibility() const
+      {
+        return m_eta;
+      }
+
+    private:
+      /**
+       * @brief Adaptive cross approximation with partial pivoting.
+       *
+       * Successively computes the crosses @f$ u_k v_k^T @f$ from one row and
+       * one column of the residual, until
+       * @f$ \| u_k \| \| v_k \| \leq \varepsilon \| \sum_l u_l v_l^T \|_F @f$.
+       *
+       * @returns Whether the approximation converged within the maximal
+       * rank.
+       */
+      static bool aca(
+          Block& block,
+          const Index* rows, size_t m, const Index* cols, size_t n,
+          const GeneratorType& generator, Real tolerance)
+      {
+        const size_t maxRank = std::max<size_t>(1, (m * n) / (m + n));
+        std::vector<VectorType> us, vs;
+        std::vector<bool> used(m, false);
+        MatrixType row(1, n), col(m, 1);
+        VectorType u, v;
+        Real norm2 = 0;
+        size_t pivot = 0;
+        bool converged = false;
+        while (us.size() < maxRank)
+        {
+          used[pivot] = true;
+          generator(rows + pivot, 1, cols, n, row);
+          v = row.row(0).transpose();
+          for (size_t l = 0; l < us.size(); l++)
+            v -= us[l].coeff(pivot) * vs[l];
+
+          Eigen::Index j;
+          const Real vmax = v.cwiseAbs().maxCoeff(&j);
+          if (vmax <= std::numeric_limits<Real>::epsilon() * std::sqrt(norm2))
+          {
+            // The residual row vanishes, try the next unused row
+            size_t next = m;
+            for (size_t i = 0; i < m; i++)
+            {
+              if (!used[i])
+              {
+                next = i;
+                break;
+              }
+            }
+            if (next == m)
+            {
+              converged = true;
+              break;
+            }
+            pivot = next;
+            continue;
+          }
+          v /= v.coeff(j);
+
+          generator(rows, m, cols + j, 1, col);
+          u = col.col(0);
+          for (size_t l = 0; l < us.size(); l++)
+            u -= vs[l].coeff(j) * us[l];
+
+          // Frobenius inner products of the new term with the previous ones,
+          // i.e. (u_l v_l^T, u v^T) = (u_l^H u) (v_l^H v) since dot()
+          // conjugates its first argument
+          ScalarType cross = 0;
+          for (size_t l = 0; l < us.size(); l++)
+            cross += us[l].dot(u) * vs[l].dot(v);
+          const Real un = u.norm();
+          const Real vn = v.norm();
+          norm2 += 2 * std::real(cross) + u.squaredNorm() * v.squaredNorm();
+          us.push_back(u);
+          vs.push_back(v);
+
+          if (un * vn <= tolerance * std::sqrt(norm2))
+          {
+            converged = true;
+            break;
+          }
+
+          size_t next = m;
+          Real umax = -1;
+          for (size_t i = 0; i < m; i++)
+          {
+            if (!used[i] && std::abs(u.coeff(i)) > umax)
+            {
+              umax = std::abs(u.coeff(i));
+              next = i;
+            }
+          }
+          if (next == m)
+          {
+            converged = true;
+            break;
+          }
+          pivot = next;
+        }
+
+        if (!converged)
+          return false;
+
+        block.U.resize(m, us.size());
+        block.V.resize(n, vs.size());
+        for (size_t l = 0; l < us.size(); l++)
+        {
+          block.U.col(l) = us[l];
+          block.V.col(l) = vs[l];
+        }
+        return true;
+      }
+
+      ClusterTree m_rowTree;
+      ClusterTree m_colTree;
+      Real m_eta;
+      std::vector<Block> m_blocks;
+  };
+}
+
+#endif
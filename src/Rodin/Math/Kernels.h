@@ -7,6 +7,9 @@
 #ifndef RODIN_MATH_KERNELS_H
 #define RODIN_MATH_KERNELS_H
 
+#include <vector>
+#include <algorithm>
+
 #include "Rodin/Math.h"
 #include "Rodin/Geometry/Polytope.h"
 
@@ -55,6 +58,109 @@ namespace Rodin::Math::Kernels
     }
   }
 
+  /**
+   * @brief Computes the positions, in the value array of @p stiffness, of the
+   * off-diagonal entries in the rows of the essential degrees of freedom.
+   *
+   * These are the entries which are zeroed by eliminate(). The positions
+   * remain valid for as long as the sparsity pattern of @p stiffness is
+   * unchanged.
+   */
+  template <class MatrixScalar, class DOFScalar>
+  static std::vector<Index> getEliminationPositions(
+      const SparseMatrix<MatrixScalar>& stiffness,
+      const IndexMap<DOFScalar>& dofs, size_t offset = 0)
+  {
+    assert(stiffness.isCompressed());
+    const auto* const outerPtr = stiffness.outerIndexPtr();
+    const auto* const innerPtr = stiffness.innerIndexPtr();
+    std::vector<Index> res;
+    for (const auto& kv : dofs)
+    {
+      const Index global = kv.first + offset;
+      for (auto i = outerPtr[global]; i < outerPtr[global + 1]; ++i)
+      {
+        // Assumes CCS format
+        const Index row = innerPtr[i];
+        if (row != global)
+        {
+          const auto* const begin = innerPtr + outerPtr[row];
+          const auto* const end = innerPtr + outerPtr[row + 1];
+          const auto* const it = std::find(begin, end, global);
+          if (it != end)
+            res.push_back(it - innerPtr);
+        }
+      }
+    }
+    return res;
+  }
+
+  /**
+   * @brief Eliminates the essential degrees of freedom using the positions
+   * previously computed by getEliminationPositions().
+   */
+  template <class MatrixScalar, class VectorScalar, class DOFScalar>
+  static void eliminate(
+      SparseMatrix<MatrixScalar>& stiffness, Vector<VectorScalar>& mass,
+      const IndexMap<DOFScalar>& dofs, const std::vector<Index>& positions,
+      size_t offset = 0)
+  {
+    auto* const valuePtr = stiffness.valuePtr();
+    const auto* const outerPtr = stiffness.outerIndexPtr();
+    const auto* const innerPtr = stiffness.innerIndexPtr();
+    // Move essential degrees of freedom in the LHS to the RHS
+    for (const auto& [local, dof] : dofs)
+    {
+      const Index global = local + offset;
+      for (auto i = outerPtr[global]; i < outerPtr[global + 1]; ++i)
+        mass.coeffRef(innerPtr[i]) -= valuePtr[i] * dof;
+    }
+    for (const auto& [local, dof] : dofs)
+    {
+      const Index global = local + offset;
+
+      // Impose essential degrees of freedom on RHS
+      mass.coeffRef(global) = dof;
+
+      // Impose essential degrees of freedom on LHS
+      for (auto i = outerPtr[global]; i < outerPtr[global + 1]; ++i)
+        valuePtr[i] = (static_cast<Index>(innerPtr[i]) == global);
+    }
+    for (const Index k : positions)
+      valuePtr[k] = 0;
+  }
+
+  /**
+   * @brief Adds @p rhs to @p lhs.
+   *
+   * If both matrices have the same sparsity pattern, the values are added in
+   * place and no memory is allocated.
+   */
+  template <class Scalar>
+  static void add(SparseMatrix<Scalar>& lhs, const SparseMatrix<Scalar>& rhs)
+  {
+    assert(lhs.rows() == rhs.rows());
+    assert(lhs.cols() == rhs.cols());
+    const Boolean same =
+      lhs.isCompressed() && rhs.isCompressed() &&
+      lhs.nonZeros() == rhs.nonZeros() &&
+      std::equal(
+          lhs.outerIndexPtr(), lhs.outerIndexPtr() + lhs.outerSize() + 1, rhs.outerIndexPtr()) &&
+      std::equal(
+          lhs.innerIndexPtr(), lhs.innerIndexPtr() + lhs.nonZeros(), rhs.innerIndexPtr());
+    if (same)
+    {
+      auto* const valuePtr = lhs.valuePtr();
+      const auto* const rhsValuePtr = rhs.valuePtr();
+      for (Eigen::Index i = 0; i < lhs.nonZeros(); i++)
+        valuePtr[i] += rhsValuePtr[i];
+    }
+    else
+    {
+      lhs += rhs;
+    }
+  }
+
   template <class Scalar>
   static void replace(
       const Vector<Scalar>& row,
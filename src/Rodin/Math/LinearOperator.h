@@ -0,0 +1,147 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_MATH_LINEAROPERATOR_H
+#define RODIN_MATH_LINEAROPERATOR_H
+
+#include <functional>
+
+#include <Eigen/Sparse>
+
+#include "Rodin/Types.h"
+
+#include "Vector.h"
+
+namespace Rodin::Math
+{
+  template <class Number>
+  class LinearOperator;
+}
+
+namespace Eigen::internal
+{
+  template <class Number>
+  struct traits<Rodin::Math::LinearOperator<Number>>
+    : public Eigen::internal::traits<Eigen::SparseMatrix<Number>>
+  {};
+}
+
+namespace Rodin::Math
+{
+  /**
+   * @brief Matrix-free linear operator.
+   *
+   * Represents a @f$ m \times n @f$ linear operator @f$ A @f$ which is only
+   * known through its action @f$ x \mapsto A x @f$. The operator may be
+   * multiplied by a dense vector and is accepted by the Eigen iterative
+   * solvers, such as Eigen::ConjugateGradient or Eigen::BiCGSTAB, when used
+   * with Eigen::IdentityPreconditioner.
+   *
+   * @see Variational::BilinearForm::getLinearOperator()
+   */
+  template <class Number>
+  class LinearOperator : public Eigen::EigenBase<LinearOperator<Number>>
+  {
+    public:
+      using Scalar = Number;
+
+      using RealScalar = Number;
+
+      using StorageIndex = int;
+
+      enum
+      {
+        ColsAtCompileTime = Eigen::Dynamic,
+        MaxColsAtCompileTime = Eigen::Dynamic,
+        IsRowMajor = false
+      };
+
+      using ScalarType = Number;
+
+      using VectorType = Vector<ScalarType>;
+
+      /**
+       * @brief Function computing @f$ y = A x @f$.
+       */
+      using ActionType = std::function<void(const VectorType& x, VectorType& y)>;
+
+      /**
+       * @brief Constructs the operator from its action.
+       * @param[in] rows Number of rows @f$ m @f$
+       * @param[in] cols Number of columns @f$ n @f$
+       * @param[in] action Function which computes @f$ y = A x @f$
+       */
+      LinearOperator(size_t rows, size_t cols, ActionType action)
+        : m_rows(rows), m_cols(cols), m_action(std::move(action))
+      {}
+
+      LinearOperator(const LinearOperator&) = default;
+
+      LinearOperator(LinearOperator&&) = default;
+
+      LinearOperator& operator=(const LinearOperator&) = default;
+
+      LinearOperator& operator=(LinearOperator&&) = default;
+
+      Eigen::Index rows() const
+      {
+        return m_rows;
+      }
+
+      Eigen::Index cols() const
+      {
+        return m_cols;
+      }
+
+      /**
+       * @brief Computes @f$ y = A x @f$.
+       */
+      void apply(const VectorType& x, VectorType& y) const
+      {
+        assert(static_cast<size_t>(x.size()) == m_cols);
+        m_action(x, y);
+        assert(static_cast<size_t>(y.size()) == m_rows);
+      }
+
+      template <class Rhs>
+      Eigen::Product<LinearOperator, Rhs, Eigen::AliasFreeProduct>
+      operator*(const Eigen::MatrixBase<Rhs>& x) const
+      {
+        return Eigen::Product<LinearOperator, Rhs, Eigen::AliasFreeProduct>(*this, x.derived());
+      }
+
+    private:
+      size_t m_rows;
+      size_t m_cols;
+      ActionType m_action;
+  };
+}
+
+namespace Eigen::internal
+{
+  template <class Number, class Rhs>
+  struct generic_product_impl<
+    Rodin::Math::LinearOperator<Number>, Rhs, SparseShape, DenseShape, GemvProduct>
+    : generic_product_impl_base<
+        Rodin::Math::LinearOperator<Number>, Rhs,
+        generic_product_impl<Rodin::Math::LinearOperator<Number>, Rhs>>
+  {
+    using Scalar = typename Product<Rodin::Math::LinearOperator<Number>, Rhs>::Scalar;
+
+    template <class Dest>
+    static void scaleAndAddTo(
+        Dest& dst, const Rodin::Math::LinearOperator<Number>& lhs, const Rhs& rhs,
+        const Scalar& alpha)
+    {
+      const Rodin::Math::Vector<Number> x = rhs;
+      Rodin::Math::Vector<Number> y;
+      lhs.apply(x, y);
+      dst.noalias() += alpha * y;
+    }
+  };
+}
+
+#endif
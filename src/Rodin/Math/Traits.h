@@ -10,6 +10,7 @@
 #include <type_traits>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 namespace Rodin::FormLanguage
 {
@@ -19,6 +20,25 @@ namespace Rodin::FormLanguage
     static constexpr bool Value =
       std::is_base_of_v<Eigen::EigenBase<typename std::decay<T>::type>, typename std::decay<T>::type>;
   };
+
+  /**
+   * @brief Determines whether @p T is an Eigen object which is neither a
+   * dense nor a sparse matrix, such as Math::LinearOperator or
+   * Math::BlockSparseMatrix.
+   *
+   * The Eigen iterative solvers only access such operators through their
+   * product with a vector.
+   */
+  template <class T>
+  struct IsMatrixFreeOperator
+  {
+    using Type = typename std::decay<T>::type;
+
+    static constexpr bool Value =
+      IsEigenObject<Type>::Value &&
+      !std::is_base_of_v<Eigen::DenseBase<Type>, Type> &&
+      !std::is_base_of_v<Eigen::SparseMatrixBase<Type>, Type>;
+  };
 }
 
 #endif
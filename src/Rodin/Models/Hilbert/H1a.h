@@ -39,7 +39,8 @@ namespace Rodin::Models::Hilbert
         : m_fes(fes),
           m_trial(fes), m_test(fes),
           m_pb(m_trial, m_test),
-          m_alpha(1)
+          m_alpha(1),
+          m_pc(nullptr)
       {}
 
       H1a& setAlpha(Real alpha)
@@ -48,30 +49,46 @@ namespace Rodin::Models::Hilbert
         return *this;
       }
 
+      /**
+       * @brief Sets the preconditioner of the conjugate gradient used to
+       * solve the problem, e.g. a Solver::GMG or a Solver::AMG.
+       */
+      H1a& setPreconditioner(
+          Solver::PreconditionerBase<Math::SparseMatrix<Real>, Math::Vector<Real>>& pc)
+      {
+        m_pc = &pc;
+        return *this;
+      }
+
+      /**
+       * @brief Solves the problem with the linear form @p lf, which must be
+       * written in terms of getTestFunction(), subject to the Dirichlet
+       * boundary conditions added with operator+=().
+       *
+       * This is not a const method since the problem is assembled in
+       * getProblem() and its solution is stored in getTrialFunction().
+       */
       template <class Differential>
-      auto operator()(const Differential& lf) const
+      auto operator()(const Differential& lf)
       {
-        const auto& fes = getFiniteElementSpace();
+        auto& g = m_trial;
+        auto& w = m_test;
         if constexpr (std::is_same_v<FESRange, Real>)
         {
-          Variational::TrialFunction g(fes);
-          Variational::TestFunction  w(fes);
-          Variational::Problem hilbert(g, w);
-          hilbert = Integral(m_alpha * m_alpha * Grad(g), Grad(w))
-                  + Integral(g, w)
-                  - lf;
-          hilbert.solve(m_cg);
+          m_pb = Variational::Integral(m_alpha * m_alpha * Variational::Grad(g), Variational::Grad(w))
+               + Variational::Integral(g, w)
+               - lf
+               + m_dbcs;
+          solve(m_pb);
           return g.getSolution();
         }
         else if constexpr (std::is_same_v<FESRange, Math::Vector<Real>>)
         {
-          Variational::TrialFunction g(fes);
-          Variational::TestFunction  w(fes);
-          Variational::Problem hilbert(g, w);
-          hilbert = Integral(m_alpha * m_alpha * Jacobian(g), Jacobian(w))
-                  + Integral(g, w)
-                  - lf;
-          hilbert.solve(m_cg);
+          m_pb = Variational::Integral(m_alpha * m_alpha * Variational::Jacobian(g), Variational::Jacobian(w))
+               + Variational::Integral(g, w)
+               - lf
+               + m_dbcs;
+          solve(m_pb);
           return g.getSolution();
         }
         else
@@ -81,10 +98,14 @@ namespace Rodin::Models::Hilbert
         }
       }
 
+      /**
+       * @brief Adds a Dirichlet boundary condition on getTrialFunction(),
+       * which is imposed by the subsequent calls to operator()().
+       */
       inline
       H1a& operator+=(const Variational::DirichletBCBase<ScalarType>& dbc)
       {
-        m_pb += dbc;
+        m_dbcs.add(dbc);
         return *this;
       }
 
@@ -119,12 +140,22 @@ namespace Rodin::Models::Hilbert
       }
 
     private:
+      template <class ProblemType>
+      void solve(ProblemType& pb)
+      {
+        Solver::CG cg(pb);
+        if (m_pc)
+          cg.setPreconditioner(*m_pc);
+        cg.solve();
+      }
+
       std::reference_wrapper<const FES>   m_fes;
       Variational::TrialFunction<FES>     m_trial;
       Variational::TestFunction<FES>      m_test;
-      Variational::Problem<FES, FES, Context::Local, Math::SparseMatrix<Real>, Math::Vector<Real>> m_pb;
+      Variational::Problem<FES, FES, Math::SparseMatrix<Real>, Math::Vector<Real>> m_pb;
+      Variational::EssentialBoundary<ScalarType> m_dbcs;
       Real m_alpha;
-      Solver::CG<Math::SparseMatrix<Real>, Math::Vector<Real>> m_cg;
+      Solver::PreconditionerBase<Math::SparseMatrix<Real>, Math::Vector<Real>>* m_pc;
   };
 }
 
@@ -10,6 +10,8 @@
 #include "Solver/Solver.h"
 
 #include "Solver/LDLT.h"
+#include "Solver/LLT.h"
+#include "Solver/PartialPivLU.h"
 
 // Built-in direct solvers
 #include "Solver/SparseLU.h"
@@ -17,6 +19,12 @@
 #include "Solver/SimplicialLLT.h"
 #include "Solver/SimplicialLDLT.h"
 
+// Preconditioners
+#include "Solver/AMG.h"
+#include "Solver/GMG.h"
+#include "Solver/IC0.h"
+#include "Solver/ILU.h"
+
 // Built-in iteratives solvers
 #include "Solver/CG.h"
 #include "Solver/BiCGSTAB.h"
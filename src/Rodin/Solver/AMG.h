@@ -0,0 +1,414 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_AMG_H
+#define RODIN_SOLVER_AMG_H
+
+#include <vector>
+#include <limits>
+#include <cassert>
+#include <algorithm>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/SparseMatrix.h"
+
+#include "ForwardDecls.h"
+#include "Multigrid.h"
+#include "PatternCache.h"
+#include "Preconditioner.h"
+
+namespace Rodin::Solver
+{
+  /**
+   * @defgroup AMGSpecializations AMG Template Specializations
+   * @brief Template specializations of the AMG class.
+   * @see AMG
+   */
+
+  /**
+   * @ingroup AMGSpecializations
+   * @brief Smoothed aggregation algebraic multigrid preconditioner for use
+   * with Math::SparseMatrix<Real> and Math::Vector<Real>.
+   *
+   * The setup phase builds a hierarchy of operators @f$ A_{l + 1} = P_l^T A_l
+   * P_l @f$. On each level, the nodes are grouped in aggregates of strongly
+   * connected nodes, and the tentative prolongator @f$ T_l @f$, which
+   * interpolates the constants on each aggregate, is smoothed by one damped
+   * Jacobi step:
+   * @f[
+   *   P_l = \left( I - \frac{\omega}{\rho(D_l^{-1} A_l)} D_l^{-1} A_l
+   *   \right) T_l \: .
+   * @f]
+   * The preconditioner applies one V-cycle with symmetric Gauss-Seidel
+   * smoothing and a direct solve on the coarsest level (see
+   * Internal::Multigrid), hence it is symmetric for symmetric operators and
+   * can be used with CG.
+   *
+   * For vector valued spaces, such as the P1 spaces of elasticity problems,
+   * the block size must be set to the vector dimension @f$ m @f$ (see
+   * setBlockSize()). The degrees of freedom are then ordered by component, as
+   * in P1: the @f$ c @f$-th component of the @f$ i @f$-th node of @f$ N @f$
+   * nodes is the degree of freedom @f$ i + c N @f$. The strength of
+   * connection is measured between the @f$ m \times m @f$ blocks of the
+   * nodes, the aggregates contain whole nodes, and each component is
+   * interpolated separately.
+   *
+   * The aggregates are kept after the setup. If the operator passed to
+   * setup() has the same sparsity pattern as the previous one, only the
+   * numerical phase is redone.
+   */
+  template <>
+  class AMG<Math::SparseMatrix<Real>, Math::Vector<Real>> final
+    : public PreconditionerBase<Math::SparseMatrix<Real>, Math::Vector<Real>>
+  {
+    public:
+      using ScalarType = Real;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using OperatorType = Math::SparseMatrix<ScalarType>;
+
+      using RowMajorOperatorType = Eigen::SparseMatrix<ScalarType, Eigen::RowMajor>;
+
+      AMG()
+        : m_blockSize(1),
+          m_threshold(0.08),
+          m_maxLevels(10),
+          m_coarseSize(500),
+          m_omega(4.0 / 3.0)
+      {}
+
+      AMG(const AMG&) = delete;
+
+      void operator=(const AMG&) = delete;
+
+      /**
+       * @brief Sets the number of degrees of freedom per node.
+       */
+      AMG& setBlockSize(size_t blockSize)
+      {
+        assert(blockSize > 0);
+        m_blockSize = blockSize;
+        m_aggregates.clear();
+        return *this;
+      }
+
+      /**
+       * @brief Sets the threshold @f$ \theta @f$ of the strength of
+       * connection.
+       *
+       * The nodes @f$ i @f$ and @f$ j @f$ are strongly connected if @f$
+       * |a_{ij}| \geq \theta \sqrt{|a_{ii} a_{jj}|} @f$.
+       */
+      AMG& setStrengthThreshold(Real threshold)
+      {
+        m_threshold = threshold;
+        m_aggregates.clear();
+        return *this;
+      }
+
+      AMG& setMaxLevels(size_t maxLevels)
+      {
+        assert(maxLevels > 0);
+        m_maxLevels = maxLevels;
+        m_aggregates.clear();
+        return *this;
+      }
+
+      /**
+       * @brief Sets the size below which a level is solved directly.
+       */
+      AMG& setCoarseSize(size_t coarseSize)
+      {
+        m_coarseSize = coarseSize;
+        m_aggregates.clear();
+        return *this;
+      }
+
+      /**
+       * @brief Sets the number of pre and post smoothing steps.
+       */
+      AMG& setSmoothingSteps(size_t steps)
+      {
+        m_mg.setSmoothingSteps(steps);
+        return *this;
+      }
+
+      void setup(const OperatorType& A) override
+      {
+        assert(A.rows() == A.cols());
+        assert(A.rows() % m_blockSize == 0);
+        const bool reuse = !m_aggregates.empty() && m_pattern.matches(A);
+        if (!reuse)
+        {
+          m_aggregates.clear();
+          m_pattern.clear();
+          if (A.isCompressed())
+            m_pattern.set(A);
+        }
+
+        m_mg.initialize(A);
+        for (size_t l = 0; ; l++)
+        {
+          const OperatorType& current = m_mg.getCoarsest();
+          const size_t n = current.rows();
+          if (reuse)
+          {
+            if (l == m_aggregates.size())
+              break;
+          }
+          else
+          {
+            if (l + 1 >= m_maxLevels || n <= m_coarseSize)
+              break;
+            size_t count = 0;
+            std::vector<Index> aggregates = aggregate(current, count);
+            if (count == 0 || count * m_blockSize >= n)
+              break;
+            m_aggregates.push_back({ std::move(aggregates), count });
+          }
+          m_mg.coarsen(getProlongator(current, m_aggregates[l].first, m_aggregates[l].second));
+        }
+        m_mg.finalize();
+      }
+
+      void apply(const VectorType& r, VectorType& z) const override
+      {
+        m_mg.apply(r, z);
+      }
+
+      /**
+       * @brief Gets the number of levels of the hierarchy.
+       */
+      size_t getLevelCount() const
+      {
+        return m_mg.getLevelCount();
+      }
+
+      /**
+       * @brief Gets the operator of the @f$ l @f$-th level.
+       */
+      const RowMajorOperatorType& getOperator(size_t l) const
+      {
+        return m_mg.getOperator(l);
+      }
+
+    private:
+      /**
+       * @brief Aggregates the nodes of @p A and returns the aggregate of
+       * each node.
+       *
+       * Nodes without strong connections, such as the nodes with essential
+       * boundary conditions, are not aggregated. They are handled by the
+       * smoother.
+       */
+      std::vector<Index> aggregate(const OperatorType& A, size_t& count) const
+      {
+        constexpr Index none = std::numeric_limits<Index>::max();
+        constexpr Index isolated = none - 1;
+        const size_t nodes = A.rows() / m_blockSize;
+
+        // Node matrix of the squared Frobenius norms of the blocks
+        std::vector<Eigen::Triplet<ScalarType>> triplets;
+        triplets.reserve(A.nonZeros());
+        for (int j = 0; j < A.outerSize(); ++j)
+        {
+          for (OperatorType::InnerIterator it(A, j); it; ++it)
+            triplets.emplace_back(it.row() % nodes, it.col() % nodes, it.value() * it.value());
+        }
+        OperatorType S(nodes, nodes);
+        S.setFromTriplets(triplets.begin(), triplets.end());
+        triplets.clear();
+
+        const VectorType diag = S.diagonal().cwiseSqrt();
+        std::vector<Index> offsets(nodes + 1, 0);
+        std::vector<Index> neighbors;
+        {
+          std::vector<std::vector<Index>> adjacency(nodes);
+          for (int j = 0; j < S.outerSize(); ++j)
+          {
+            for (OperatorType::InnerIterator it(S, j); it; ++it)
+            {
+              const Index i = it.row();
+              if (i == static_cast<Index>(j))
+                continue;
+              const ScalarType a = std::sqrt(it.value());
+              if (a > m_threshold * std::sqrt(diag(i) * diag(j)))
+              {
+                adjacency[i].push_back(j);
+                adjacency[j].push_back(i);
+              }
+            }
+          }
+          for (size_t i = 0; i < nodes; i++)
+          {
+            auto& adj = adjacency[i];
+            std::sort(adj.begin(), adj.end());
+            adj.erase(std::unique(adj.begin(), adj.end()), adj.end());
+            offsets[i + 1] = offsets[i] + adj.size();
+          }
+          neighbors.reserve(offsets[nodes]);
+          for (size_t i = 0; i < nodes; i++)
+            neighbors.insert(neighbors.end(), adjacency[i].begin(), adjacency[i].end());
+        }
+
+        std::vector<Index> res(nodes, none);
+        count = 0;
+
+        // First pass: aggregates of nodes whose neighborhood is free
+        for (size_t i = 0; i < nodes; i++)
+        {
+          if (offsets[i] == offsets[i + 1])
+          {
+            res[i] = isolated;
+            continue;
+          }
+          if (res[i] != none)
+            continue;
+          bool free = true;
+          for (Index k = offsets[i]; k < offsets[i + 1]; k++)
+          {
+            if (res[neighbors[k]] != none)
+            {
+              free = false;
+              break;
+            }
+          }
+          if (free)
+          {
+            res[i] = count;
+            for (Index k = offsets[i]; k < offsets[i + 1]; k++)
+              res[neighbors[k]] = count;
+            count++;
+          }
+        }
+
+        // Second pass: join the aggregate of a neighbor
+        const std::vector<Index> first = res;
+        for (size_t i = 0; i < nodes; i++)
+        {
+          if (res[i] != none)
+            continue;
+          for (Index k = offsets[i]; k < offsets[i + 1]; k++)
+          {
+            const Index a = first[neighbors[k]];
+            if (a != none && a != isolated)
+            {
+              res[i] = a;
+              break;
+            }
+          }
+        }
+
+        // Third pass: aggregate the remaining nodes with their free neighbors
+        for (size_t i = 0; i < nodes; i++)
+        {
+          if (res[i] != none)
+            continue;
+          res[i] = count;
+          for (Index k = offsets[i]; k < offsets[i + 1]; k++)
+          {
+            if (res[neighbors[k]] == none)
+              res[neighbors[k]] = count;
+          }
+          count++;
+        }
+
+        for (auto& a : res)
+        {
+          if (a == isolated)
+            a = none;
+        }
+        return res;
+      }
+
+      /**
+       * @brief Computes the smoothed prolongator of @p A for the given
+       * aggregates.
+       */
+      OperatorType getProlongator(
+          const OperatorType& A, const std::vector<Index>& aggregates, size_t count) const
+      {
+        constexpr Index none = std::numeric_limits<Index>::max();
+        const size_t bs = m_blockSize;
+        const size_t n = A.rows();
+        const size_t nodes = n / bs;
+
+        std::vector<size_t> sizes(count, 0);
+        for (const Index a : aggregates)
+        {
+          if (a != none)
+            sizes[a]++;
+        }
+
+        std::vector<Eigen::Triplet<ScalarType>> triplets;
+        triplets.reserve(n);
+        for (size_t i = 0; i < aggregates.size(); i++)
+        {
+          const Index a = aggregates[i];
+          if (a == none)
+            continue;
+          const ScalarType v = 1.0 / std::sqrt(static_cast<ScalarType>(sizes[a]));
+          for (size_t c = 0; c < bs; c++)
+            triplets.emplace_back(i + c * nodes, a + c * count, v);
+        }
+        OperatorType T(n, count * bs);
+        T.setFromTriplets(triplets.begin(), triplets.end());
+
+        VectorType invdiag = A.diagonal();
+        for (size_t i = 0; i < n; i++)
+          invdiag(i) = invdiag(i) == ScalarType(0) ? ScalarType(0) : ScalarType(1) / invdiag(i);
+
+        const OperatorType DA = invdiag.asDiagonal() * A;
+        const ScalarType rho = getSpectralRadius(DA);
+        OperatorType P = T - (m_omega / rho) * OperatorType(DA * T);
+        P.prune(ScalarType(0));
+        return P;
+      }
+
+      /**
+       * @brief Estimates the spectral radius of @p A by power iteration.
+       */
+      static ScalarType getSpectralRadius(const OperatorType& A)
+      {
+        VectorType x(A.rows());
+        for (int i = 0; i < x.size(); i++)
+          x(i) = 1 + static_cast<ScalarType>(i % 7) / 7;
+        x.normalize();
+        ScalarType rho = 1;
+        for (size_t k = 0; k < 15; k++)
+        {
+          const VectorType y = A * x;
+          const ScalarType norm = y.norm();
+          if (norm == ScalarType(0))
+            break;
+          rho = norm;
+          x = y / norm;
+        }
+        return rho;
+      }
+
+      size_t m_blockSize;
+      Real m_threshold;
+      size_t m_maxLevels;
+      size_t m_coarseSize;
+      Real m_omega;
+
+      Internal::PatternCache<OperatorType> m_pattern;
+      std::vector<std::pair<std::vector<Index>, size_t>> m_aggregates;
+
+      Internal::Multigrid m_mg;
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for AMG
+   */
+  AMG() -> AMG<Math::SparseMatrix<Real>, Math::Vector<Real>>;
+}
+
+#endif
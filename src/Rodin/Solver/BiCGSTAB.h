@@ -13,9 +13,14 @@
 
 #include "Rodin/Math/Vector.h"
 #include "Rodin/Math/SparseMatrix.h"
+#include "Rodin/Math/LinearOperator.h"
+#include "Rodin/Math/Traits.h"
+#include "Rodin/Math/BlockSparseMatrix.h"
 
 #include "ForwardDecls.h"
 #include "Solver.h"
+#include "Preconditioner.h"
+#include "MatrixFreeSolver.h"
 
 namespace Rodin::Solver
 {
@@ -51,16 +56,25 @@ namespace Rodin::Solver
        * @brief Constructs the BiCGSTAB object with default parameters.
        */
       BiCGSTAB(ProblemType& pb)
-        : Parent(pb)
+        : Parent(pb),
+          m_warmStart(false)
       {}
 
       BiCGSTAB(const BiCGSTAB& other)
-        : Parent(other)
-      {}
+        : Parent(other),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       BiCGSTAB(BiCGSTAB&& other)
-        : Parent(std::move(other))
-      {}
+        : Parent(std::move(other)),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       ~BiCGSTAB() = default;
 
@@ -76,10 +90,37 @@ namespace Rodin::Solver
         return *this;
       }
 
+      /**
+       * @brief Sets whether the previous solution of the problem is used as
+       * the initial guess of the next solve.
+       */
+      BiCGSTAB& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return *this;
+      }
+
+      /**
+       * @brief Sets the preconditioner, which must outlive the solver.
+       *
+       * The setup of the preconditioner is performed at each solve. By
+       * default, the diagonal preconditioner is used.
+       */
+      BiCGSTAB& setPreconditioner(PreconditionerBase<OperatorType, VectorType>& pc)
+      {
+        m_solver.preconditioner().set(pc);
+        return *this;
+      }
+
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
+        if (m_solver.preconditioner().get())
+          m_solver.preconditioner().get()->setup(A);
         m_solver.compute(A);
-        x = m_solver.solve(b);
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
       }
 
       bool success() const
@@ -87,13 +128,19 @@ namespace Rodin::Solver
         return m_solver.info() == Eigen::Success;
       }
 
+      size_t getIterations() const
+      {
+        return m_solver.iterations();
+      }
+
       BiCGSTAB* copy() const noexcept override
       {
         return new BiCGSTAB(*this);
       }
 
     private:
-      Eigen::BiCGSTAB<OperatorType> m_solver;
+      Eigen::BiCGSTAB<OperatorType, Internal::EigenPreconditioner<OperatorType, VectorType>> m_solver;
+      bool m_warmStart;
   };
 
   /**
@@ -103,6 +150,40 @@ namespace Rodin::Solver
   template <class Scalar>
   BiCGSTAB(Variational::ProblemBase<Math::SparseMatrix<Scalar>, Math::Vector<Scalar>, Scalar>&)
     -> BiCGSTAB<Math::SparseMatrix<Scalar>, Math::Vector<Scalar>>;
+
+  /**
+   * @ingroup BiCGSTABSpecializations
+   * @brief Matrix-free BiCGSTAB solver, for use with any Eigen operator
+   * which is neither a dense nor a sparse matrix, such as
+   * Math::LinearOperator or Math::BlockSparseMatrix, and Math::Vector.
+   *
+   * By default, the diagonal preconditioner is used if the operator
+   * provides its diagonal, and no preconditioner is used otherwise.
+   */
+  template <class Operator, class Scalar>
+    requires FormLanguage::IsMatrixFreeOperator<Operator>::Value
+  class BiCGSTAB<Operator, Math::Vector<Scalar>> final
+    : public MatrixFreeSolverBase<
+        BiCGSTAB<Operator, Math::Vector<Scalar>>,
+        Eigen::BiCGSTAB<Operator, Internal::EigenPreconditioner<Operator, Math::Vector<Scalar>>>>
+  {
+    public:
+      using Parent =
+        MatrixFreeSolverBase<
+          BiCGSTAB<Operator, Math::Vector<Scalar>>,
+          Eigen::BiCGSTAB<Operator, Internal::EigenPreconditioner<Operator, Math::Vector<Scalar>>>>;
+
+      using Parent::Parent;
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for BiCGSTAB
+   */
+  template <class Operator>
+    requires FormLanguage::IsMatrixFreeOperator<Operator>::Value
+  BiCGSTAB(const Operator&)
+    -> BiCGSTAB<Operator, Math::Vector<typename Operator::Scalar>>;
 }
 
 #endif
@@ -13,9 +13,14 @@
 
 #include "Rodin/Math/Vector.h"
 #include "Rodin/Math/SparseMatrix.h"
+#include "Rodin/Math/LinearOperator.h"
+#include "Rodin/Math/Traits.h"
+#include "Rodin/Math/BlockSparseMatrix.h"
 
 #include "ForwardDecls.h"
 #include "Solver.h"
+#include "Preconditioner.h"
+#include "MatrixFreeSolver.h"
 
 namespace Rodin::Solver
 {
@@ -51,16 +56,25 @@ namespace Rodin::Solver
        * @brief Constructs the CG object with default parameters.
        */
       CG(ProblemType& pb)
-        : Parent(pb)
+        : Parent(pb),
+          m_warmStart(false)
       {}
 
       CG(const CG& other)
-        : Parent(other)
-      {}
+        : Parent(other),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       CG(CG&& other)
-        : Parent(std::move(other))
-      {}
+        : Parent(std::move(other)),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       ~CG() = default;
 
@@ -76,9 +90,37 @@ namespace Rodin::Solver
         return *this;
       }
 
+      /**
+       * @brief Sets the preconditioner, which must outlive the solver.
+       *
+       * The setup of the preconditioner is performed at each solve. By
+       * default, the diagonal preconditioner is used.
+       */
+      CG& setPreconditioner(PreconditionerBase<OperatorType, VectorType>& pc)
+      {
+        m_solver.preconditioner().set(pc);
+        return *this;
+      }
+
+      /**
+       * @brief Sets whether the previous solution of the problem is used as
+       * the initial guess of the next solve.
+       */
+      CG& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return *this;
+      }
+
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
-        x = m_solver.compute(A).solve(b);
+        if (m_solver.preconditioner().get())
+          m_solver.preconditioner().get()->setup(A);
+        m_solver.compute(A);
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
       }
 
       bool success() const
@@ -86,13 +128,20 @@ namespace Rodin::Solver
         return m_solver.info() == Eigen::Success;
       }
 
+      size_t getIterations() const
+      {
+        return m_solver.iterations();
+      }
+
       CG* copy() const noexcept override
       {
         return new CG(*this);
       }
 
     private:
-      Eigen::ConjugateGradient<OperatorType, Eigen::Lower | Eigen::Upper> m_solver;
+      Eigen::ConjugateGradient<OperatorType, Eigen::Lower | Eigen::Upper,
+        Internal::EigenPreconditioner<OperatorType, VectorType>> m_solver;
+      bool m_warmStart;
   };
 
   /**
@@ -126,11 +175,13 @@ namespace Rodin::Solver
       using Parent::solve;
 
       CG(ProblemType& pb)
-        : Parent(pb)
+        : Parent(pb),
+          m_warmStart(false)
       {}
 
       CG(const CG& other)
-        : Parent(other)
+        : Parent(other),
+          m_warmStart(other.m_warmStart)
       {}
 
       ~CG() = default;
@@ -147,9 +198,23 @@ namespace Rodin::Solver
         return *this;
       }
 
+      /**
+       * @brief Sets whether the previous solution of the problem is used as
+       * the initial guess of the next solve.
+       */
+      CG& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return *this;
+      }
+
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
-        x = m_solver.compute(A).solve(b);
+        m_solver.compute(A);
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
       }
 
       bool success() const
@@ -164,6 +229,7 @@ namespace Rodin::Solver
 
     private:
       Eigen::ConjugateGradient<OperatorType, Eigen::Lower | Eigen::Upper> m_solver;
+      bool m_warmStart;
   };
 
   /**
@@ -173,6 +239,41 @@ namespace Rodin::Solver
   template <class Scalar>
   CG(Variational::ProblemBase<Math::Matrix<Scalar>, Math::Vector<Scalar>, Scalar>&)
     -> CG<Math::Matrix<Scalar>, Math::Vector<Scalar>>;
+
+  /**
+   * @ingroup CGSpecializations
+   * @brief Matrix-free conjugate gradient solver for self-adjoint
+   * problems, for use with any Eigen operator which is neither a dense nor a
+   * sparse matrix, such as Math::LinearOperator or Math::BlockSparseMatrix,
+   * and Math::Vector.
+   *
+   * By default, the diagonal preconditioner is used if the operator
+   * provides its diagonal, and no preconditioner is used otherwise.
+   */
+  template <class Operator, class Scalar>
+    requires FormLanguage::IsMatrixFreeOperator<Operator>::Value
+  class CG<Operator, Math::Vector<Scalar>> final
+    : public MatrixFreeSolverBase<
+        CG<Operator, Math::Vector<Scalar>>,
+        Eigen::ConjugateGradient<Operator, Eigen::Lower | Eigen::Upper, Internal::EigenPreconditioner<Operator, Math::Vector<Scalar>>>>
+  {
+    public:
+      using Parent =
+        MatrixFreeSolverBase<
+          CG<Operator, Math::Vector<Scalar>>,
+          Eigen::ConjugateGradient<Operator, Eigen::Lower | Eigen::Upper, Internal::EigenPreconditioner<Operator, Math::Vector<Scalar>>>>;
+
+      using Parent::Parent;
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for CG
+   */
+  template <class Operator>
+    requires FormLanguage::IsMatrixFreeOperator<Operator>::Value
+  CG(const Operator&)
+    -> CG<Operator, Math::Vector<typename Operator::Scalar>>;
 }
 
 #endif
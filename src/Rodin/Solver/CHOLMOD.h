@@ -20,6 +20,7 @@
 #include "Rodin/Math/SparseMatrix.h"
 
 #include "ForwardDecls.h"
+#include "PatternCache.h"
 #include "Solver.h"
 
 namespace Rodin::Solver::CHOLMOD
@@ -57,7 +58,7 @@ namespace Rodin::Solver::CHOLMOD
 
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
-        m_solver.compute(A);
+        m_pattern.factorize(m_solver, A);
         x = m_solver.solve(b);
       }
 
@@ -73,6 +74,7 @@ namespace Rodin::Solver::CHOLMOD
 
     private:
       Eigen::CholmodSupernodalLLT<OperatorType> m_solver;
+      Internal::PatternCache<OperatorType> m_pattern;
   };
 
   /**
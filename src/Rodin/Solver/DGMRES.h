@@ -18,6 +18,7 @@
 
 #include "ForwardDecls.h"
 #include "Solver.h"
+#include "Preconditioner.h"
 
 namespace Rodin::Solver
 {
@@ -49,23 +50,59 @@ namespace Rodin::Solver
       using Parent::solve;
 
       DGMRES(ProblemType& pb)
-        : Parent(pb)
+        : Parent(pb),
+          m_warmStart(false)
       {}
 
       DGMRES(const DGMRES& other)
-        : Parent(other)
-      {}
+        : Parent(other),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       DGMRES(DGMRES&& other)
-        : Parent(std::move(other))
-      {}
+        : Parent(std::move(other)),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       ~DGMRES() = default;
 
+      /**
+       * @brief Sets whether the previous solution of the problem is used as
+       * the initial guess of the next solve.
+       */
+      DGMRES& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return *this;
+      }
+
+      /**
+       * @brief Sets the preconditioner, which must outlive the solver.
+       *
+       * The setup of the preconditioner is performed at each solve. By
+       * default, the diagonal preconditioner is used.
+       */
+      DGMRES& setPreconditioner(PreconditionerBase<OperatorType, VectorType>& pc)
+      {
+        m_solver.preconditioner().set(pc);
+        return *this;
+      }
+
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
+        if (m_solver.preconditioner().get())
+          m_solver.preconditioner().get()->setup(A);
         m_solver.compute(A);
-        x = m_solver.solve(b);
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
       }
 
       DGMRES& setTolerance(Real tol)
@@ -86,7 +123,8 @@ namespace Rodin::Solver
       }
 
     private:
-      Eigen::DGMRES<OperatorType> m_solver;
+      Eigen::DGMRES<OperatorType, Internal::EigenPreconditioner<OperatorType, VectorType>> m_solver;
+      bool m_warmStart;
   };
 
   /**
@@ -75,6 +75,21 @@ namespace Rodin::Solver
   template <class OperatorType, class VectorType>
   class HouseholderQR;
 
+  /**
+   * @brief Blocked LU decomposition of a dense matrix with partial pivoting.
+   * @see PartialPivLUSpecializations
+   */
+  template <class OperatorType, class VectorType>
+  class PartialPivLU;
+
+  /**
+   * @brief Blocked Cholesky decomposition of a dense symmetric positive
+   * definite matrix.
+   * @see LLTSpecializations
+   */
+  template <class OperatorType, class VectorType>
+  class LLT;
+
   /**
    * @brief Sparse supernodal LU factorization for general matrices.
    * @tparam OperatorType Type of operator for the left hand side
@@ -92,6 +107,42 @@ namespace Rodin::Solver
   template <class OperatorType, class VectorType>
   class SparseQR;
 
+  /**
+   * @brief Smoothed aggregation algebraic multigrid preconditioner.
+   * @tparam OperatorType Type of operator for the left hand side
+   * @tparam VectorType Type of vector for the right hand side
+   * @see AMGSpecializations
+   */
+  template <class OperatorType, class VectorType>
+  class AMG;
+
+  /**
+   * @brief Geometric multigrid preconditioner.
+   * @tparam OperatorType Type of operator for the left hand side
+   * @tparam VectorType Type of vector for the right hand side
+   * @see GMGSpecializations
+   */
+  template <class OperatorType, class VectorType>
+  class GMG;
+
+  /**
+   * @brief Incomplete Cholesky factorization preconditioner without fill-in.
+   * @tparam OperatorType Type of operator for the left hand side
+   * @tparam VectorType Type of vector for the right hand side
+   * @see IC0Specializations
+   */
+  template <class OperatorType, class VectorType>
+  class IC0;
+
+  /**
+   * @brief Incomplete LU factorization preconditioner with level of fill.
+   * @tparam OperatorType Type of operator for the left hand side
+   * @tparam VectorType Type of vector for the right hand side
+   * @see ILUSpecializations
+   */
+  template <class OperatorType, class VectorType>
+  class ILU;
+
   template <class OperatorType, class VectorType>
   class LeastSquaresCG;
 
@@ -0,0 +1,135 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_GMG_H
+#define RODIN_SOLVER_GMG_H
+
+#include <vector>
+#include <cassert>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/SparseMatrix.h"
+
+#include "ForwardDecls.h"
+#include "Multigrid.h"
+#include "Preconditioner.h"
+
+namespace Rodin::Solver
+{
+  /**
+   * @defgroup GMGSpecializations GMG Template Specializations
+   * @brief Template specializations of the GMG class.
+   * @see GMG
+   */
+
+  /**
+   * @ingroup GMGSpecializations
+   * @brief Geometric multigrid preconditioner for use with
+   * Math::SparseMatrix<Real> and Math::Vector<Real>.
+   *
+   * The hierarchy is given by the prolongators between the finite element
+   * spaces of a sequence of nested meshes, from the coarsest to the finest
+   * one, e.g. the P1 prolongators of Geometry::UniformRefinement. Only the
+   * operator of the finest level is assembled: the coarse operators are the
+   * Galerkin products @f$ A_{l + 1} = P_l^T A_l P_l @f$. The preconditioner
+   * applies one V-cycle with symmetric Gauss-Seidel smoothing and a direct
+   * solve on the coarsest level (see Internal::Multigrid), hence it can be
+   * used with CG.
+   *
+   * @code{.cpp}
+   * UniformRefinement refinement(coarse);
+   * Mesh fine = refinement.refine();
+   * Solver::GMG gmg;
+   * gmg.addLevel(refinement.getP1Prolongation());
+   * Solver::CG(problem).setPreconditioner(gmg).solve();
+   * @endcode
+   */
+  template <>
+  class GMG<Math::SparseMatrix<Real>, Math::Vector<Real>> final
+    : public PreconditionerBase<Math::SparseMatrix<Real>, Math::Vector<Real>>
+  {
+    public:
+      using ScalarType = Real;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using OperatorType = Math::SparseMatrix<ScalarType>;
+
+      using RowMajorOperatorType = Eigen::SparseMatrix<ScalarType, Eigen::RowMajor>;
+
+      GMG() = default;
+
+      GMG(const GMG&) = delete;
+
+      void operator=(const GMG&) = delete;
+
+      /**
+       * @brief Adds a finer level to the hierarchy.
+       * @param[in] P Prolongator from the finest level added so far to the
+       * new level
+       */
+      GMG& addLevel(const OperatorType& P)
+      {
+        assert(m_prolongators.empty() || P.cols() == m_prolongators.back().rows());
+        m_prolongators.push_back(P);
+        return *this;
+      }
+
+      /**
+       * @brief Sets the number of pre and post smoothing steps.
+       */
+      GMG& setSmoothingSteps(size_t steps)
+      {
+        m_mg.setSmoothingSteps(steps);
+        return *this;
+      }
+
+      void setup(const OperatorType& A) override
+      {
+        assert(A.rows() == A.cols());
+        assert(m_prolongators.empty() || A.rows() == m_prolongators.back().rows());
+        m_mg.initialize(A);
+        for (auto it = m_prolongators.rbegin(); it != m_prolongators.rend(); ++it)
+          m_mg.coarsen(OperatorType(*it));
+        m_mg.finalize();
+      }
+
+      void apply(const VectorType& r, VectorType& z) const override
+      {
+        m_mg.apply(r, z);
+      }
+
+      /**
+       * @brief Gets the number of levels of the hierarchy.
+       */
+      size_t getLevelCount() const
+      {
+        return m_mg.getLevelCount();
+      }
+
+      /**
+       * @brief Gets the operator of the @f$ l @f$-th level, the finest level
+       * being @f$ l = 0 @f$.
+       */
+      const RowMajorOperatorType& getOperator(size_t l) const
+      {
+        return m_mg.getOperator(l);
+      }
+
+    private:
+      std::vector<OperatorType> m_prolongators;
+      Internal::Multigrid m_mg;
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for GMG
+   */
+  GMG() -> GMG<Math::SparseMatrix<Real>, Math::Vector<Real>>;
+}
+
+#endif
@@ -15,9 +15,14 @@
 #include "Rodin/Configure.h"
 #include "Rodin/Math/Vector.h"
 #include "Rodin/Math/SparseMatrix.h"
+#include "Rodin/Math/LinearOperator.h"
+#include "Rodin/Math/Traits.h"
+#include "Rodin/Math/BlockSparseMatrix.h"
 
 #include "ForwardDecls.h"
 #include "Solver.h"
+#include "Preconditioner.h"
+#include "MatrixFreeSolver.h"
 
 namespace Rodin::Solver
 {
@@ -49,23 +54,59 @@ namespace Rodin::Solver
       using Parent::solve;
 
       GMRES(ProblemType& pb)
-        : Parent(pb)
+        : Parent(pb),
+          m_warmStart(false)
       {}
 
       GMRES(const GMRES& other)
-        : Parent(other)
-      {}
+        : Parent(other),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       GMRES(GMRES&& other)
-        : Parent(std::move(other))
-      {}
+        : Parent(std::move(other)),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       ~GMRES() = default;
 
+      /**
+       * @brief Sets whether the previous solution of the problem is used as
+       * the initial guess of the next solve.
+       */
+      GMRES& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return *this;
+      }
+
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
+        if (m_solver.preconditioner().get())
+          m_solver.preconditioner().get()->setup(A);
         m_solver.compute(A);
-        x = m_solver.solve(b);
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
+      }
+
+      /**
+       * @brief Sets the preconditioner, which must outlive the solver.
+       *
+       * The setup of the preconditioner is performed at each solve. By
+       * default, the diagonal preconditioner is used.
+       */
+      GMRES& setPreconditioner(PreconditionerBase<OperatorType, VectorType>& pc)
+      {
+        m_solver.preconditioner().set(pc);
+        return *this;
       }
 
       GMRES& setTolerance(Real tol)
@@ -86,13 +127,24 @@ namespace Rodin::Solver
         return *this;
       }
 
+      bool success() const
+      {
+        return m_solver.info() == Eigen::Success;
+      }
+
+      size_t getIterations() const
+      {
+        return m_solver.iterations();
+      }
+
       GMRES* copy() const noexcept override
       {
         return new GMRES(*this);
       }
 
     private:
-      Eigen::GMRES<OperatorType> m_solver;
+      Eigen::GMRES<OperatorType, Internal::EigenPreconditioner<OperatorType, VectorType>> m_solver;
+      bool m_warmStart;
   };
 
   /**
@@ -102,6 +154,46 @@ namespace Rodin::Solver
   template <class Scalar>
   GMRES(Variational::ProblemBase<Math::SparseMatrix<Scalar>, Math::Vector<Scalar>, Scalar>&)
     -> GMRES<Math::SparseMatrix<Scalar>, Math::Vector<Scalar>>;
+
+  /**
+   * @ingroup GMRESSpecializations
+   * @brief Matrix-free GMRES solver, for use with any Eigen operator
+   * which is neither a dense nor a sparse matrix, such as
+   * Math::LinearOperator or Math::BlockSparseMatrix, and Math::Vector.
+   *
+   * By default, the diagonal preconditioner is used if the operator
+   * provides its diagonal, and no preconditioner is used otherwise.
+   */
+  template <class Operator, class Scalar>
+    requires FormLanguage::IsMatrixFreeOperator<Operator>::Value
+  class GMRES<Operator, Math::Vector<Scalar>> final
+    : public MatrixFreeSolverBase<
+        GMRES<Operator, Math::Vector<Scalar>>,
+        Eigen::GMRES<Operator, Internal::EigenPreconditioner<Operator, Math::Vector<Scalar>>>>
+  {
+    public:
+      using Parent =
+        MatrixFreeSolverBase<
+          GMRES<Operator, Math::Vector<Scalar>>,
+          Eigen::GMRES<Operator, Internal::EigenPreconditioner<Operator, Math::Vector<Scalar>>>>;
+
+      using Parent::Parent;
+
+      GMRES& setRestart(size_t restart)
+      {
+        this->getSolver().set_restart(restart);
+        return *this;
+      }
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for GMRES
+   */
+  template <class Operator>
+    requires FormLanguage::IsMatrixFreeOperator<Operator>::Value
+  GMRES(const Operator&)
+    -> GMRES<Operator, Math::Vector<typename Operator::Scalar>>;
 }
 
 #endif
@@ -0,0 +1,176 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_IC0_H
+#define RODIN_SOLVER_IC0_H
+
+#include <cmath>
+#include <vector>
+#include <cassert>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/SparseMatrix.h"
+#include "Rodin/Alert/MemberFunctionException.h"
+
+#include "ForwardDecls.h"
+#include "Preconditioner.h"
+#include "TriangularSolver.h"
+
+namespace Rodin::Solver
+{
+  /**
+   * @defgroup IC0Specializations IC0 Template Specializations
+   * @brief Template specializations of the IC0 class.
+   * @see IC0
+   */
+
+  /**
+   * @ingroup IC0Specializations
+   * @brief Incomplete Cholesky factorization without fill-in, for use with
+   * Math::SparseMatrix<Real> and Math::Vector<Real>.
+   *
+   * The lower triangular factor @f$ L @f$ of @f$ A \approx L L^T @f$ has
+   * the pattern of the lower triangular part of the symmetric positive
+   * definite operator @f$ A @f$. If a nonpositive pivot appears, the
+   * factorization is restarted on @f$ A + \alpha \operatorname{diag}(A) @f$
+   * with an increasing shift @f$ \alpha @f$ (see getShift()).
+   *
+   * The preconditioner is symmetric positive definite, hence it can be used
+   * with CG. The triangular solves of apply() use level scheduling (see
+   * Internal::TriangularSolver).
+   */
+  template <>
+  class IC0<Math::SparseMatrix<Real>, Math::Vector<Real>> final
+    : public PreconditionerBase<Math::SparseMatrix<Real>, Math::Vector<Real>>
+  {
+    public:
+      using ScalarType = Real;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using OperatorType = Math::SparseMatrix<ScalarType>;
+
+      using RowMajorOperatorType = Eigen::SparseMatrix<ScalarType, Eigen::RowMajor>;
+
+      IC0()
+        : m_shift(0)
+      {}
+
+      IC0(const IC0&) = delete;
+
+      void operator=(const IC0&) = delete;
+
+      void setup(const OperatorType& A) override
+      {
+        assert(A.rows() == A.cols());
+        RowMajorOperatorType a = A.triangularView<Eigen::Lower>();
+        a.makeCompressed();
+        for (int i = 0; i < a.outerSize(); i++)
+        {
+          const int last = a.outerIndexPtr()[i + 1] - 1;
+          if (last < a.outerIndexPtr()[i] || a.innerIndexPtr()[last] != i
+              || a.valuePtr()[last] <= ScalarType(0))
+          {
+            Alert::MemberFunctionException(*this, __func__)
+              << "The operator must have a positive diagonal."
+              << Alert::Raise;
+          }
+        }
+
+        m_shift = 0;
+        while (!factorize(a))
+          m_shift = m_shift == 0 ? 1e-3 : 2 * m_shift;
+      }
+
+      void apply(const VectorType& r, VectorType& z) const override
+      {
+        z = r;
+        m_lower.solve(z);
+        m_upper.solve(z);
+      }
+
+      /**
+       * @brief Gets the shift @f$ \alpha @f$ of the diagonal used by the last
+       * setup.
+       */
+      Real getShift() const
+      {
+        return m_shift;
+      }
+
+    private:
+      /**
+       * @brief Computes @f$ L @f$ row by row, or returns false if a pivot is
+       * not positive.
+       */
+      bool factorize(const RowMajorOperatorType& a)
+      {
+        const int n = a.rows();
+        const int* offsets = a.outerIndexPtr();
+        const int* cols = a.innerIndexPtr();
+        std::vector<ScalarType> values(a.valuePtr(), a.valuePtr() + a.nonZeros());
+        for (int i = 0; i < n; i++)
+        {
+          const int diagonal = offsets[i + 1] - 1;
+          for (int p = offsets[i]; p < diagonal; p++)
+          {
+            // Dot product of the rows i and j of L, before the column j
+            const int j = cols[p];
+            ScalarType s = values[p];
+            int q = offsets[i];
+            int r = offsets[j];
+            while (q < p && r < offsets[j + 1] - 1)
+            {
+              if (cols[q] < cols[r])
+                q++;
+              else if (cols[r] < cols[q])
+                r++;
+              else
+                s -= values[q++] * values[r++];
+            }
+            values[p] = s / values[offsets[j + 1] - 1];
+          }
+
+          ScalarType d = (1 + m_shift) * values[diagonal];
+          for (int p = offsets[i]; p < diagonal; p++)
+            d -= values[p] * values[p];
+          if (!(d > ScalarType(0)))
+            return false;
+          values[diagonal] = std::sqrt(d);
+        }
+
+        RowMajorOperatorType L(n, n);
+        L.reserve(a.nonZeros() - n);
+        VectorType diagonal(n);
+        for (int i = 0; i < n; i++)
+        {
+          L.startVec(i);
+          for (int p = offsets[i]; p < offsets[i + 1] - 1; p++)
+            L.insertBack(i, cols[p]) = values[p];
+          diagonal(i) = values[offsets[i + 1] - 1];
+        }
+        L.finalize();
+        RowMajorOperatorType U = L.transpose();
+        VectorType copy = diagonal;
+        m_lower.compute(std::move(L), std::move(diagonal), true);
+        m_upper.compute(std::move(U), std::move(copy), false);
+        return true;
+      }
+
+      Real m_shift;
+      Internal::TriangularSolver m_lower;
+      Internal::TriangularSolver m_upper;
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for IC0
+   */
+  IC0() -> IC0<Math::SparseMatrix<Real>, Math::Vector<Real>>;
+}
+
+#endif
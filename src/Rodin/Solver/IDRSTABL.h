@@ -18,6 +18,7 @@
 
 #include "ForwardDecls.h"
 #include "Solver.h"
+#include "Preconditioner.h"
 
 namespace Rodin::Solver
 {
@@ -49,23 +50,59 @@ namespace Rodin::Solver
       using Parent::solve;
 
       IDRSTABL(ProblemType& pb)
-        : Parent(pb)
+        : Parent(pb),
+          m_warmStart(false)
       {}
 
       IDRSTABL(const IDRSTABL& other)
-        : Parent(other)
-      {}
+        : Parent(other),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       IDRSTABL(IDRSTABL&& other)
-        : Parent(std::move(other))
-      {}
+        : Parent(std::move(other)),
+          m_warmStart(other.m_warmStart)
+      {
+        if (other.m_solver.preconditioner().get())
+          m_solver.preconditioner().set(*other.m_solver.preconditioner().get());
+      }
 
       ~IDRSTABL() = default;
 
+      /**
+       * @brief Sets whether the previous solution of the problem is used as
+       * the initial guess of the next solve.
+       */
+      IDRSTABL& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return *this;
+      }
+
+      /**
+       * @brief Sets the preconditioner, which must outlive the solver.
+       *
+       * The setup of the preconditioner is performed at each solve. By
+       * default, the diagonal preconditioner is used.
+       */
+      IDRSTABL& setPreconditioner(PreconditionerBase<OperatorType, VectorType>& pc)
+      {
+        m_solver.preconditioner().set(pc);
+        return *this;
+      }
+
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
+        if (m_solver.preconditioner().get())
+          m_solver.preconditioner().get()->setup(A);
         m_solver.compute(A);
-        x = m_solver.solve(b);
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
       }
 
       IDRSTABL& setMaxIterations(size_t it)
@@ -91,7 +128,8 @@ namespace Rodin::Solver
       }
 
     private:
-      Eigen::IDRSTABL<OperatorType> m_solver;
+      Eigen::IDRSTABL<OperatorType, Internal::EigenPreconditioner<OperatorType, VectorType>> m_solver;
+      bool m_warmStart;
   };
 
   /**
@@ -0,0 +1,269 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_ILU_H
+#define RODIN_SOLVER_ILU_H
+
+#include <cmath>
+#include <queue>
+#include <limits>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/SparseMatrix.h"
+
+#include "ForwardDecls.h"
+#include "PatternCache.h"
+#include "Preconditioner.h"
+#include "TriangularSolver.h"
+
+namespace Rodin::Solver
+{
+  /**
+   * @defgroup ILUSpecializations ILU Template Specializations
+   * @brief Template specializations of the ILU class.
+   * @see ILU
+   */
+
+  /**
+   * @ingroup ILUSpecializations
+   * @brief Incomplete LU factorization with level of fill @f$ k @f$, for
+   * use with Math::SparseMatrix<Real> and Math::Vector<Real>.
+   *
+   * The factors @f$ L @f$ and @f$ U @f$ of @f$ A \approx LU @f$ keep the
+   * entries whose level of fill is at most @f$ k @f$, where the entries of
+   * @f$ A @f$ have level @f$ 0 @f$ and a fill-in entry created by the
+   * elimination of the entries @f$ (i, m) @f$ and @f$ (m, j) @f$ has level
+   * @f$ \mathrm{lev}(i, m) + \mathrm{lev}(m, j) + 1 @f$. Hence ILU(0) keeps
+   * the pattern of @f$ A @f$.
+   *
+   * The pattern of the factors is kept after the setup, and is only
+   * recomputed if the sparsity pattern of the operator changes. The
+   * triangular solves of apply() use level scheduling (see
+   * Internal::TriangularSolver).
+   */
+  template <>
+  class ILU<Math::SparseMatrix<Real>, Math::Vector<Real>> final
+    : public PreconditionerBase<Math::SparseMatrix<Real>, Math::Vector<Real>>
+  {
+    public:
+      using ScalarType = Real;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using OperatorType = Math::SparseMatrix<ScalarType>;
+
+      using RowMajorOperatorType = Eigen::SparseMatrix<ScalarType, Eigen::RowMajor>;
+
+      ILU()
+        : m_fill(0)
+      {}
+
+      ILU(const ILU&) = delete;
+
+      void operator=(const ILU&) = delete;
+
+      /**
+       * @brief Sets the level of fill @f$ k @f$.
+       */
+      ILU& setFillLevel(size_t k)
+      {
+        m_fill = k;
+        m_pattern.clear();
+        return *this;
+      }
+
+      size_t getFillLevel() const
+      {
+        return m_fill;
+      }
+
+      void setup(const OperatorType& A) override
+      {
+        assert(A.rows() == A.cols());
+        const RowMajorOperatorType a = A;
+        if (!m_pattern.matches(A))
+        {
+          symbolic(a);
+          m_pattern.clear();
+          if (A.isCompressed())
+            m_pattern.set(A);
+        }
+        numeric(a);
+      }
+
+      void apply(const VectorType& r, VectorType& z) const override
+      {
+        z = r;
+        m_lower.solve(z);
+        m_upper.solve(z);
+      }
+
+      /**
+       * @brief Gets the number of nonzero entries of @f$ L + U @f$.
+       */
+      size_t getNonZeros() const
+      {
+        return m_cols.size();
+      }
+
+    private:
+      static constexpr size_t None = std::numeric_limits<size_t>::max();
+
+      /**
+       * @brief Computes the pattern of @f$ L + U @f$, row by row, from the
+       * levels of fill of the rows above.
+       */
+      void symbolic(const RowMajorOperatorType& a)
+      {
+        const size_t n = a.rows();
+        std::vector<size_t> level(n, None);
+        std::vector<size_t> levels;
+        std::vector<Index> row;
+        m_offsets.assign(1, 0);
+        m_diagonal.resize(n);
+        m_cols.clear();
+        for (size_t i = 0; i < n; i++)
+        {
+          row.clear();
+          std::priority_queue<Index, std::vector<Index>, std::greater<Index>> lower;
+          for (RowMajorOperatorType::InnerIterator it(a, i); it; ++it)
+          {
+            level[it.col()] = 0;
+            row.push_back(it.col());
+            if (static_cast<size_t>(it.col()) < i)
+              lower.push(it.col());
+          }
+          if (level[i] == None)
+          {
+            level[i] = 0;
+            row.push_back(i);
+          }
+
+          // Eliminate the lower entries in increasing order
+          while (!lower.empty())
+          {
+            const Index m = lower.top();
+            lower.pop();
+            for (size_t p = m_diagonal[m] + 1; p < m_offsets[m + 1]; p++)
+            {
+              const Index j = m_cols[p];
+              const size_t l = level[m] + levels[p] + 1;
+              if (l > m_fill)
+                continue;
+              if (level[j] == None)
+              {
+                level[j] = l;
+                row.push_back(j);
+                if (j < i)
+                  lower.push(j);
+              }
+              else
+              {
+                level[j] = std::min(level[j], l);
+              }
+            }
+          }
+
+          std::sort(row.begin(), row.end());
+          for (const Index j : row)
+          {
+            if (j == i)
+              m_diagonal[i] = m_cols.size();
+            m_cols.push_back(j);
+            levels.push_back(level[j]);
+            level[j] = None;
+          }
+          m_offsets.push_back(m_cols.size());
+        }
+      }
+
+      /**
+       * @brief Computes the entries of the factors with the IKJ variant of
+       * the Gaussian elimination, restricted to the pattern.
+       */
+      void numeric(const RowMajorOperatorType& a)
+      {
+        const size_t n = a.rows();
+        std::vector<ScalarType> values(m_cols.size(), 0);
+        std::vector<size_t> position(n, None);
+        for (size_t i = 0; i < n; i++)
+        {
+          for (size_t p = m_offsets[i]; p < m_offsets[i + 1]; p++)
+            position[m_cols[p]] = p;
+
+          ScalarType norm = 0;
+          for (RowMajorOperatorType::InnerIterator it(a, i); it; ++it)
+          {
+            assert(position[it.col()] != None);
+            values[position[it.col()]] = it.value();
+            norm = std::max(norm, std::abs(it.value()));
+          }
+
+          for (size_t p = m_offsets[i]; p < m_diagonal[i]; p++)
+          {
+            const Index m = m_cols[p];
+            values[p] /= values[m_diagonal[m]];
+            const ScalarType lim = values[p];
+            for (size_t q = m_diagonal[m] + 1; q < m_offsets[m + 1]; q++)
+            {
+              const size_t k = position[m_cols[q]];
+              if (k != None)
+                values[k] -= lim * values[q];
+            }
+          }
+
+          // Replace the vanishing pivots
+          ScalarType& pivot = values[m_diagonal[i]];
+          if (std::abs(pivot) <= std::numeric_limits<ScalarType>::epsilon() * norm)
+            pivot = norm > 0 ? std::sqrt(std::numeric_limits<ScalarType>::epsilon()) * norm : 1;
+
+          for (size_t p = m_offsets[i]; p < m_offsets[i + 1]; p++)
+            position[m_cols[p]] = None;
+        }
+
+        RowMajorOperatorType L(n, n), U(n, n);
+        L.reserve(m_cols.size());
+        U.reserve(m_cols.size());
+        VectorType diagonal(n);
+        for (size_t i = 0; i < n; i++)
+        {
+          L.startVec(i);
+          for (size_t p = m_offsets[i]; p < m_diagonal[i]; p++)
+            L.insertBack(i, m_cols[p]) = values[p];
+          U.startVec(i);
+          for (size_t p = m_diagonal[i] + 1; p < m_offsets[i + 1]; p++)
+            U.insertBack(i, m_cols[p]) = values[p];
+          diagonal(i) = values[m_diagonal[i]];
+        }
+        L.finalize();
+        U.finalize();
+        m_lower.compute(std::move(L), VectorType(), true);
+        m_upper.compute(std::move(U), std::move(diagonal), false);
+      }
+
+      size_t m_fill;
+
+      std::vector<size_t> m_offsets;
+      std::vector<size_t> m_diagonal;
+      std::vector<Index> m_cols;
+      Internal::PatternCache<OperatorType> m_pattern;
+
+      Internal::TriangularSolver m_lower;
+      Internal::TriangularSolver m_upper;
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for ILU
+   */
+  ILU() -> ILU<Math::SparseMatrix<Real>, Math::Vector<Real>>;
+}
+
+#endif
@@ -0,0 +1,87 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_LLT_H
+#define RODIN_SOLVER_LLT_H
+
+#include <Eigen/Cholesky>
+
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/Matrix.h"
+
+#include "ForwardDecls.h"
+#include "Solver.h"
+
+namespace Rodin::Solver
+{
+  /**
+   * @defgroup LLTSpecializations LLT Template Specializations
+   * @brief Template specializations of the LLT class.
+   * @see LLT
+   */
+
+  /**
+   * @ingroup LLTSpecializations
+   * @brief A direct dense LLT Cholesky factorization for use with
+   * symmetric positive definite Math::Matrix and Math::Vector.
+   *
+   * The factorization is blocked, and most of its work is spent in
+   * rank updates of the trailing matrix.
+   */
+  template <class Scalar>
+  class LLT<Math::Matrix<Scalar>, Math::Vector<Scalar>> final
+    : public SolverBase<Math::Matrix<Scalar>, Math::Vector<Scalar>, Scalar>
+  {
+    public:
+      using ScalarType = Scalar;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using OperatorType = Math::Matrix<ScalarType>;
+
+      using ProblemType = Variational::ProblemBase<OperatorType, VectorType, ScalarType>;
+
+      using Parent = SolverBase<OperatorType, VectorType, ScalarType>;
+
+      using Parent::solve;
+
+      LLT(ProblemType& pb)
+        : Parent(pb)
+      {}
+
+      LLT(const LLT& other)
+        : Parent(other)
+      {}
+
+      LLT(LLT&& other)
+        : Parent(std::move(other))
+      {}
+
+      void solve(OperatorType& A, VectorType& x, VectorType& b) override
+      {
+        x = m_solver.compute(A).solve(b);
+      }
+
+      inline
+      LLT* copy() const noexcept override
+      {
+        return new LLT(*this);
+      }
+
+    private:
+      Eigen::LLT<OperatorType> m_solver;
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for LLT
+   */
+  template <class Scalar>
+  LLT(Variational::ProblemBase<Math::Matrix<Scalar>, Math::Vector<Scalar>, Scalar>&)
+    -> LLT<Math::Matrix<Scalar>, Math::Vector<Scalar>>;
+}
+
+#endif
@@ -48,15 +48,18 @@ namespace Rodin::Solver
       using Parent::solve;
 
       LeastSquaresCG(ProblemType& pb)
-        : Parent(pb)
+        : Parent(pb),
+          m_warmStart(false)
       {}
 
       LeastSquaresCG(const LeastSquaresCG& other)
-        : Parent(other)
+        : Parent(other),
+          m_warmStart(other.m_warmStart)
       {}
 
       LeastSquaresCG(LeastSquaresCG&& other)
-        : Parent(std::move(other))
+        : Parent(std::move(other)),
+          m_warmStart(other.m_warmStart)
       {}
 
       ~LeastSquaresCG() = default;
@@ -73,9 +76,23 @@ namespace Rodin::Solver
         return *this;
       }
 
+      /**
+       * @brief Sets whether the previous solution of the problem is used as
+       * the initial guess of the next solve.
+       */
+      LeastSquaresCG& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return *this;
+      }
+
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
-        x = m_solver.compute(A).solve(b);
+        m_solver.compute(A);
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
       }
 
       inline
@@ -86,6 +103,7 @@ namespace Rodin::Solver
 
     private:
       Eigen::LeastSquaresConjugateGradient<OperatorType> m_solver;
+      bool m_warmStart;
   };
 
   template <class Scalar>
@@ -123,15 +141,18 @@ namespace Rodin::Solver
       using Parent::solve;
 
       LeastSquaresCG(ProblemType& pb)
-        : Parent(pb)
+        : Parent(pb),
+          m_warmStart(false)
       {}
 
       LeastSquaresCG(const LeastSquaresCG& other)
-        : Parent(other)
+        : Parent(other),
+          m_warmStart(other.m_warmStart)
       {}
 
       LeastSquaresCG(LeastSquaresCG&& other)
-        : Parent(std::move(other))
+        : Parent(std::move(other)),
+          m_warmStart(other.m_warmStart)
       {}
 
       ~LeastSquaresCG() = default;
@@ -148,10 +169,23 @@ namespace Rodin::Solver
         return *this;
       }
 
+      /**
+       * @brief Sets whether the previous solution of the problem is used as
+       * the initial guess of the next solve.
+       */
+      LeastSquaresCG& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return *this;
+      }
+
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
         m_solver.compute(A);
-        x = m_solver.solve(b);
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
       }
 
       inline
@@ -162,6 +196,7 @@ namespace Rodin::Solver
 
     private:
       Eigen::LeastSquaresConjugateGradient<OperatorType> m_solver;
+      bool m_warmStart;
   };
 
   template <class Scalar>
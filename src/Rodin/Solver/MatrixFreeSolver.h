@@ -0,0 +1,137 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_MATRIXFREESOLVER_H
+#define RODIN_SOLVER_MATRIXFREESOLVER_H
+
+#include <functional>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+
+#include "ForwardDecls.h"
+#include "Preconditioner.h"
+
+namespace Rodin::Solver
+{
+  /**
+   * @brief Base class of the iterative solvers which are constructed
+   * directly from an operator, instead of from a Variational::ProblemBase
+   * object.
+   *
+   * @tparam Derived Type of the solver, returned by the setters
+   * @tparam EigenSolver Eigen iterative solver which performs the
+   * iterations, with an Internal::EigenPreconditioner
+   *
+   * The initial guess is zero unless warm starting is enabled with
+   * setWarmStart().
+   */
+  template <class Derived, class EigenSolver>
+  class MatrixFreeSolverBase
+  {
+    public:
+      using SolverType = EigenSolver;
+
+      using OperatorType = typename SolverType::MatrixType;
+
+      using ScalarType = typename OperatorType::Scalar;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      /**
+       * @brief Constructs the solver for the given operator.
+       *
+       * The operator must outlive the solver.
+       */
+      MatrixFreeSolverBase(const OperatorType& op)
+        : m_operator(op),
+          m_warmStart(false)
+      {}
+
+      MatrixFreeSolverBase(const MatrixFreeSolverBase&) = default;
+
+      MatrixFreeSolverBase(MatrixFreeSolverBase&&) = default;
+
+      Derived& setTolerance(Real tol)
+      {
+        m_solver.setTolerance(tol);
+        return static_cast<Derived&>(*this);
+      }
+
+      Derived& setMaxIterations(size_t maxIt)
+      {
+        m_solver.setMaxIterations(maxIt);
+        return static_cast<Derived&>(*this);
+      }
+
+      /**
+       * @brief Sets whether the value of @p x passed to solve() is used as
+       * the initial guess.
+       */
+      Derived& setWarmStart(bool warmStart = true)
+      {
+        m_warmStart = warmStart;
+        return static_cast<Derived&>(*this);
+      }
+
+      /**
+       * @brief Sets the preconditioner, which must outlive the solver.
+       *
+       * The setup of the preconditioner is performed at each solve.
+       */
+      Derived& setPreconditioner(PreconditionerBase<OperatorType, VectorType>& pc)
+      {
+        m_solver.preconditioner().set(pc);
+        return static_cast<Derived&>(*this);
+      }
+
+      /**
+       * @brief Solves @f$ Ax = b @f$.
+       *
+       * If warm starting is enabled and @p x has the size of @p b, it is
+       * used as the initial guess. Otherwise the initial guess is zero and
+       * the value of @p x is ignored.
+       */
+      void solve(VectorType& x, const VectorType& b)
+      {
+        if (m_solver.preconditioner().get())
+          m_solver.preconditioner().get()->setup(m_operator.get());
+        m_solver.compute(m_operator.get());
+        if (m_warmStart && x.size() == b.size())
+          x = m_solver.solveWithGuess(b, x);
+        else
+          x = m_solver.solve(b);
+      }
+
+      bool success() const
+      {
+        return m_solver.info() == Eigen::Success;
+      }
+
+      size_t getIterations() const
+      {
+        return m_solver.iterations();
+      }
+
+      const OperatorType& getOperator() const
+      {
+        return m_operator.get();
+      }
+
+    protected:
+      SolverType& getSolver()
+      {
+        return m_solver;
+      }
+
+    private:
+      std::reference_wrapper<const OperatorType> m_operator;
+      SolverType m_solver;
+      bool m_warmStart;
+  };
+}
+
+#endif
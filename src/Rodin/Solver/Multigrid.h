@@ -0,0 +1,186 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_MULTIGRID_H
+#define RODIN_SOLVER_MULTIGRID_H
+
+#include <vector>
+#include <cassert>
+
+#include <Eigen/SparseLU>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/SparseMatrix.h"
+
+namespace Rodin::Solver::Internal
+{
+  /**
+   * @brief Hierarchy of Galerkin operators @f$ A_{l + 1} = P_l^T A_l P_l @f$
+   * and its V-cycle.
+   *
+   * The V-cycle uses forward Gauss-Seidel pre-smoothing, backward
+   * Gauss-Seidel post-smoothing, and a direct solve on the coarsest level.
+   * Hence it is symmetric for symmetric operators. It is shared by the
+   * algebraic and geometric multigrid preconditioners, which only differ in
+   * the way they compute the prolongators @f$ P_l @f$.
+   */
+  class Multigrid
+  {
+    public:
+      using ScalarType = Real;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using OperatorType = Math::SparseMatrix<ScalarType>;
+
+      using RowMajorOperatorType = Eigen::SparseMatrix<ScalarType, Eigen::RowMajor>;
+
+      Multigrid()
+        : m_smoothingSteps(1),
+          m_finest(nullptr)
+      {}
+
+      Multigrid(const Multigrid&) = delete;
+
+      void operator=(const Multigrid&) = delete;
+
+      void setSmoothingSteps(size_t steps)
+      {
+        m_smoothingSteps = steps;
+      }
+
+      /**
+       * @brief Clears the hierarchy and sets the operator of the finest
+       * level.
+       *
+       * @p A must not be destroyed before the call to finalize().
+       */
+      void initialize(const OperatorType& A)
+      {
+        assert(A.rows() == A.cols());
+        m_levels.clear();
+        m_levels.emplace_back();
+        m_levels.back().A = A;
+        m_finest = &A;
+        m_coarsest = OperatorType();
+      }
+
+      /**
+       * @brief Gets the operator of the coarsest level built so far.
+       */
+      const OperatorType& getCoarsest() const
+      {
+        return m_levels.size() == 1 ? *m_finest : m_coarsest;
+      }
+
+      /**
+       * @brief Adds a coarser level, whose operator is @f$ P^T A P @f$ where
+       * @f$ A @f$ is the operator of the coarsest level.
+       */
+      void coarsen(OperatorType&& P)
+      {
+        assert(m_finest);
+        const OperatorType& A = getCoarsest();
+        assert(P.rows() == A.rows());
+        auto& level = m_levels.back();
+        level.P = std::move(P);
+        level.R = level.P.transpose();
+        OperatorType next = level.R * (A * level.P);
+        next.prune(ScalarType(0));
+        m_coarsest = std::move(next);
+        m_levels.emplace_back();
+        m_levels.back().A = m_coarsest;
+      }
+
+      /**
+       * @brief Factorizes the operator of the coarsest level.
+       */
+      void finalize()
+      {
+        OperatorType a = getCoarsest();
+        a.makeCompressed();
+        m_coarse.compute(a);
+        m_finest = nullptr;
+      }
+
+      void apply(const VectorType& r, VectorType& z) const
+      {
+        assert(m_levels.size() > 0);
+        z.setZero(r.size());
+        cycle(0, r, z);
+      }
+
+      size_t getLevelCount() const
+      {
+        return m_levels.size();
+      }
+
+      const RowMajorOperatorType& getOperator(size_t l) const
+      {
+        assert(l < m_levels.size());
+        return m_levels[l].A;
+      }
+
+    private:
+      struct Level
+      {
+        RowMajorOperatorType A;
+        OperatorType P;
+        OperatorType R;
+      };
+
+      static void smooth(const RowMajorOperatorType& A, const VectorType& b, VectorType& x, bool forward)
+      {
+        const int n = A.rows();
+        for (int k = 0; k < n; k++)
+        {
+          const int i = forward ? k : n - 1 - k;
+          ScalarType s = b(i);
+          ScalarType d = 0;
+          for (RowMajorOperatorType::InnerIterator it(A, i); it; ++it)
+          {
+            if (it.col() == i)
+              d = it.value();
+            else
+              s -= it.value() * x(it.col());
+          }
+          if (d != ScalarType(0))
+            x(i) = s / d;
+        }
+      }
+
+      void cycle(size_t l, const VectorType& b, VectorType& x) const
+      {
+        if (l + 1 == m_levels.size())
+        {
+          x = m_coarse.solve(b);
+          return;
+        }
+
+        const auto& level = m_levels[l];
+        for (size_t s = 0; s < m_smoothingSteps; s++)
+          smooth(level.A, b, x, true);
+
+        const VectorType r = b - level.A * x;
+        const VectorType bc = level.R * r;
+        VectorType xc = VectorType::Zero(bc.size());
+        cycle(l + 1, bc, xc);
+        x += level.P * xc;
+
+        for (size_t s = 0; s < m_smoothingSteps; s++)
+          smooth(level.A, b, x, false);
+      }
+
+      size_t m_smoothingSteps;
+      const OperatorType* m_finest;
+      OperatorType m_coarsest;
+      std::vector<Level> m_levels;
+      Eigen::SparseLU<OperatorType> m_coarse;
+  };
+}
+
+#endif
@@ -0,0 +1,88 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_PARTIALPIVLU_H
+#define RODIN_SOLVER_PARTIALPIVLU_H
+
+#include <Eigen/LU>
+
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/Matrix.h"
+
+#include "ForwardDecls.h"
+#include "Solver.h"
+
+namespace Rodin::Solver
+{
+  /**
+   * @defgroup PartialPivLUSpecializations PartialPivLU Template Specializations
+   * @brief Template specializations of the PartialPivLU class.
+   * @see PartialPivLU
+   */
+
+  /**
+   * @ingroup PartialPivLUSpecializations
+   * @brief A direct dense LU factorization with partial pivoting for use with
+   * Math::Matrix and Math::Vector.
+   *
+   * The factorization is blocked, and most of its work is spent in
+   * matrix-matrix products. These products are multithreaded when Eigen is
+   * compiled with OpenMP (see RODIN_USE_OPENMP).
+   */
+  template <class Scalar>
+  class PartialPivLU<Math::Matrix<Scalar>, Math::Vector<Scalar>> final
+    : public SolverBase<Math::Matrix<Scalar>, Math::Vector<Scalar>, Scalar>
+  {
+    public:
+      using ScalarType = Scalar;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using OperatorType = Math::Matrix<ScalarType>;
+
+      using ProblemType = Variational::ProblemBase<OperatorType, VectorType, ScalarType>;
+
+      using Parent = SolverBase<OperatorType, VectorType, ScalarType>;
+
+      using Parent::solve;
+
+      PartialPivLU(ProblemType& pb)
+        : Parent(pb)
+      {}
+
+      PartialPivLU(const PartialPivLU& other)
+        : Parent(other)
+      {}
+
+      PartialPivLU(PartialPivLU&& other)
+        : Parent(std::move(other))
+      {}
+
+      void solve(OperatorType& A, VectorType& x, VectorType& b) override
+      {
+        x = m_solver.compute(A).solve(b);
+      }
+
+      inline
+      PartialPivLU* copy() const noexcept override
+      {
+        return new PartialPivLU(*this);
+      }
+
+    private:
+      Eigen::PartialPivLU<OperatorType> m_solver;
+  };
+
+  /**
+   * @ingroup RodinCTAD
+   * @brief CTAD for PartialPivLU
+   */
+  template <class Scalar>
+  PartialPivLU(Variational::ProblemBase<Math::Matrix<Scalar>, Math::Vector<Scalar>, Scalar>&)
+    -> PartialPivLU<Math::Matrix<Scalar>, Math::Vector<Scalar>>;
+}
+
+#endif
@@ -0,0 +1,110 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_PATTERNCACHE_H
+#define RODIN_SOLVER_PATTERNCACHE_H
+
+#include <vector>
+#include <algorithm>
+
+#include <Eigen/Core>
+
+#include "Rodin/Math/SparseMatrix.h"
+
+namespace Rodin::Solver::Internal
+{
+  /**
+   * @brief Copy of the sparsity pattern of the last operator passed to a
+   * solver.
+   *
+   * It allows the sparse direct solvers to skip the symbolic analysis when
+   * they are called again with an operator which has the same sparsity
+   * pattern, e.g. in time stepping or optimization loops where only the
+   * coefficients change.
+   */
+  template <class OperatorType>
+  class PatternCache
+  {
+    public:
+      using StorageIndex = typename OperatorType::StorageIndex;
+
+      PatternCache() = default;
+
+      /**
+       * @brief The pattern is not copied, hence copies of a solver redo the
+       * symbolic analysis.
+       */
+      PatternCache(const PatternCache&)
+      {}
+
+      PatternCache(PatternCache&&) = default;
+
+      PatternCache& operator=(const PatternCache&)
+      {
+        clear();
+        return *this;
+      }
+
+      PatternCache& operator=(PatternCache&&) = default;
+
+      /**
+       * @brief Determines if the compressed operator @p A has the cached
+       * pattern.
+       */
+      bool matches(const OperatorType& A) const
+      {
+        if (m_outer.empty() || !A.isCompressed())
+          return false;
+        if (m_outer.size() != static_cast<size_t>(A.outerSize() + 1))
+          return false;
+        if (m_inner.size() != static_cast<size_t>(A.nonZeros()))
+          return false;
+        return std::equal(m_outer.begin(), m_outer.end(), A.outerIndexPtr())
+          && std::equal(m_inner.begin(), m_inner.end(), A.innerIndexPtr());
+      }
+
+      /**
+       * @brief Caches the pattern of the compressed operator @p A.
+       */
+      void set(const OperatorType& A)
+      {
+        assert(A.isCompressed());
+        m_outer.assign(A.outerIndexPtr(), A.outerIndexPtr() + A.outerSize() + 1);
+        m_inner.assign(A.innerIndexPtr(), A.innerIndexPtr() + A.nonZeros());
+      }
+
+      void clear()
+      {
+        m_outer.clear();
+        m_inner.clear();
+      }
+
+      /**
+       * @brief Factorizes @p A with the Eigen sparse direct solver @p
+       * solver, performing the symbolic analysis only if the pattern of @p A
+       * differs from the cached one.
+       */
+      template <class EigenSolver>
+      void factorize(EigenSolver& solver, OperatorType& A)
+      {
+        A.makeCompressed();
+        if (!matches(A))
+        {
+          solver.analyzePattern(A);
+          set(A);
+        }
+        solver.factorize(A);
+        if (solver.info() != Eigen::Success)
+          clear();
+      }
+
+    private:
+      std::vector<StorageIndex> m_outer;
+      std::vector<StorageIndex> m_inner;
+  };
+}
+
+#endif
@@ -0,0 +1,164 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_PRECONDITIONER_H
+#define RODIN_SOLVER_PRECONDITIONER_H
+
+#include <Eigen/Core>
+
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/SparseMatrix.h"
+
+#include "ForwardDecls.h"
+
+namespace Rodin::Solver
+{
+  /**
+   * @brief Abstract base class for preconditioners.
+   *
+   * A preconditioner @f$ M @f$ approximates the inverse of an operator @f$ A
+   * @f$. Its setup phase is performed by setup(), after which apply()
+   * computes @f$ z = M r @f$.
+   */
+  template <class OperatorType, class VectorType>
+  class PreconditionerBase
+  {
+    public:
+      virtual ~PreconditionerBase() = default;
+
+      /**
+       * @brief Performs the setup phase of the preconditioner for the
+       * operator @p A.
+       */
+      virtual void setup(const OperatorType& A) = 0;
+
+      /**
+       * @brief Computes @f$ z = M r @f$.
+       */
+      virtual void apply(const VectorType& r, VectorType& z) const = 0;
+  };
+
+  namespace Internal
+  {
+    /**
+     * @brief Adaptor which allows the Eigen iterative solvers to use a
+     * PreconditionerBase object.
+     *
+     * If no preconditioner is set, it behaves as the diagonal (Jacobi)
+     * preconditioner of Eigen, or as the identity if the operator does not
+     * provide its diagonal.
+     */
+    template <class OperatorType, class VectorType>
+    class EigenPreconditioner
+    {
+      public:
+        using ScalarType = typename VectorType::Scalar;
+
+        EigenPreconditioner()
+          : m_pc(nullptr),
+            m_info(Eigen::Success)
+        {}
+
+        void set(PreconditionerBase<OperatorType, VectorType>& pc)
+        {
+          m_pc = &pc;
+        }
+
+        void reset()
+        {
+          m_pc = nullptr;
+        }
+
+        PreconditionerBase<OperatorType, VectorType>* get() const
+        {
+          return m_pc;
+        }
+
+        template <class MatType>
+        EigenPreconditioner& analyzePattern(const MatType&)
+        {
+          return *this;
+        }
+
+        /**
+         * @brief Computes the inverse diagonal of @p A, if no preconditioner
+         * is set and @p A provides its diagonal.
+         *
+         * The setup of a PreconditionerBase object is not performed here,
+         * since it is owned by the caller, who decides when the setup must be
+         * redone.
+         */
+        template <class MatType>
+        EigenPreconditioner& factorize(const MatType& A)
+        {
+          if (m_pc)
+            return *this;
+          m_invdiag.resize(A.cols());
+          if constexpr (requires { typename MatType::InnerIterator; })
+          {
+            for (int j = 0; j < A.outerSize(); ++j)
+            {
+              typename MatType::InnerIterator it(A, j);
+              while (it && it.index() != j)
+                ++it;
+              if (it && it.index() == j && it.value() != ScalarType(0))
+                m_invdiag(j) = ScalarType(1) / it.value();
+              else
+                m_invdiag(j) = ScalarType(1);
+            }
+          }
+          else if constexpr (requires { A.diagonal(); })
+          {
+            // Operators without inner iterators, such as
+            // Math::BlockSparseMatrix, may provide their diagonal
+            const VectorType diagonal = A.diagonal();
+            for (int j = 0; j < diagonal.size(); ++j)
+              m_invdiag(j) = diagonal(j) != ScalarType(0) ? ScalarType(1) / diagonal(j) : ScalarType(1);
+          }
+          else
+          {
+            // Operators which are only known through their action, such as
+            // Math::LinearOperator, are not preconditioned
+            m_invdiag.setOnes();
+          }
+          return *this;
+        }
+
+        template <class MatType>
+        EigenPreconditioner& compute(const MatType& A)
+        {
+          return factorize(A);
+        }
+
+        template <class Rhs>
+        VectorType solve(const Eigen::MatrixBase<Rhs>& b) const
+        {
+          if (m_pc)
+          {
+            VectorType z;
+            m_pc->apply(b, z);
+            return z;
+          }
+          else
+          {
+            return m_invdiag.cwiseProduct(b);
+          }
+        }
+
+        Eigen::ComputationInfo info() const
+        {
+          return m_info;
+        }
+
+      private:
+        PreconditionerBase<OperatorType, VectorType>* m_pc;
+        VectorType m_invdiag;
+        Eigen::ComputationInfo m_info;
+    };
+  }
+}
+
+#endif
@@ -13,6 +13,7 @@
 #include "Rodin/Math/SparseMatrix.h"
 
 #include "ForwardDecls.h"
+#include "PatternCache.h"
 #include "Solver.h"
 
 namespace Rodin::Solver
@@ -59,7 +60,8 @@ namespace Rodin::Solver
 
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
-        x = m_solver.compute(A).solve(b);
+        m_pattern.factorize(m_solver, A);
+        x = m_solver.solve(b);
       }
 
       inline
@@ -70,6 +72,7 @@ namespace Rodin::Solver
 
     private:
       Eigen::SimplicialLLT<OperatorType> m_solver;
+      Internal::PatternCache<OperatorType> m_pattern;
   };
 
   /**
@@ -0,0 +1,146 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_SOLVER_TRIANGULARSOLVER_H
+#define RODIN_SOLVER_TRIANGULARSOLVER_H
+
+#include <vector>
+#include <cassert>
+#include <algorithm>
+
+#include "Rodin/Configure.h"
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/SparseMatrix.h"
+#include "Rodin/Threads/ThreadPool.h"
+
+namespace Rodin::Solver::Internal
+{
+  /**
+   * @brief Sparse triangular solver with level scheduling.
+   *
+   * The rows of the triangular matrix @f$ T = D + N @f$, where @f$ D @f$ is
+   * diagonal and @f$ N @f$ is strictly lower or strictly upper triangular,
+   * are grouped in levels: the level of a row is one more than the maximum
+   * level of the rows it depends on. The rows of a level are independent,
+   * hence under RODIN_MULTITHREADED the large levels are solved in parallel
+   * on the global thread pool.
+   */
+  class TriangularSolver
+  {
+    public:
+      using ScalarType = Real;
+
+      using VectorType = Math::Vector<ScalarType>;
+
+      using RowMajorOperatorType = Eigen::SparseMatrix<ScalarType, Eigen::RowMajor>;
+
+      /**
+       * @brief Minimum number of rows of a level for it to be solved in
+       * parallel.
+       */
+      static constexpr size_t ParallelThreshold = 2048;
+
+      TriangularSolver() = default;
+
+      /**
+       * @brief Sets the matrix and computes its levels.
+       * @param[in] N Strictly lower or strictly upper triangular part
+       * @param[in] diagonal Diagonal part, or an empty vector if the diagonal
+       * is the identity
+       * @param[in] lower Whether @p N is lower triangular
+       */
+      void compute(RowMajorOperatorType&& N, VectorType&& diagonal, bool lower)
+      {
+        assert(N.rows() == N.cols());
+        assert(diagonal.size() == 0 || diagonal.size() == N.rows());
+        m_strict = std::move(N);
+        m_strict.makeCompressed();
+        m_invdiag = std::move(diagonal);
+        m_invdiag = m_invdiag.cwiseInverse();
+
+        const size_t n = m_strict.rows();
+        std::vector<Index> level(n, 0);
+        size_t count = 0;
+        for (size_t k = 0; k < n; k++)
+        {
+          const Index i = lower ? k : n - 1 - k;
+          Index l = 0;
+          for (RowMajorOperatorType::InnerIterator it(m_strict, i); it; ++it)
+          {
+            assert(lower ? it.col() < i : it.col() > i);
+            l = std::max(l, level[it.col()] + 1);
+          }
+          level[i] = l;
+          count = std::max(count, l + 1);
+        }
+
+        m_offsets.assign(count + 1, 0);
+        for (size_t i = 0; i < n; i++)
+          m_offsets[level[i] + 1]++;
+        for (size_t l = 0; l < count; l++)
+          m_offsets[l + 1] += m_offsets[l];
+        m_rows.resize(n);
+        std::vector<Index> position(m_offsets.begin(), m_offsets.end() - 1);
+        for (size_t i = 0; i < n; i++)
+          m_rows[position[level[i]]++] = i;
+      }
+
+      /**
+       * @brief Overwrites @p x with @f$ T^{-1} x @f$.
+       */
+      void solve(VectorType& x) const
+      {
+        assert(x.size() == m_strict.rows());
+        for (size_t l = 0; l + 1 < m_offsets.size(); l++)
+        {
+          const size_t begin = m_offsets[l];
+          const size_t end = m_offsets[l + 1];
+#ifdef RODIN_MULTITHREADED
+          if (end - begin >= ParallelThreshold)
+          {
+            auto& threadPool = Threads::getGlobalThreadPool();
+            threadPool.pushLoop(begin, end,
+                [&](const size_t start, const size_t stop)
+                {
+                  for (size_t k = start; k < stop; k++)
+                    row(m_rows[k], x);
+                });
+            threadPool.waitForTasks();
+            continue;
+          }
+#endif
+          for (size_t k = begin; k < end; k++)
+            row(m_rows[k], x);
+        }
+      }
+
+      /**
+       * @brief Gets the number of levels.
+       */
+      size_t getLevelCount() const
+      {
+        return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+      }
+
+    private:
+      void row(Index i, VectorType& x) const
+      {
+        ScalarType s = x(i);
+        for (RowMajorOperatorType::InnerIterator it(m_strict, i); it; ++it)
+          s -= it.value() * x(it.col());
+        x(i) = m_invdiag.size() ? s * m_invdiag(i) : s;
+      }
+
+      RowMajorOperatorType m_strict;
+      VectorType m_invdiag;
+      std::vector<Index> m_rows;
+      std::vector<size_t> m_offsets;
+  };
+}
+
+#endif
@@ -18,6 +18,7 @@
 #include "Rodin/Math/SparseMatrix.h"
 
 #include "ForwardDecls.h"
+#include "PatternCache.h"
 
 namespace Rodin::Solver
 {
@@ -64,7 +65,7 @@ namespace Rodin::Solver
 
       void solve(OperatorType& A, VectorType& x, VectorType& b) override
       {
-        m_solver.compute(A);
+        m_pattern.factorize(m_solver, A);
         x = m_solver.solve(b);
       }
 
@@ -90,6 +91,7 @@ namespace Rodin::Solver
 
     private:
       Eigen::UmfPackLU<OperatorType> m_solver;
+      Internal::PatternCache<OperatorType> m_pattern;
   };
 
   /**
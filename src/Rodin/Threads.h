@@ -13,6 +13,7 @@
  */
 
 #include "Threads/Mutex.h"
+#include "Threads/Atomic.h"
 #include "Threads/Unsafe.h"
 #include "Threads/Mutable.h"
 #include "Threads/ThreadPool.h"
@@ -0,0 +1,73 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_THREADS_ATOMIC_H
+#define RODIN_THREADS_ATOMIC_H
+
+#include <atomic>
+#include <version>
+#include <complex>
+
+#include "Rodin/Configure.h"
+
+namespace Rodin::Threads
+{
+  namespace Internal
+  {
+    /**
+     * @brief Atomically adds @p v to the arithmetic object referenced by
+     * @p dst.
+     *
+     * Standard libraries without std::atomic_ref, such as libc++ before
+     * LLVM 19, fall back to a compare-and-swap loop on the compiler
+     * builtins.
+     */
+    template <class T>
+    inline
+    void fetchAdd(T& dst, const T& v)
+    {
+#ifdef __cpp_lib_atomic_ref
+      std::atomic_ref<T>(dst).fetch_add(v, std::memory_order_relaxed);
+#else
+      T expected;
+      __atomic_load(&dst, &expected, __ATOMIC_RELAXED);
+      T desired = expected + v;
+      while (!__atomic_compare_exchange(&dst, &expected, &desired, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        desired = expected + v;
+#endif
+    }
+  }
+
+  /**
+   * @brief Atomically adds @p v to the object referenced by @p dst.
+   *
+   * The object must not be accessed non-atomically by other threads while
+   * the operation takes place.
+   */
+  template <class T>
+  inline
+  void atomicAdd(T& dst, const T& v)
+  {
+    Internal::fetchAdd(dst, v);
+  }
+
+  /**
+   * @brief Atomically adds @p v to the complex number referenced by @p dst.
+   *
+   * The real and imaginary parts are updated by two independent atomic
+   * operations.
+   */
+  template <class T>
+  inline
+  void atomicAdd(std::complex<T>& dst, const std::complex<T>& v)
+  {
+    T* const parts = reinterpret_cast<T*>(&dst);
+    Internal::fetchAdd(parts[0], v.real());
+    Internal::fetchAdd(parts[1], v.imag());
+  }
+}
+
+#endif
@@ -0,0 +1,137 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_THREADS_TASKQUEUE_H
+#define RODIN_THREADS_TASKQUEUE_H
+
+#include <deque>
+#include <mutex>
+#include <future>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <type_traits>
+#include <condition_variable>
+
+#include "Rodin/Configure.h"
+
+namespace Rodin::Threads
+{
+  /**
+   * @brief Bounded queue of tasks executed in order by a dedicated thread.
+   *
+   * push() blocks while the number of pending tasks is equal to the
+   * capacity, which throttles a producer faster than the thread. The
+   * destructor runs the pending tasks before joining the thread.
+   *
+   * A task may not push to its own queue, since it would wait for itself
+   * if the queue is full.
+   */
+  class TaskQueue
+  {
+    public:
+      /**
+       * @param[in] capacity Maximum number of pending tasks, not counting
+       * the one being run.
+       */
+      TaskQueue(size_t capacity)
+        : m_capacity(capacity > 0 ? capacity : 1),
+          m_busy(false),
+          m_done(false),
+          m_thread(&TaskQueue::run, this)
+      {}
+
+      TaskQueue(const TaskQueue&) = delete;
+
+      TaskQueue& operator=(const TaskQueue&) = delete;
+
+      ~TaskQueue()
+      {
+        {
+          std::lock_guard lock(m_mutex);
+          m_done = true;
+        }
+        m_pushed.notify_one();
+        m_thread.join();
+      }
+
+      /**
+       * @brief Queues the task, blocking while the queue is full.
+       * @returns Future holding the result of the task, or the exception
+       * it threw.
+       */
+      template <class F>
+      auto push(F&& f)
+      {
+        using ResultType = std::invoke_result_t<std::decay_t<F>>;
+        auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<F>(f));
+        auto res = task->get_future();
+        {
+          std::unique_lock lock(m_mutex);
+          m_popped.wait(lock, [&]() { return m_queue.size() < m_capacity; });
+          m_queue.emplace_back([task]() { (*task)(); });
+        }
+        m_pushed.notify_one();
+        return res;
+      }
+
+      /**
+       * @brief Blocks until all the queued tasks have run.
+       */
+      void wait()
+      {
+        std::unique_lock lock(m_mutex);
+        m_popped.wait(lock, [&]() { return m_queue.empty() && !m_busy; });
+      }
+
+      size_t getCapacity() const
+      {
+        return m_capacity;
+      }
+
+    private:
+      void run()
+      {
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+          m_pushed.wait(lock, [&]() { return m_done || !m_queue.empty(); });
+          if (m_queue.empty())
+            return;
+          auto task = std::move(m_queue.front());
+          m_queue.pop_front();
+          m_busy = true;
+          lock.unlock();
+          m_popped.notify_all();
+          task();
+          lock.lock();
+          m_busy = false;
+          m_popped.notify_all();
+        }
+      }
+
+      const size_t m_capacity;
+      std::mutex m_mutex;
+      std::condition_variable m_pushed;
+      std::condition_variable m_popped;
+      std::deque<std::function<void()>> m_queue;
+      bool m_busy;
+      bool m_done;
+      std::thread m_thread;
+  };
+
+  /**
+   * @brief Gets the queue on which the asynchronous saves are written.
+   */
+  inline
+  TaskQueue& getIOQueue()
+  {
+    static TaskQueue s_queue(RODIN_THREADS_IOQUEUE_CAPACITY);
+    return s_queue;
+  }
+}
+
+#endif
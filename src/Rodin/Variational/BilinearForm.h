@@ -7,11 +7,15 @@
 #ifndef RODIN_VARIATIONAL_BILINEARFORM_H
 #define RODIN_VARIATIONAL_BILINEARFORM_H
 
+#include <optional>
+
 #include "Rodin/Configure.h"
 
 #include "Rodin/Pair.h"
 #include "Rodin/FormLanguage/List.h"
 #include "Rodin/Math/SparseMatrix.h"
+#include "Rodin/Math/LinearOperator.h"
+#include "Rodin/Threads/ThreadPool.h"
 
 #include "Rodin/Assembly/ForwardDecls.h"
 
@@ -217,11 +221,64 @@ namespace Rodin::Variational
         return (getOperator() * testWeights.value()).dot(trialWeights.value());
       }
 
+      /**
+       * @brief Computes the action @f$ y = A x @f$ of the operator associated
+       * to the bilinear form, without assembling it.
+       * @param[in] x Vector of size equal to the size of the trial space
+       * @param[out] y Vector of size equal to the size of the test space
+       *
+       * The element matrices of the local integrators are applied to the
+       * local degrees of freedom of @f$ x @f$ and the result is scattered
+       * into @f$ y @f$. The polytopes are processed color by color (see
+       * Geometry::Mesh::getColoring), so that the scattering is race free
+       * when it is carried out in parallel on the thread pool.
+       *
+       * Integrators added with add() are not assembled, hence the bilinear
+       * form may be used in this way without ever forming its operator.
+       */
+      void apply(const Math::Vector<ScalarType>& x, Math::Vector<ScalarType>& y) const
+      {
+#ifdef RODIN_MULTITHREADED
+        apply(x, y, Threads::getGlobalThreadPool());
+#else
+        apply(x, y, std::nullopt);
+#endif
+      }
+
+      /**
+       * @brief Computes the action @f$ y = A x @f$ of the operator associated
+       * to the bilinear form on the given thread pool.
+       *
+       * If no thread pool is given, the polytopes are processed
+       * sequentially.
+       */
+      void apply(
+          const Math::Vector<ScalarType>& x, Math::Vector<ScalarType>& y,
+          std::optional<std::reference_wrapper<Threads::ThreadPool>> pool) const;
+
+      /**
+       * @brief Gets the matrix-free linear operator whose action is given by
+       * apply().
+       *
+       * The bilinear form must outlive the returned object.
+       */
+      Math::LinearOperator<ScalarType> getLinearOperator() const
+      {
+        const auto& trialFES = getTrialFunction().getFiniteElementSpace();
+        const auto& testFES = getTestFunction().getFiniteElementSpace();
+        return Math::LinearOperator<ScalarType>(
+            testFES.getSize(), trialFES.getSize(),
+            [this](const Math::Vector<ScalarType>& x, Math::Vector<ScalarType>& y)
+            {
+              apply(x, y);
+            });
+      }
+
       void assemble() override
       {
          const auto& trialFES = getTrialFunction().getFiniteElementSpace();
          const auto& testFES = getTestFunction().getFiniteElementSpace();
-         m_operator = getAssembly().execute({
+         getAssembly().execute(m_operator, {
              trialFES, testFES, getLocalIntegrators(), getGlobalIntegrators() });
       }
 
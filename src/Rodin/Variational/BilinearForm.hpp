@@ -7,7 +7,137 @@
 #ifndef RODIN_VARIATIONAL_BILINEARFORM_HPP
 #define RODIN_VARIATIONAL_BILINEARFORM_HPP
 
+#include "BilinearForm.h"
+
 namespace Rodin::Variational
-{}
+{
+  template <class TrialFES, class TestFES, class Operator>
+  void BilinearForm<TrialFES, TestFES, Operator>::apply(
+      const Math::Vector<ScalarType>& x, Math::Vector<ScalarType>& y,
+      std::optional<std::reference_wrapper<Threads::ThreadPool>> pool) const
+  {
+    const auto& trialFES = getTrialFunction().getFiniteElementSpace();
+    const auto& testFES = getTestFunction().getFiniteElementSpace();
+    const auto& mesh = testFES.getMesh();
+    assert(static_cast<size_t>(x.size()) == trialFES.getSize());
+    y.resize(testFES.getSize());
+    y.setZero();
+
+    const auto getDimension =
+      [&](Integrator::Region region) -> size_t
+      {
+        return region == Integrator::Region::Cells ?
+          mesh.getDimension() : mesh.getDimension() - 1;
+      };
+
+    const auto filter =
+      [&](Integrator::Region region, Index i) -> bool
+      {
+        switch (region)
+        {
+          case Integrator::Region::Cells:
+          case Integrator::Region::Faces:
+            return true;
+          case Integrator::Region::Boundary:
+            return mesh.isBoundary(i);
+          case Integrator::Region::Interface:
+            return mesh.isInterface(i);
+        }
+        assert(false);
+        return false;
+      };
+
+    for (auto& bfi : getLocalIntegrators())
+    {
+      const auto& attrs = bfi.getAttributes();
+      const auto region = bfi.getRegion();
+      const size_t d = getDimension(region);
+      for (const auto& color : mesh.getColoring(d))
+      {
+        // Polytopes of the same color do not share degrees of freedom
+        const auto loop =
+          [&](const Index start, const Index end)
+          {
+            Math::Matrix<ScalarType> mat;
+            Math::Vector<ScalarType> xl, yl;
+            std::unique_ptr<LocalBilinearFormIntegratorBaseType> lbfi;
+            lbfi.reset(bfi.copy());
+            for (Index j = start; j < end; ++j)
+            {
+              const Index i = color[j];
+              if (filter(region, i))
+              {
+                if (attrs.size() == 0 || attrs.count(mesh.getAttribute(d, i)))
+                {
+                  const Geometry::Polytope polytope(d, i, mesh);
+                  lbfi->setPolytope(polytope);
+                  const auto& rows = testFES.getDOFs(d, i);
+                  const auto& cols = trialFES.getDOFs(d, i);
+                  mat.resize(rows.size(), cols.size());
+                  lbfi->getElementMatrix(mat);
+                  xl.resize(cols.size());
+                  for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+                    xl.coeffRef(m) = x.coeff(cols(m));
+                  yl.noalias() = mat * xl;
+                  for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+                    y.coeffRef(rows(l)) += yl.coeff(l);
+                }
+              }
+            }
+          };
+        if (pool)
+        {
+          auto& threadPool = pool->get();
+          threadPool.pushLoop(0, color.size(), loop);
+          threadPool.waitForTasks();
+        }
+        else
+        {
+          loop(0, color.size());
+        }
+      }
+    }
+
+    Math::Matrix<ScalarType> mat;
+    for (auto& bfi : getGlobalIntegrators())
+    {
+      std::unique_ptr<GlobalBilinearFormIntegratorBaseType> gbfi;
+      gbfi.reset(bfi.copy());
+      const auto& trialAttrs = gbfi->getTrialAttributes();
+      const auto& testAttrs = gbfi->getTestAttributes();
+      const auto trialRegion = gbfi->getTrialRegion();
+      const auto testRegion = gbfi->getTestRegion();
+      const size_t trialD = getDimension(trialRegion);
+      const size_t testD = getDimension(testRegion);
+      for (Index te = 0; te < mesh.getPolytopeCount(testD); te++)
+      {
+        if (!filter(testRegion, te))
+          continue;
+        if (testAttrs.size() > 0 && !testAttrs.count(mesh.getAttribute(testD, te)))
+          continue;
+        const Geometry::Polytope tePolytope(testD, te, mesh);
+        const auto& rows = testFES.getDOFs(testD, te);
+        for (Index tr = 0; tr < mesh.getPolytopeCount(trialD); tr++)
+        {
+          if (!filter(trialRegion, tr))
+            continue;
+          if (trialAttrs.size() > 0 && !trialAttrs.count(mesh.getAttribute(trialD, tr)))
+            continue;
+          const Geometry::Polytope trPolytope(trialD, tr, mesh);
+          gbfi->setPolytope(trPolytope, tePolytope);
+          const auto& cols = trialFES.getDOFs(trialD, tr);
+          mat.resize(rows.size(), cols.size());
+          gbfi->getElementMatrix(mat);
+          for (size_t m = 0; m < static_cast<size_t>(cols.size()); m++)
+          {
+            const ScalarType s = x.coeff(cols(m));
+            for (size_t l = 0; l < static_cast<size_t>(rows.size()); l++)
+              y.coeffRef(rows(l)) += mat(l, m) * s;
+          }
+        }
+      }
+    }
+  }
+}
 
 #endif
@@ -4,6 +4,7 @@
 #include <set>
 #include <memory>
 
+#include "Rodin/Math/Matrix.h"
 #include "Rodin/FormLanguage/Base.h"
 
 #include "ForwardDecls.h"
@@ -177,6 +178,23 @@ namespace Rodin::Variational
 
       virtual ScalarType integrate(size_t tr, size_t te) = 0;
 
+      /**
+       * @brief Computes the element matrix on the current polytope.
+       * @param[in,out] res Matrix of size @f$ n_{te} \times n_{tr} @f$, whose
+       * @f$ (te, tr) @f$ entry is set to the value of integrate(tr, te).
+       *
+       * The matrix must be sized by the caller. The default implementation
+       * evaluates each entry with integrate(size_t, size_t). Integrators which
+       * already compute the whole element matrix when setting the polytope
+       * should override this method.
+       */
+      virtual void getElementMatrix(Math::Matrix<ScalarType>& res)
+      {
+        for (size_t l = 0; l < static_cast<size_t>(res.rows()); l++)
+          for (size_t m = 0; m < static_cast<size_t>(res.cols()); m++)
+            res(l, m) = integrate(m, l);
+      }
+
       virtual Integrator::Region getRegion() const = 0;
 
       virtual
@@ -263,6 +281,20 @@ namespace Rodin::Variational
 
       virtual ScalarType integrate(size_t tr, size_t te) = 0;
 
+      /**
+       * @brief Computes the element matrix on the current pair of polytopes.
+       * @param[in,out] res Matrix of size @f$ n_{te} \times n_{tr} @f$, whose
+       * @f$ (te, tr) @f$ entry is set to the value of integrate(tr, te).
+       *
+       * The matrix must be sized by the caller.
+       */
+      virtual void getElementMatrix(Math::Matrix<ScalarType>& res)
+      {
+        for (size_t l = 0; l < static_cast<size_t>(res.rows()); l++)
+          for (size_t m = 0; m < static_cast<size_t>(res.cols()); m++)
+            res(l, m) = integrate(m, l);
+      }
+
       virtual Integrator::Region getTrialRegion() const = 0;
 
       virtual Integrator::Region getTestRegion() const = 0;
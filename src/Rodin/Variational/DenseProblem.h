@@ -16,6 +16,7 @@
 #include "Rodin/Math/Vector.h"
 #include "Rodin/Math/Matrix.h"
 #include "Rodin/Solver/Solver.h"
+#include "Rodin/Assembly/Blocked.h"
 
 #include "ForwardDecls.h"
 
@@ -91,6 +92,10 @@ namespace Rodin::Variational
 
       using Parent = ProblemBase<OperatorType, VectorType, ScalarType>;
 
+      using BilinearFormType = BilinearForm<TrialFES, TestFES, OperatorType>;
+
+      using BlockedAssembly = Assembly::Blocked<OperatorType, BilinearFormType>;
+
       /**
        * @brief Constructs an empty DenseProblem involving the trial function @f$ u @f$
        * and the test function @f$ v @f$.
@@ -105,7 +110,11 @@ namespace Rodin::Variational
           m_linearForm(v),
           m_bilinearForm(u, v),
           m_assembled(false)
-      {}
+      {
+#ifdef RODIN_MULTITHREADED
+        m_bilinearForm.setAssembly(BlockedAssembly());
+#endif
+      }
 
       /**
        * @brief Deleted copy constructor.
@@ -141,6 +150,19 @@ namespace Rodin::Variational
         return m_testFunction.get();
       }
 
+      /**
+       * @brief Sets the assembly of the bilinear form of the problem.
+       *
+       * In multithreaded builds, the problem uses the Blocked assembly by
+       * default.
+       */
+      DenseProblem& setAssembly(const Assembly::AssemblyBase<OperatorType, BilinearFormType>& assembly)
+      {
+        m_bilinearForm.setAssembly(assembly);
+        m_assembled = false;
+        return *this;
+      }
+
       constexpr
       const PeriodicBoundary<ScalarType>& getPeriodicBoundary() const
       {
@@ -372,7 +394,7 @@ namespace Rodin::Variational
          solver.solve(m_stiffness, m_guess, m_mass);
 
          // Recover solution
-         getTrialFunction().getSolution().setWeights(std::move(m_guess));
+         getTrialFunction().getSolution().setWeights(m_guess);
       }
 
       DenseProblem& operator=(const ProblemBody<OperatorType, VectorType, ScalarType>& rhs) override
@@ -426,7 +448,7 @@ namespace Rodin::Variational
       std::reference_wrapper<TestFunction<TestFES>>   m_testFunction;
 
       LinearForm<TestFES, VectorType> m_linearForm;
-      BilinearForm<TrialFES, TestFES, OperatorType> m_bilinearForm;
+      BilinearFormType m_bilinearForm;
 
       FormLanguage::List<BilinearFormBase<OperatorType>> m_bfs;
 
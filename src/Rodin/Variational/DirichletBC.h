@@ -214,16 +214,10 @@ namespace Rodin::Variational
       {
         const auto& fes = m_u.get().getFiniteElementSpace();
         const auto& mesh = fes.getMesh();
-        Geometry::FaceIterator it;
-        if (m_essBdr.size() > 0)
-          it = mesh.getFace();
-        else
-          it = mesh.getBoundary();
         m_dofs.clear();
-        for (; !it.end(); ++it)
+        for (const auto polytope : mesh.faces())
         {
-          const auto& polytope = *it;
-          if (m_essBdr.size() == 0 || m_essBdr.count(polytope.getAttribute()))
+          if (m_essBdr.size() == 0 ? polytope.isBoundary() : m_essBdr.count(polytope.getAttribute()))
           {
             const size_t d = polytope.getDimension();
             const size_t i = polytope.getIndex();
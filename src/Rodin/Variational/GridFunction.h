@@ -9,6 +9,7 @@
 
 #include <cmath>
 #include <utility>
+#include <future>
 #include <fstream>
 #include <functional>
 #include <boost/filesystem.hpp>
@@ -25,6 +26,7 @@
 #include "Rodin/QF/GenericPolytopeQuadrature.h"
 
 #include "Rodin/Threads/ThreadPool.h"
+#include "Rodin/Threads/TaskQueue.h"
 
 #include "ForwardDecls.h"
 
@@ -511,11 +513,9 @@ namespace Rodin::Variational
               std::unique_ptr<FunctionBase<NestedDerived>> fnt(fn.copy());
               for (Index i = start; i < end; ++i)
               {
-                const auto it = mesh.getCell(i);
-                const auto& polytope = *it;
+                const Geometry::Cell polytope(i, mesh);
                 if (attrs.size() == 0 || attrs.count(polytope.getAttribute()))
                 {
-                  const auto& i = polytope.getIndex();
                   const auto& fe = fes.getFiniteElement(d, i);
                   const auto& trans = mesh.getPolytopeTransformation(d, i);
                   for (size_t local = 0; local < fe.getCount(); local++)
@@ -541,9 +541,8 @@ namespace Rodin::Variational
           threadPool.pushLoop(0, mesh.getCellCount(), loop);
           threadPool.waitForTasks();
 #else
-          for (auto it = mesh.getCell(); !it.end(); ++it)
+          for (const auto polytope : mesh.cells())
           {
-            const auto& polytope = *it;
             if (attrs.size() == 0 || attrs.count(polytope.getAttribute()))
             {
               const auto& i = polytope.getIndex();
@@ -565,9 +564,8 @@ namespace Rodin::Variational
         else if constexpr (std::is_same_v<RangeType, Math::Vector<ScalarType>>)
         {
           Math::Vector<ScalarType> value;
-          for (auto it = mesh.getCell(); !it.end(); ++it)
+          for (const auto polytope : mesh.cells())
           {
-            const auto& polytope = *it;
             if (attrs.size() == 0 || attrs.count(polytope.getAttribute()))
             {
               const auto& i = polytope.getIndex();
@@ -766,9 +764,8 @@ namespace Rodin::Variational
         const auto& mesh = fes.getMesh();
         const size_t d = mesh.getDimension() - 1;
         std::vector<Real> ns(fes.getSize(), 0);
-        for (auto it = mesh.getFace(); !it.end(); ++it)
+        for (const auto polytope : mesh.faces())
         {
-          const auto& polytope = *it;
           if (attrs.size() == 0 || attrs.count(polytope.getAttribute()))
           {
             const auto& i = polytope.getIndex();
@@ -921,7 +918,7 @@ namespace Rodin::Variational
           case IO::FileFormat::MEDIT:
           {
             IO::GridFunctionLoader<IO::FileFormat::MEDIT, FES> loader(static_cast<Derived&>(*this));
-            loader.load(input);
+            loader.load(filename);
             break;
           }
           default:
@@ -938,7 +935,8 @@ namespace Rodin::Variational
           const boost::filesystem::path& filename, IO::FileFormat fmt = IO::FileFormat::MFEM,
           size_t precision = RODIN_DEFAULT_GRIDFUNCTION_SAVE_PRECISION) const
       {
-        std::ofstream output(filename.c_str());
+        const bool binary = (fmt == IO::FileFormat::MEDIT && filename.extension() == ".solb");
+        std::ofstream output(filename.c_str(), binary ? std::ios::binary : std::ios::out);
         if (!output)
         {
           Alert::Exception()
@@ -958,6 +956,8 @@ namespace Rodin::Variational
           case IO::FileFormat::MEDIT:
           {
             IO::GridFunctionPrinter<IO::FileFormat::MEDIT, FES> printer(static_cast<const Derived&>(*this));
+            if (binary)
+              printer.setEncoding(IO::MEDIT::Encoding::Binary);
             printer.print(output);
             break;
           }
@@ -971,6 +971,36 @@ namespace Rodin::Variational
         output.close();
       }
 
+      /**
+       * @brief Saves the grid function to file without blocking.
+       *
+       * The grid function is copied, and the copy is saved on a dedicated
+       * I/O thread. Saves are written in order. The call blocks while too
+       * many saves are pending.
+       *
+       * Only the data is copied: the finite element space and its mesh
+       * should neither be destroyed nor modified until the returned future
+       * is ready.
+       *
+       * @param[in] filename Name of file to write
+       * @param[in] fmt Grid function file format
+       * @param[in] precision Number of significant digits of the values
+       * @returns Future which is ready once the file is written, and which
+       * holds the exception raised while saving, if any.
+       * @see save()
+       */
+      std::future<void> saveAsync(
+          const boost::filesystem::path& filename, IO::FileFormat fmt = IO::FileFormat::MFEM,
+          size_t precision = RODIN_DEFAULT_GRIDFUNCTION_SAVE_PRECISION) const
+      {
+        auto snapshot = std::make_shared<const Derived>(static_cast<const Derived&>(*this));
+        return Threads::getIOQueue().push(
+            [snapshot, filename, fmt, precision]()
+            {
+              snapshot->save(filename, fmt, precision);
+            });
+      }
+
       constexpr
       const FES& getFiniteElementSpace() const
       {
@@ -713,6 +713,21 @@ namespace Rodin::Variational
         return getLHS() * m_rhs->integrate(tr, te);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) override
+      {
+        if constexpr (std::is_same_v<ScalarType, RHSNumber>)
+        {
+          m_rhs->getElementMatrix(res);
+          res *= ScalarType(getLHS());
+        }
+        else
+        {
+          Math::Matrix<RHSNumber> tmp(res.rows(), res.cols());
+          m_rhs->getElementMatrix(tmp);
+          res = ScalarType(getLHS()) * tmp.template cast<ScalarType>();
+        }
+      }
+
       Mult* copy() const noexcept override
       {
         return new Mult(*this);
@@ -129,6 +129,11 @@ namespace Rodin::Variational
         return m_weight * m_distortion * m_matrix(te, tr);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) override
+      {
+        res = (m_weight * m_distortion) * m_matrix;
+      }
+
       inline
       constexpr
       const MuType& getMu() const
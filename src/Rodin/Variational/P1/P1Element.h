@@ -257,6 +257,111 @@ namespace Rodin::Variational
         return 0;
       }
 
+      /**
+       * @brief Evaluates the basis functions of the reference simplex of
+       * dimension @f$ N @f$ at the reference coordinates @p r.
+       *
+       * The @f$ i @f$-th entry of the result is the value of the @f$ i
+       * @f$-th basis function.
+       */
+      template <size_t N, class Derived>
+      static Math::FixedSizeVector<Real, N + 1> getSimplexBasis(const Eigen::MatrixBase<Derived>& r)
+      {
+        static_assert(1 <= N && N <= 3);
+        assert(r.size() == static_cast<Eigen::Index>(N));
+        Math::FixedSizeVector<Real, N + 1> res;
+        res.coeffRef(0) = 1 - r.template head<N>().sum();
+        res.template tail<N>() = r.template head<N>();
+        return res;
+      }
+
+      /**
+       * @brief Gets the (constant) gradients of the basis functions of the
+       * reference simplex of dimension @f$ N @f$.
+       *
+       * The @f$ i @f$-th column of the matrix is the gradient of the @f$ i
+       * @f$-th basis function.
+       */
+      template <size_t N>
+      static const Math::FixedSizeMatrix<Real, N, N + 1>& getSimplexGradients()
+      {
+        static_assert(1 <= N && N <= 3);
+        static const Math::FixedSizeMatrix<Real, N, N + 1> s_res =
+          []()
+          {
+            Math::FixedSizeMatrix<Real, N, N + 1> res;
+            res.col(0).setConstant(-1);
+            res.template rightCols<N>().setIdentity();
+            return res;
+          }();
+        return s_res;
+      }
+
+      /**
+       * @brief Calls @p f with the space dimension and the dimension of the
+       * simplex as compile time constants.
+       * @param[in] sdim Space dimension
+       * @param[in] g Geometry of the polytope
+       * @param[in] f Callable taking two `std::integral_constant<size_t, N>`
+       *
+       * This allows the caller to select, once per polytope, an
+       * implementation operating on fixed size matrices.
+       *
+       * @returns Whether @p f was called, i.e. whether @p g is a simplex of
+       * positive dimension.
+       */
+      template <class F>
+      static bool dispatchSimplex(size_t sdim, Geometry::Polytope::Type g, F&& f)
+      {
+        using One = std::integral_constant<size_t, 1>;
+        using Two = std::integral_constant<size_t, 2>;
+        using Three = std::integral_constant<size_t, 3>;
+        switch (g)
+        {
+          case Geometry::Polytope::Type::Segment:
+          {
+            switch (sdim)
+            {
+              case 1:
+                f(One{}, One{});
+                return true;
+              case 2:
+                f(Two{}, One{});
+                return true;
+              case 3:
+                f(Three{}, One{});
+                return true;
+            }
+            return false;
+          }
+          case Geometry::Polytope::Type::Triangle:
+          {
+            switch (sdim)
+            {
+              case 2:
+                f(Two{}, Two{});
+                return true;
+              case 3:
+                f(Three{}, Two{});
+                return true;
+            }
+            return false;
+          }
+          case Geometry::Polytope::Type::Tetrahedron:
+          {
+            switch (sdim)
+            {
+              case 3:
+                f(Three{}, Three{});
+                return true;
+            }
+            return false;
+          }
+          default:
+            return false;
+        }
+      }
+
     private:
       static const Geometry::GeometryIndexed<Math::PointMatrix> s_nodes;
       static const Geometry::GeometryIndexed<std::vector<LinearForm>> s_ls;
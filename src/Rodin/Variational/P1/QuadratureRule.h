@@ -527,6 +527,11 @@ namespace Rodin::Variational
         return m_weight * m_distortion * m_matrix(te, tr);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) final override
+      {
+        res = (m_weight * m_distortion) * m_matrix;
+      }
+
       virtual Integrator::Region getRegion() const override = 0;
 
       virtual QuadratureRule* copy() const noexcept override = 0;
@@ -694,8 +699,28 @@ namespace Rodin::Variational
         const auto& p = *m_p;
         if (trialfes == testfes)
         {
-          Math::SpatialVector<ScalarType> grad;
           const auto& fe = trialfes.getFiniteElement(d, idx);
+          if constexpr (std::is_same_v<std::decay_t<decltype(fe)>, RealP1Element>)
+          {
+            // Affine simplices have constant gradients, which we compute with
+            // fixed size matrices
+            const bool simplex =
+              RealP1Element::dispatchSimplex(
+                  polytope.getMesh().getSpaceDimension(), polytope.getGeometry(),
+                  [&](auto s, auto r)
+                  {
+                    constexpr size_t S = decltype(s)::value;
+                    constexpr size_t R = decltype(r)::value;
+                    const Math::FixedSizeMatrix<Real, S, R + 1> grad =
+                      p.getJacobianInverse().transpose().template topLeftCorner<S, R>()
+                      * RealP1Element::getSimplexGradients<R>();
+                    m_matrix = grad.transpose() * grad;
+                  });
+            if (simplex)
+              return *this;
+          }
+
+          Math::SpatialVector<ScalarType> grad;
           m_matrix.resize(fe.getCount(), fe.getCount());
 
           m_grad1.resize(fe.getCount());
@@ -734,6 +759,7 @@ namespace Rodin::Variational
             m_grad2[i] = p.getJacobianInverse().transpose() * grad2;
           }
 
+          m_matrix.resize(testfe.getCount(), trialfe.getCount());
           for (size_t i = 0; i < testfe.getCount(); i++)
           {
             for (size_t j = 0; j < trialfe.getCount(); j++)
@@ -748,6 +774,11 @@ namespace Rodin::Variational
         return m_weight * m_distortion * m_matrix(te, tr);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) final override
+      {
+        res = (m_weight * m_distortion) * m_matrix;
+      }
+
       virtual Integrator::Region getRegion() const override = 0;
 
       virtual QuadratureRule* copy() const noexcept override = 0;
@@ -970,6 +1001,11 @@ namespace Rodin::Variational
         return m_weight * m_distortion * m_matrix(te, tr);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) final override
+      {
+        res = (m_weight * m_distortion) * m_matrix;
+      }
+
       virtual Integrator::Region getRegion() const override = 0;
 
       virtual QuadratureRule* copy() const noexcept override = 0;
@@ -1193,6 +1229,11 @@ namespace Rodin::Variational
         return m_weight * m_distortion * m_matrix(te, tr);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) final override
+      {
+        res = (m_weight * m_distortion) * m_matrix;
+      }
+
       virtual Integrator::Region getRegion() const override = 0;
 
       virtual QuadratureRule* copy() const noexcept override = 0;
@@ -1431,6 +1472,11 @@ namespace Rodin::Variational
         return m_weight * m_distortion * m_matrix(te, tr);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) final override
+      {
+        res = (m_weight * m_distortion) * m_matrix;
+      }
+
       virtual Integrator::Region getRegion() const override = 0;
 
       virtual QuadratureRule* copy() const noexcept override = 0;
@@ -1756,6 +1802,11 @@ namespace Rodin::Variational
         return m_distortion * m_weight * m_matrix(te, tr);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) override
+      {
+        res = (m_distortion * m_weight) * m_matrix;
+      }
+
       Region getTrialRegion() const override
       {
         return getIntegrand().getLHS().getRegion();
@@ -7,6 +7,10 @@
 #ifndef RODIN_VARIATIONAL_POTENTIAL_H
 #define RODIN_VARIATIONAL_POTENTIAL_H
 
+#include <map>
+#include <memory>
+
+#include "Rodin/Threads/Mutex.h"
 #include "Rodin/FormLanguage/Base.h"
 #include "Rodin/FormLanguage/List.h"
 #include "Rodin/QF/QuadratureFormula.h"
@@ -17,6 +21,8 @@
 #include "Function.h"
 #include "Integral.h"
 #include "ShapeFunction.h"
+#include "Treecode.h"
+#include "QuadraturePointCloud.h"
 #include "QuadratureRule.h"
 #include "LinearFormIntegrator.h"
 
@@ -151,19 +157,27 @@ namespace Rodin::Variational
       using Parent = FunctionBase<Potential<LHSType, RHSType>>;
 
       Potential(const KernelType& kernel, const OperandType& u)
-        : m_kernel(kernel), m_u(u.copy())
+        : m_kernel(kernel), m_u(u.copy()),
+          m_cacheOperand(false),
+          m_cache(std::make_shared<Cache>())
       {}
 
       Potential(const Potential& other)
         : Parent(other),
           m_kernel(other.m_kernel),
-          m_u(other.m_u->copy())
+          m_u(other.m_u->copy()),
+          m_qf(other.m_qf),
+          m_cacheOperand(other.m_cacheOperand),
+          m_cache(other.m_cache)
       {}
 
       Potential(Potential&& other)
         : Parent(std::move(other)),
           m_kernel(std::move(other.m_kernel)),
-          m_u(std::move(other.m_u))
+          m_u(std::move(other.m_u)),
+          m_qf(std::move(other.m_qf)),
+          m_cacheOperand(std::move(other.m_cacheOperand)),
+          m_cache(std::move(other.m_cache))
       {}
 
       constexpr
@@ -199,108 +213,83 @@ namespace Rodin::Variational
 
       auto getValue(const Geometry::Point& p) const
       {
-        const auto& kernel = getKernel();
-        const auto& operand = getOperand();
-        const auto& mesh = p.getPolytope().getMesh();
-        if (m_qf.has_value())
+        if constexpr (std::is_same_v<RHSRangeType, ScalarType>)
         {
-          if constexpr (std::is_same_v<RHSRangeType, ScalarType>)
-          {
-            ScalarType res = 0;
-            for (auto it = mesh.getCell(); it; ++it)
-            {
-              const auto& polytope = *it;
-              const auto& qf = m_qf.value()(polytope);
-              const auto& trans = polytope.getTransformation();
-              for (size_t i = 0; i < qf.getSize(); i++)
-              {
-                const Geometry::Point y(polytope, trans, std::ref(qf.getPoint(i)));
-                res += qf.getWeight(i) * y.getDistortion() * kernel(p, y) * operand(y);
-              }
-            }
-            return res;
-          }
-          else if constexpr (std::is_same_v<RHSRangeType, Math::Vector<ScalarType>>)
+          const auto& kernel = getKernel();
+          const auto& mesh = p.getPolytope().getMesh();
+          if (getTreecode())
+            return getTreecode(mesh)->getValue(kernel, p);
+          const auto cloud = getQuadraturePointCloud(mesh);
+          const auto& weights = cloud->getWeights();
+          ScalarType res = 0;
+          if (m_cacheOperand)
           {
-            Math::Vector<ScalarType> res;
-            getValue(res, p);
-            return res;
+            const auto& values = cloud->getValues();
+            cloud->iterate(0, cloud->size(),
+                [&](const Geometry::Point& y, Index j)
+                {
+                  res += weights.coeff(j) * kernel(p, y) * values.coeff(0, j);
+                });
           }
           else
           {
-            assert(false);
-            return void();
+            const auto& u = getOperand();
+            cloud->iterate(0, cloud->size(),
+                [&](const Geometry::Point& y, Index j)
+                {
+                  res += weights.coeff(j) * kernel(p, y) * u(y);
+                });
           }
+          return res;
+        }
+        else if constexpr (std::is_same_v<RHSRangeType, Math::Vector<ScalarType>>)
+        {
+          Math::Vector<ScalarType> res;
+          getValue(res, p);
+          return res;
         }
         else
         {
-          if constexpr (std::is_same_v<RHSRangeType, ScalarType>)
-          {
-            ScalarType res = 0;
-            for (auto it = mesh.getCell(); it; ++it)
-            {
-              const auto& polytope = *it;
-              const QF::GenericPolytopeQuadrature qf(polytope.getGeometry());
-              const auto& trans = polytope.getTransformation();
-              for (size_t i = 0; i < qf.getSize(); i++)
-              {
-                const Geometry::Point y(polytope, trans, std::cref(qf.getPoint(i)));
-                res += qf.getWeight(i) * y.getDistortion() * kernel(p, y) * operand(y);
-              }
-            }
-            return res;
-          }
-          else if constexpr (std::is_same_v<RHSRangeType, Math::Vector<ScalarType>>)
-          {
-            Math::Vector<ScalarType> res;
-            getValue(res, p);
-            return res;
-          }
-          else
-          {
-            assert(false);
-            return void();
-          }
+          assert(false);
+          return void();
         }
       }
 
       void getValue(Math::Vector<ScalarType>& res, const Geometry::Point& p) const
       {
         const auto& kernel = getKernel();
-        const auto& operand = getOperand();
         const auto& mesh = p.getPolytope().getMesh();
+        if (getTreecode())
+        {
+          getTreecode(mesh)->getValue(res, kernel, p);
+          return;
+        }
+        const auto cloud = getQuadraturePointCloud(mesh);
+        const auto& weights = cloud->getWeights();
         res.resize(getRangeShape().height());
         res.setZero();
         Math::Matrix<ScalarType> kxy;
-        if (m_qf.has_value())
+        if (m_cacheOperand)
         {
-          for (auto it = mesh.getCell(); it; ++it)
-          {
-            const auto& polytope = *it;
-            const auto& qf = m_qf.value()(polytope);
-            const auto& trans = polytope.getTransformation();
-            for (size_t i = 0; i < qf.getSize(); i++)
-            {
-              const Geometry::Point y(polytope, trans, std::cref(qf.getPoint(i)));
-              kernel(kxy, p, y);
-              res += qf.getWeight(i) * y.getDistortion() * kxy * operand(y);
-            }
-          }
+          const auto& values = cloud->getValues();
+          cloud->iterate(0, cloud->size(),
+              [&](const Geometry::Point& y, Index j)
+              {
+                kernel(kxy, p, y);
+                res += weights.coeff(j) * kxy * values.col(j);
+              });
         }
         else
         {
-          for (auto it = mesh.getCell(); it; ++it)
-          {
-            const auto& polytope = *it;
-            const QF::GenericPolytopeQuadrature qf(polytope.getGeometry());
-            const auto& trans = polytope.getTransformation();
-            for (size_t i = 0; i < qf.getSize(); i++)
-            {
-              const Geometry::Point y(polytope, trans, std::cref(qf.getPoint(i)));
-              kernel(kxy, p, y);
-              res += qf.getWeight(i) * y.getDistortion() * kxy * operand(y);
-            }
-          }
+          const auto& u = getOperand();
+          Math::Vector<ScalarType> uy;
+          cloud->iterate(0, cloud->size(),
+              [&](const Geometry::Point& y, Index j)
+              {
+                kernel(kxy, p, y);
+                u.getValue(uy, y);
+                res += weights.coeff(j) * kxy * uy;
+              });
         }
       }
 
@@ -308,6 +297,10 @@ namespace Rodin::Variational
           const std::function<const QF::QuadratureFormulaBase&(const Geometry::Polytope&)>& qf)
       {
         m_qf.emplace(qf);
+        const auto treecode = getTreecode();
+        m_cache = std::make_shared<Cache>();
+        if (treecode)
+          m_cache->treecode = std::make_shared<const Treecode>(treecode->getAcceptance(), treecode->getOrder());
         return *this;
       }
 
@@ -316,16 +309,170 @@ namespace Rodin::Variational
         return m_qf;
       }
 
+      /**
+       * @brief Evaluates the potential with a Treecode, instead of summing
+       * over all the quadrature points of the mesh.
+       * @param[in] tolerance Target relative accuracy of the approximation
+       * @param[in] theta Multipole acceptance parameter @f$ 0 < \theta < 1
+       * @f$
+       *
+       * The tree of quadrature points and the values of the operand at them
+       * are computed at the first evaluation on a mesh, and are reused by
+       * the subsequent evaluations on the same revision of the mesh. Hence
+       * clearCache() must be called if the operand changes.
+       *
+       * @see Treecode::getOrder(Real, Real)
+       */
+      Potential& setTreecode(Real tolerance, Real theta = 0.5)
+      {
+        m_cache = std::make_shared<Cache>();
+        m_cache->treecode = std::make_shared<const Treecode>(theta, Treecode::getOrder(theta, tolerance));
+        return *this;
+      }
+
+      /**
+       * @brief Gets the treecode, or nullptr if the potential is evaluated
+       * directly.
+       */
+      std::shared_ptr<const Treecode> getTreecode() const
+      {
+        std::lock_guard lock(m_cache->mutex);
+        return m_cache->treecode;
+      }
+
+      /**
+       * @brief Sets whether the values of the operand at the quadrature
+       * points are computed once and reused by the subsequent evaluations.
+       *
+       * By default the operand is evaluated at every evaluation of the
+       * potential. If the values are cached, clearCache() must be called
+       * when the operand changes. The values are always cached when the
+       * potential is evaluated with a Treecode.
+       */
+      Potential& setOperandCache(bool cache = true)
+      {
+        m_cacheOperand = cache;
+        return *this;
+      }
+
+      /**
+       * @brief Discards the quadrature points, the values of the operand
+       * and the tree computed by the previous evaluations.
+       *
+       * The cache is shared with the copies of the potential, which are
+       * hence also affected.
+       */
+      Potential& clearCache()
+      {
+        std::lock_guard lock(m_cache->mutex);
+        m_cache->cloud.reset();
+        if (m_cache->treecode)
+        {
+          m_cache->treecode = std::make_shared<const Treecode>(
+              m_cache->treecode->getAcceptance(), m_cache->treecode->getOrder());
+        }
+        return *this;
+      }
+
+      /**
+       * @brief Gets the cloud of quadrature points of the cells of @p mesh.
+       *
+       * The cloud is computed at the first evaluation on a mesh, and is
+       * shared by the copies of the potential, so that the copies used by
+       * the threads of a parallel projection compute it only once. It is
+       * computed again when the mesh is modified. It contains the values of
+       * the operand only if they are cached.
+       *
+       * @see setOperandCache(bool), clearCache()
+       */
+      std::shared_ptr<const QuadraturePointCloud> getQuadraturePointCloud(const Geometry::MeshBase& mesh) const
+      {
+        std::lock_guard lock(m_cache->mutex);
+        return getQuadraturePointCloudUnlocked(mesh, m_cacheOperand);
+      }
+
       Potential* copy() const noexcept override
       {
         return new Potential(*this);
       }
 
     private:
+      /**
+       * @brief Data computed at the first evaluation and shared by the copies
+       * of the potential.
+       */
+      struct Cache
+      {
+        Threads::Mutex mutex;
+        std::shared_ptr<const QuadraturePointCloud> cloud;
+        std::shared_ptr<const Treecode> treecode;
+      };
+
+      /**
+       * @brief Gets the cached cloud of @p mesh, computing it if it was not
+       * computed on the current revision of the mesh, or if @p values is
+       * true and it lacks the values of the operand.
+       */
+      std::shared_ptr<const QuadraturePointCloud> getQuadraturePointCloudUnlocked(
+          const Geometry::MeshBase& mesh, bool values) const
+      {
+        const auto& cached = m_cache->cloud;
+        if (!cached || cached->getMesh() != &mesh || cached->getRevision() != mesh.getRevision())
+        {
+          auto cloud = std::make_shared<QuadraturePointCloud>();
+          if (m_qf.has_value())
+          {
+            cloud->build(mesh, m_qf.value());
+          }
+          else
+          {
+            std::map<Geometry::Polytope::Type, QF::GenericPolytopeQuadrature> qfs;
+            cloud->build(mesh,
+                [&](const Geometry::Polytope& polytope) -> const QF::QuadratureFormulaBase&
+                {
+                  const auto g = polytope.getGeometry();
+                  auto it = qfs.find(g);
+                  if (it == qfs.end())
+                    it = qfs.emplace(g, QF::GenericPolytopeQuadrature(g)).first;
+                  return it->second;
+                });
+          }
+          if (values)
+            cloud->evaluate(getOperand());
+          m_cache->cloud = std::move(cloud);
+        }
+        else if (values && cached->getVectorDimension() == 0)
+        {
+          auto cloud = std::make_shared<QuadraturePointCloud>(*cached);
+          cloud->evaluate(getOperand());
+          m_cache->cloud = std::move(cloud);
+        }
+        return m_cache->cloud;
+      }
+
+      /**
+       * @brief Gets the treecode built on the quadrature points of @p mesh.
+       */
+      std::shared_ptr<const Treecode> getTreecode(const Geometry::MeshBase& mesh) const
+      {
+        std::lock_guard lock(m_cache->mutex);
+        assert(m_cache->treecode);
+        const auto& cached = m_cache->treecode;
+        if (cached->getMesh() != &mesh || cached->getRevision() != mesh.getRevision())
+        {
+          auto treecode = std::make_shared<Treecode>(cached->getAcceptance(), cached->getOrder());
+          treecode->build(*getQuadraturePointCloudUnlocked(mesh, true));
+          m_cache->treecode = std::move(treecode);
+        }
+        return m_cache->treecode;
+      }
+
       std::reference_wrapper<const KernelType> m_kernel;
       std::unique_ptr<OperandType> m_u;
       std::optional<
         std::function<const QF::QuadratureFormulaBase&(const Geometry::Polytope&)>> m_qf;
+      bool m_cacheOperand;
+      std::shared_ptr<Cache> m_cache;
   };
 
   /**
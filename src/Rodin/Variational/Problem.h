@@ -16,6 +16,7 @@
 #include "Rodin/Alert.h"
 #include "Rodin/Geometry.h"
 #include "Rodin/Solver/Solver.h"
+#include "Rodin/Solver/PatternCache.h"
 #include "Rodin/Math/Vector.h"
 #include "Rodin/Math/SparseMatrix.h"
 #include "Rodin/Math/BlockSparseMatrix.h"
@@ -372,20 +373,30 @@ namespace Rodin::Variational
         m_linearForm.assemble();
         m_mass = std::move(m_linearForm.getVector());
 
+        // Hand the previous operator back to the bilinear form, so that its
+        // values may be refilled in place if the sparsity pattern is unchanged
+        auto& op = m_bilinearForm.getOperator();
+        op.swap(m_stiffness);
         m_bilinearForm.assemble();
-        m_stiffness = std::move(m_bilinearForm.getOperator());
+        m_stiffness.swap(op);
 
         for (auto& bf : m_bfs)
         {
           bf.assemble();
-          m_stiffness += bf.getOperator();
+          Math::Kernels::add(m_stiffness, bf.getOperator());
         }
 
+        // Recompute the elimination positions only if the pattern changed
+        if (!m_pattern.matches(m_stiffness))
+        {
+          m_stiffness.makeCompressed();
+          m_pattern.set(m_stiffness);
+          m_eliminations.clear();
+        }
+        m_eliminations.resize(m_dbcs.size());
+
         // Impose Dirichlet boundary conditions
-        auto& trial = getTrialFunction();
-        const auto& trialFES = trial.getFiniteElementSpace();
-        const auto& test = getTestFunction();
-        const auto& testFES = test.getFiniteElementSpace();
+        size_t i = 0;
         for (auto& dbc : m_dbcs)
         {
           dbc.assemble();
@@ -396,8 +407,22 @@ namespace Rodin::Variational
           }
           else
           {
-            Math::Kernels::eliminate(m_stiffness, m_mass, dofs);
+            auto& [keys, positions] = m_eliminations[i];
+            const Boolean sameDOFs =
+              keys.size() == dofs.size() &&
+              std::equal(keys.begin(), keys.end(), dofs.begin(),
+                  [](const Index k, const auto& kv) { return k == kv.first; });
+            if (!sameDOFs)
+            {
+              keys.clear();
+              keys.reserve(dofs.size());
+              for (const auto& kv : dofs)
+                keys.push_back(kv.first);
+              positions = Math::Kernels::getEliminationPositions(m_stiffness, dofs);
+            }
+            Math::Kernels::eliminate(m_stiffness, m_mass, dofs, positions);
           }
+          i++;
         }
 
         // Impose periodic boundary conditions
@@ -417,8 +442,9 @@ namespace Rodin::Variational
          // Solve the system AX = B
          solver.solve(m_stiffness, m_guess, m_mass);
 
-         // Recover solution
-         getTrialFunction().emplace().getSolution().setWeights(std::move(m_guess));
+         // Recover solution. It is kept as the initial guess of the next
+         // solve.
+         getTrialFunction().emplace().getSolution().setWeights(m_guess);
       }
 
       Problem& operator=(const ProblemBody<OperatorType, VectorType, ScalarType>& rhs) override
@@ -487,6 +513,14 @@ namespace Rodin::Variational
       VectorType      m_mass;
       VectorType      m_guess;
       OperatorType    m_stiffness;
+
+      // Sparsity pattern of m_stiffness for which the cached elimination
+      // positions are valid
+      Solver::Internal::PatternCache<OperatorType> m_pattern;
+
+      // Essential degrees of freedom and elimination positions of each
+      // Dirichlet boundary condition
+      std::vector<std::pair<std::vector<Index>, std::vector<Index>>> m_eliminations;
   };
 
   template <class TrialFES, class TestFES>
@@ -693,7 +693,7 @@ namespace Rodin::Variational
   {
     using ScalarType = RHSScalar;
     ProblemBody<OperatorType, VectorType, ScalarType> res(pb);
-    res.getEssentialBoundary().add(dbcs);
+    res.getDBCs().add(dbcs);
     return res;
   }
 
@@ -0,0 +1,274 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_VARIATIONAL_QUADRATUREPOINTCLOUD_H
+#define RODIN_VARIATIONAL_QUADRATUREPOINTCLOUD_H
+
+#include <vector>
+#include <cassert>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/Matrix.h"
+#include "Rodin/Geometry/Mesh.h"
+#include "Rodin/Geometry/Point.h"
+#include "Rodin/Geometry/Polytope.h"
+#include "Rodin/QF/QuadratureFormula.h"
+
+#include "ForwardDecls.h"
+
+namespace Rodin::Variational
+{
+  /**
+   * @brief Cloud of the quadrature points of the cells of a mesh.
+   *
+   * Stores, for each quadrature point @f$ y_j @f$ of each cell, in
+   * contiguous arrays:
+   *  - the physical coordinates of @f$ y_j @f$,
+   *  - the reference coordinates of @f$ y_j @f$ and the index of its cell,
+   *  - the weight @f$ w_j = \omega_j \ \mathbf{D}(y_j) @f$, where @f$
+   *    \omega_j @f$ is the quadrature weight and @f$ \mathbf{D} @f$ the
+   *    distortion,
+   *  - the value @f$ f(y_j) @f$ of the operand.
+   *
+   * The cloud is computed once, after which an integral
+   * @f[
+   *   \int_\Omega k(x, y) f(y) \ dy \approx \sum_j w_j \ k(x, y_j) f(y_j)
+   * @f]
+   * is evaluated without computing any polytope transformation.
+   */
+  class QuadraturePointCloud
+  {
+    public:
+      QuadraturePointCloud()
+        : m_mesh(nullptr),
+          m_revision(0)
+      {}
+
+      QuadraturePointCloud(const QuadraturePointCloud&) = default;
+
+      QuadraturePointCloud(QuadraturePointCloud&&) = default;
+
+      QuadraturePointCloud& operator=(const QuadraturePointCloud&) = default;
+
+      QuadraturePointCloud& operator=(QuadraturePointCloud&&) = default;
+
+      /**
+       * @brief Computes the quadrature points of the cells of @p mesh and the
+       * values of @p operand at them.
+       * @param[in] mesh Mesh whose cells are integrated
+       * @param[in] operand Scalar or vector valued function @f$ f @f$
+       * @param[in] qf Function returning the quadrature formula of a cell
+       */
+      template <class Operand, class QF>
+      QuadraturePointCloud& build(const Geometry::MeshBase& mesh, const Operand& operand, const QF& qf)
+      {
+        return build(mesh, qf).evaluate(operand);
+      }
+
+      /**
+       * @brief Computes the quadrature points of the cells of @p mesh,
+       * without the values of an operand.
+       * @param[in] mesh Mesh whose cells are integrated
+       * @param[in] qf Function returning the quadrature formula of a cell
+       */
+      template <class QF>
+      QuadraturePointCloud& build(const Geometry::MeshBase& mesh, const QF& qf)
+      {
+        m_mesh = &mesh;
+        m_revision = mesh.getRevision();
+        const size_t D = mesh.getDimension();
+        const size_t sdim = mesh.getSpaceDimension();
+
+        size_t n = 0;
+        for (Index i = 0; i < mesh.getCellCount(); i++)
+          n += qf(Geometry::Polytope(D, i, mesh)).getSize();
+
+        m_coordinates.resize(sdim, n);
+        m_rc.resize(D, n);
+        m_cells.resize(n);
+        m_weights.resize(n);
+        m_values.resize(0, n);
+        size_t j = 0;
+        for (Index i = 0; i < mesh.getCellCount(); i++)
+        {
+          const Geometry::Polytope polytope(D, i, mesh);
+          const auto& trans = polytope.getTransformation();
+          const auto& f = qf(polytope);
+          for (size_t k = 0; k < f.getSize(); k++, j++)
+          {
+            const Geometry::Point y(polytope, trans, std::cref(f.getPoint(k)));
+            m_weights(j) = f.getWeight(k) * y.getDistortion();
+            m_coordinates.col(j) = y.getCoordinates();
+            m_rc.col(j) = f.getPoint(k);
+            m_cells[j] = i;
+          }
+        }
+        return *this;
+      }
+
+      /**
+       * @brief Computes the values of @p operand at the points, replacing
+       * the previous values.
+       * @param[in] operand Scalar or vector valued function @f$ f @f$
+       */
+      template <class Operand>
+      QuadraturePointCloud& evaluate(const Operand& operand)
+      {
+        m_values.resize(0, size());
+        iterate(0, size(),
+            [&](const Geometry::Point& y, Index j)
+            {
+              const auto v = operand(y);
+              if constexpr (std::is_same_v<std::decay_t<decltype(v)>, Real>)
+              {
+                if (j == 0)
+                  m_values.resize(1, size());
+                m_values(0, j) = v;
+              }
+              else
+              {
+                if (j == 0)
+                  m_values.resize(v.size(), size());
+                m_values.col(j) = v;
+              }
+            });
+        return *this;
+      }
+
+      /**
+       * @brief Reorders the points, so that the @f$ p @f$-th point becomes
+       * the point @f$ \mathrm{perm}[p] @f$.
+       */
+      QuadraturePointCloud& permute(const std::vector<Index>& perm)
+      {
+        assert(perm.size() == size());
+        QuadraturePointCloud res(*this);
+        for (size_t p = 0; p < perm.size(); p++)
+        {
+          res.m_coordinates.col(p) = m_coordinates.col(perm[p]);
+          res.m_rc.col(p) = m_rc.col(perm[p]);
+          res.m_cells[p] = m_cells[perm[p]];
+          res.m_weights(p) = m_weights(perm[p]);
+          res.m_values.col(p) = m_values.col(perm[p]);
+        }
+        return *this = std::move(res);
+      }
+
+      /**
+       * @brief Calls @p f with the Geometry::Point of each quadrature point
+       * with position in @f$ [begin, end) @f$, and its position.
+       *
+       * The points are built from the stored coordinates, and consecutive
+       * points of the same cell share the same polytope.
+       */
+      template <class F>
+      void iterate(size_t begin, size_t end, F&& f) const
+      {
+        assert(m_mesh);
+        assert(end <= size());
+        const auto& mesh = *m_mesh;
+        const size_t D = mesh.getDimension();
+        Math::SpatialVector<Real> rc;
+        Math::SpatialVector<Real> pc;
+        size_t j = begin;
+        while (j < end)
+        {
+          const Index cell = m_cells[j];
+          const Geometry::Polytope polytope(D, cell, mesh);
+          const auto& trans = polytope.getTransformation();
+          for (; j < end && m_cells[j] == cell; j++)
+          {
+            rc = m_rc.col(j);
+            pc = m_coordinates.col(j);
+            const Geometry::Point y(polytope, trans, std::cref(rc), pc);
+            f(y, j);
+          }
+        }
+      }
+
+      /**
+       * @brief Gets the mesh of the cloud, or nullptr if the cloud has not
+       * been built.
+       */
+      const Geometry::MeshBase* getMesh() const
+      {
+        return m_mesh;
+      }
+
+      /**
+       * @brief Gets the revision of the mesh at which the cloud was built.
+       * @see Geometry::MeshBase::getRevision()
+       */
+      size_t getRevision() const
+      {
+        return m_revision;
+      }
+
+      /**
+       * @brief Gets the number of points.
+       */
+      size_t size() const
+      {
+        return m_cells.size();
+      }
+
+      /**
+       * @brief Gets the dimension of the values of the operand.
+       */
+      size_t getVectorDimension() const
+      {
+        return m_values.rows();
+      }
+
+      /**
+       * @brief Gets the @f$ s \times n @f$ matrix of physical coordinates.
+       */
+      const Math::Matrix<Real>& getCoordinates() const
+      {
+        return m_coordinates;
+      }
+
+      const Math::Matrix<Real>& getReferenceCoordinates() const
+      {
+        return m_rc;
+      }
+
+      const std::vector<Index>& getCells() const
+      {
+        return m_cells;
+      }
+
+      /**
+       * @brief Gets the weights @f$ w_j @f$, which include the distortion.
+       */
+      const Math::Vector<Real>& getWeights() const
+      {
+        return m_weights;
+      }
+
+      /**
+       * @brief Gets the @f$ m \times n @f$ matrix of the values of the
+       * operand, which has no rows if the cloud was built without an
+       * operand.
+       */
+      const Math::Matrix<Real>& getValues() const
+      {
+        return m_values;
+      }
+
+    private:
+      const Geometry::MeshBase* m_mesh;
+      size_t m_revision;
+      Math::Matrix<Real> m_coordinates;
+      Math::Matrix<Real> m_rc;
+      std::vector<Index> m_cells;
+      Math::Vector<Real> m_weights;
+      Math::Matrix<Real> m_values;
+  };
+}
+
+#endif
@@ -381,6 +381,20 @@ namespace Rodin::Variational
         return res;
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) final override
+      {
+        res.setZero();
+        auto& integrand = *m_integrand;
+        for (size_t i = 0; i < m_ps.size(); i++)
+        {
+          integrand.setPoint(m_ps[i]);
+          const Real w = m_qf->getWeight(i) * m_ps[i].getDistortion();
+          for (size_t l = 0; l < static_cast<size_t>(res.rows()); l++)
+            for (size_t m = 0; m < static_cast<size_t>(res.cols()); m++)
+              res(l, m) += w * integrand(m, l);
+        }
+      }
+
       virtual Integrator::Region getRegion() const override = 0;
 
       virtual QuadratureRule* copy() const noexcept override = 0;
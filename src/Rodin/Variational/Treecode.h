@@ -0,0 +1,375 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef RODIN_VARIATIONAL_TREECODE_H
+#define RODIN_VARIATIONAL_TREECODE_H
+
+#include <cmath>
+#include <array>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+
+#include "Rodin/Types.h"
+#include "Rodin/Math/Vector.h"
+#include "Rodin/Math/Matrix.h"
+#include "Rodin/Math/ClusterTree.h"
+#include "Rodin/Geometry/Mesh.h"
+#include "Rodin/Geometry/Point.h"
+#include "Rodin/Geometry/Polytope.h"
+#include "Rodin/QF/QuadratureFormula.h"
+
+#include "ForwardDecls.h"
+#include "QuadraturePointCloud.h"
+
+namespace Rodin::Variational
+{
+  /**
+   * @brief Barycentric Lagrange treecode for the evaluation of potentials.
+   *
+   * Approximates the sum
+   * @f[
+   *   (K f)(x) \approx \sum_{j} w_j \ k(x, y_j) f(y_j)
+   * @f]
+   * over the quadrature points @f$ y_j @f$ of the cells of a mesh. The
+   * quadrature points are organized in a Math::ClusterTree. For each cluster
+   * @f$ C @f$, the kernel is interpolated in its second variable on the
+   * tensor Chebyshev grid @f$ \{ z_k \} @f$ of the bounding box of @f$ C @f$,
+   * which gives the equivalent charges
+   * @f[
+   *   W_k = \sum_{y_j \in C} w_j f(y_j) L_k(y_j) \ ,
+   * @f]
+   * where @f$ L_k @f$ are the Lagrange polynomials of the grid. If the
+   * cluster is well separated from the target @f$ x @f$, that is @f$ r_C \leq
+   * \theta \ | x - c_C | @f$, the contribution of the cluster is evaluated as
+   * @f$ \sum_k k(x, z_k) W_k @f$. Otherwise the cluster is visited
+   * recursively, and the leaves are summed directly.
+   *
+   * The method is kernel independent, and the evaluation of one target costs
+   * @f$ \mathcal{O}(p^s \log N) @f$ kernel evaluations, where @f$ p @f$ is the
+   * number of interpolation points per axis.
+   *
+   * @note Well separated clusters are represented by points whose physical
+   * coordinates are the Chebyshev nodes, hence the kernel must only depend
+   * on the physical coordinates of its arguments.
+   */
+  class Treecode
+  {
+    public:
+      /**
+       * @brief Constructs a treecode.
+       * @param[in] theta Multipole acceptance parameter @f$ 0 < \theta < 1
+       * @f$
+       * @param[in] order Degree of the interpolation polynomial along each
+       * axis
+       */
+      Treecode(Real theta, size_t order)
+        : m_theta(theta), m_order(order), m_vdim(0)
+      {
+        assert(theta > 0 && theta < 1);
+        assert(order > 0);
+      }
+
+      Treecode(const Treecode&) = default;
+
+      Treecode(Treecode&&) = default;
+
+      /**
+       * @brief Gets the interpolation degree which achieves the relative
+       * accuracy @p tolerance for the acceptance parameter @p theta.
+       *
+       * The interpolation error of an analytic kernel on the Chebyshev grid
+       * decays like @f$ \rho^{-p} @f$, where @f$ \rho = \theta^{-1} +
+       * \sqrt{\theta^{-2} - 1} @f$ is the parameter of the largest Bernstein
+       * ellipse which excludes the target.
+       */
+      static size_t getOrder(Real theta, Real tolerance)
+      {
+        assert(theta > 0 && theta < 1);
+        assert(tolerance > 0);
+        const Real rho = 1 / theta + std::sqrt(1 / (theta * theta) - 1);
+        const Real order = std::ceil(std::log(1 / tolerance) / std::log(rho));
+        return std::clamp<size_t>(static_cast<size_t>(std::max(order, Real(1))), 1, 16);
+      }
+
+      /**
+       * @brief Builds the tree of quadrature points and the equivalent
+       * charges of the clusters.
+       * @param[in] mesh Mesh whose cells are integrated
+       * @param[in] operand Function @f$ f @f$
+       * @param[in] qf Function returning the quadrature formula of a cell
+       */
+      template <class Operand, class QF>
+      Treecode& build(const Geometry::MeshBase& mesh, const Operand& operand, const QF& qf)
+      {
+        QuadraturePointCloud cloud;
+        cloud.build(mesh, operand, qf);
+        return build(std::move(cloud));
+      }
+
+      /**
+       * @brief Builds the tree of the given quadrature points and the
+       * equivalent charges of the clusters.
+       *
+       * The cloud must have been built with the values of the operand.
+       */
+      Treecode& build(QuadraturePointCloud cloud)
+      {
+        assert(cloud.getMesh());
+        assert(cloud.getVectorDimension() > 0);
+        const size_t sdim = cloud.getMesh()->getSpaceDimension();
+        const size_t n = cloud.size();
+        m_tree = Math::ClusterTree(cloud.getCoordinates(), cloud.getCoordinates(), getProxyCount(sdim));
+
+        // Store the quadrature points in the order of the tree
+        m_cloud = std::move(cloud);
+        m_cloud.permute(m_tree.getIndices());
+        m_vdim = m_cloud.getVectorDimension();
+        m_charges = m_cloud.getValues() * m_cloud.getWeights().asDiagonal();
+        assert(static_cast<size_t>(m_charges.cols()) == n);
+
+        // Compute the equivalent charges of the clusters
+        const auto& nodes = m_tree.getNodes();
+        std::array<std::vector<Real>, RODIN_MAXIMAL_SPACE_DIMENSION> grid, basis;
+        std::array<size_t, RODIN_MAXIMAL_SPACE_DIMENSION> extent;
+        m_offsets.resize(nodes.size() + 1);
+        m_offsets[0] = 0;
+        for (size_t k = 0; k < nodes.size(); k++)
+        {
+          size_t count = 1;
+          for (size_t a = 0; a < sdim; a++)
+          {
+            getGrid(grid[a], nodes[k].min(a), nodes[k].max(a), nodes[k].getDiameter());
+            count *= grid[a].size();
+          }
+          m_offsets[k + 1] = m_offsets[k] + count;
+        }
+        m_proxies.resize(sdim, m_offsets.back());
+        m_proxyCharges.resize(m_vdim, m_offsets.back());
+        m_proxyCharges.setZero();
+        for (size_t k = 0; k < nodes.size(); k++)
+        {
+          const auto& node = nodes[k];
+          for (size_t a = 0; a < sdim; a++)
+          {
+            getGrid(grid[a], node.min(a), node.max(a), node.getDiameter());
+            extent[a] = grid[a].size();
+          }
+          const size_t offset = m_offsets[k];
+          const size_t count = m_offsets[k + 1] - offset;
+          for (size_t q = 0; q < count; q++)
+          {
+            size_t r = q;
+            for (size_t a = 0; a < sdim; a++)
+            {
+              m_proxies(a, offset + q) = grid[a][r % extent[a]];
+              r /= extent[a];
+            }
+          }
+          for (size_t p = node.begin; p < node.end; p++)
+          {
+            for (size_t a = 0; a < sdim; a++)
+              getBasis(basis[a], grid[a], m_cloud.getCoordinates()(a, p));
+            for (size_t q = 0; q < count; q++)
+            {
+              size_t r = q;
+              Real l = 1;
+              for (size_t a = 0; a < sdim; a++)
+              {
+                l *= basis[a][r % extent[a]];
+                r /= extent[a];
+              }
+              m_proxyCharges.col(offset + q) += l * m_charges.col(p);
+            }
+          }
+        }
+        return *this;
+      }
+
+      /**
+       * @brief Evaluates the potential of a scalar operand at @p x.
+       */
+      template <class Kernel>
+      Real getValue(const Kernel& kernel, const Geometry::Point& x) const
+      {
+        assert(m_vdim == 1);
+        Real res = 0;
+        traverse(x,
+            [&](const Geometry::Point& y, Index p)
+            {
+              res += kernel(x, y) * m_charges(0, p);
+            },
+            [&](const Geometry::Point& z, Index k)
+            {
+              res += kernel(x, z) * m_proxyCharges(0, k);
+            });
+        return res;
+      }
+
+      /**
+       * @brief Evaluates the potential of a vector operand at @p x.
+       */
+      template <class Kernel>
+      void getValue(Math::Vector<Real>& res, const Kernel& kernel, const Geometry::Point& x) const
+      {
+        res.resize(m_vdim);
+        res.setZero();
+        Math::Matrix<Real> kxy;
+        traverse(x,
+            [&](const Geometry::Point& y, Index p)
+            {
+              kernel(kxy, x, y);
+              res += kxy * m_charges.col(p);
+            },
+            [&](const Geometry::Point& z, Index k)
+            {
+              kernel(kxy, x, z);
+              res += kxy * m_proxyCharges.col(k);
+            });
+      }
+
+      /**
+       * @brief Gets the mesh of the quadrature points, or nullptr if the
+       * treecode has not been built.
+       */
+      const Geometry::MeshBase* getMesh() const
+      {
+        return m_cloud.getMesh();
+      }
+
+      /**
+       * @brief Gets the revision of the mesh at which the treecode was
+       * built.
+       */
+      size_t getRevision() const
+      {
+        return m_cloud.getRevision();
+      }
+
+      Real getAcceptance() const
+      {
+        return m_theta;
+      }
+
+      size_t getOrder() const
+      {
+        return m_order;
+      }
+
+    private:
+      size_t getProxyCount(size_t sdim) const
+      {
+        size_t res = 1;
+        for (size_t a = 0; a < sdim; a++)
+          res *= m_order + 1;
+        return res;
+      }
+
+      /**
+       * @brief Computes the Chebyshev points of the second kind on @f$ [a,
+       * b] @f$, or the midpoint if the interval is degenerate.
+       */
+      void getGrid(std::vector<Real>& res, Real a, Real b, Real diameter) const
+      {
+        if (b - a <= 1e-12 * diameter)
+        {
+          res.assign(1, 0.5 * (a + b));
+          return;
+        }
+        res.resize(m_order + 1);
+        for (size_t i = 0; i <= m_order; i++)
+          res[i] = 0.5 * (a + b) + 0.5 * (b - a) * std::cos(M_PI * i / m_order);
+      }
+
+      /**
+       * @brief Evaluates the Lagrange polynomials of the Chebyshev grid at
+       * @p t, with the barycentric formula.
+       */
+      static void getBasis(std::vector<Real>& res, const std::vector<Real>& grid, Real t)
+      {
+        const size_t n = grid.size();
+        res.resize(n);
+        if (n == 1)
+        {
+          res[0] = 1;
+          return;
+        }
+        Real sum = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+          const Real diff = t - grid[i];
+          if (diff == 0)
+          {
+            std::fill(res.begin(), res.end(), 0);
+            res[i] = 1;
+            return;
+          }
+          const Real w = ((i % 2) ? -1 : 1) * ((i == 0 || i == n - 1) ? 0.5 : 1);
+          res[i] = w / diff;
+          sum += res[i];
+        }
+        for (size_t i = 0; i < n; i++)
+          res[i] /= sum;
+      }
+
+      template <class Near, class Far>
+      void traverse(const Geometry::Point& x, Near&& near, Far&& far) const
+      {
+        assert(getMesh());
+        if (m_tree.empty())
+          return;
+        const auto& mesh = *getMesh();
+        const size_t D = mesh.getDimension();
+        const auto& cells = m_cloud.getCells();
+        const auto& xc = x.getCoordinates();
+        std::vector<size_t> stack;
+        stack.push_back(0);
+        while (stack.size() > 0)
+        {
+          const size_t k = stack.back();
+          const auto& node = m_tree.getNode(k);
+          stack.pop_back();
+          const size_t count = m_offsets[k + 1] - m_offsets[k];
+          const Real radius = 0.5 * (node.max - node.min).norm();
+          const Real distance = (xc - 0.5 * (node.min + node.max)).norm();
+          if (node.size() > count && radius <= m_theta * distance)
+          {
+            const Geometry::Polytope polytope(D, cells[node.begin], mesh);
+            const auto& trans = polytope.getTransformation();
+            const Math::SpatialVector<Real> rc = m_cloud.getReferenceCoordinates().col(node.begin);
+            Math::SpatialVector<Real> pc;
+            for (size_t q = m_offsets[k]; q < m_offsets[k + 1]; q++)
+            {
+              pc = m_proxies.col(q);
+              const Geometry::Point z(polytope, trans, std::cref(rc), pc);
+              far(z, q);
+            }
+          }
+          else if (node.isLeaf())
+          {
+            m_cloud.iterate(node.begin, node.end, near);
+          }
+          else
+          {
+            stack.push_back(node.children[0]);
+            stack.push_back(node.children[1]);
+          }
+        }
+      }
+
+      Real m_theta;
+      size_t m_order;
+      size_t m_vdim;
+      Math::ClusterTree m_tree;
+      QuadraturePointCloud m_cloud;
+      Math::Matrix<Real> m_charges;
+      std::vector<size_t> m_offsets;
+      Math::Matrix<Real> m_proxies;
+      Math::Matrix<Real> m_proxyCharges;
+  };
+}
+
+#endif
@@ -393,6 +393,12 @@ namespace Rodin::Variational
         return -m_op->integrate(tr, te);
       }
 
+      void getElementMatrix(Math::Matrix<ScalarType>& res) override
+      {
+        m_op->getElementMatrix(res);
+        res = -res;
+      }
+
       UnaryMinus* copy() const noexcept override
       {
         return new UnaryMinus(*this);
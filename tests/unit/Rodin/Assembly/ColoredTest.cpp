@@ -0,0 +1,112 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Assembly/Sequential.h"
+#include "Rodin/Assembly/Multithreaded.h"
+#include "Rodin/Assembly/Colored.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Assembly_Colored, BilinearForm_Scalar_UniformGrid_16x16)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+    RealFunction f = [](const Point& p) { return 1 + p.x() * p.y(); };
+
+    using BilinearFormType = BilinearForm<decltype(fes), decltype(fes), Math::SparseMatrix<Real>>;
+
+    BilinearFormType sequential(u, v);
+    sequential.setAssembly(Assembly::Sequential<Math::SparseMatrix<Real>, BilinearFormType>());
+    sequential = Integral(f * Grad(u), Grad(v)) + Integral(u, v) + BoundaryIntegral(u, v);
+
+    BilinearFormType multithreaded(u, v);
+    multithreaded.setAssembly(Assembly::Multithreaded<Math::SparseMatrix<Real>, BilinearFormType>(4));
+    multithreaded = Integral(f * Grad(u), Grad(v)) + Integral(u, v) + BoundaryIntegral(u, v);
+
+    BilinearFormType colored(u, v);
+    colored.setAssembly(Assembly::Colored<Math::SparseMatrix<Real>, BilinearFormType>(4));
+    colored = Integral(f * Grad(u), Grad(v)) + Integral(u, v) + BoundaryIntegral(u, v);
+
+    const auto& a = sequential.getOperator();
+    const auto& b = multithreaded.getOperator();
+    const auto& c = colored.getOperator();
+    ASSERT_EQ(a.rows(), c.rows());
+    ASSERT_EQ(a.cols(), c.cols());
+    EXPECT_LT((a - c).norm(), RODIN_FUZZY_CONSTANT * a.norm());
+    EXPECT_LT((b - c).norm(), RODIN_FUZZY_CONSTANT * b.norm());
+  }
+
+  TEST(Rodin_Assembly_Colored, BilinearForm_Vector_UniformGrid_12x12)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 12, 12 });
+    mesh.scale(1.0 / 11);
+
+    P1 fes(mesh, mesh.getSpaceDimension());
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    using BilinearFormType = BilinearForm<decltype(fes), decltype(fes), Math::SparseMatrix<Real>>;
+
+    BilinearFormType sequential(u, v);
+    sequential.setAssembly(Assembly::Sequential<Math::SparseMatrix<Real>, BilinearFormType>());
+    sequential = Integral(Jacobian(u), Jacobian(v)) + Integral(u, v);
+
+    BilinearFormType colored(u, v);
+    colored.setAssembly(Assembly::Colored<Math::SparseMatrix<Real>, BilinearFormType>(4));
+    colored = Integral(Jacobian(u), Jacobian(v)) + Integral(u, v);
+
+    const auto& a = sequential.getOperator();
+    const auto& c = colored.getOperator();
+    ASSERT_EQ(a.rows(), c.rows());
+    ASSERT_EQ(a.cols(), c.cols());
+    EXPECT_LT((a - c).norm(), RODIN_FUZZY_CONSTANT * a.norm());
+  }
+
+  TEST(Rodin_Assembly_Colored, LinearForm_UniformGrid_16x16)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    TestFunction v(fes);
+    RealFunction f = [](const Point& p) { return 1 + p.x() * p.y(); };
+    RealFunction g = [](const Point& p) { return p.x() - p.y(); };
+
+    using LinearFormType = LinearForm<decltype(fes), Math::Vector<Real>>;
+
+    LinearFormType sequential(v);
+    sequential.setAssembly(Assembly::Sequential<Math::Vector<Real>, LinearFormType>());
+    sequential = Integral(f, v) + BoundaryIntegral(g, v);
+
+    LinearFormType multithreaded(v);
+    multithreaded.setAssembly(Assembly::Multithreaded<Math::Vector<Real>, LinearFormType>(4));
+    multithreaded = Integral(f, v) + BoundaryIntegral(g, v);
+
+    LinearFormType colored(v);
+    colored.setAssembly(Assembly::Colored<Math::Vector<Real>, LinearFormType>(4));
+    colored = Integral(f, v) + BoundaryIntegral(g, v);
+
+    const auto& a = sequential.getVector();
+    const auto& b = multithreaded.getVector();
+    const auto& c = colored.getVector();
+    ASSERT_EQ(a.size(), c.size());
+    EXPECT_LT((a - c).norm(), RODIN_FUZZY_CONSTANT * a.norm());
+    EXPECT_LT((b - c).norm(), RODIN_FUZZY_CONSTANT * b.norm());
+  }
+}
@@ -0,0 +1,141 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Assembly/Sequential.h"
+#include "Rodin/Assembly/Multithreaded.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  using FES = P1<Real, Mesh<Context::Local>>;
+
+  using SparseBilinearForm = BilinearForm<FES, FES, Math::SparseMatrix<Real>>;
+
+  using SequentialAssembly = Assembly::Sequential<Math::SparseMatrix<Real>, SparseBilinearForm>;
+
+  using MultithreadedAssembly = Assembly::Multithreaded<Math::SparseMatrix<Real>, SparseBilinearForm>;
+
+  TEST(Rodin_Assembly_Multithreaded, SparseMatrix_ReusePattern_UniformGrid_16x16)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    FES fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    Real alpha = 1;
+    RealFunction f = [&](const Point& p) { return alpha * (1 + p.x() * p.y()); };
+
+    SparseBilinearForm sequential(u, v);
+    sequential.setAssembly(SequentialAssembly());
+    sequential.add(Integral(f * Grad(u), Grad(v))).add(Integral(u, v));
+
+    SparseBilinearForm multithreaded(u, v);
+    multithreaded.setAssembly(MultithreadedAssembly(4));
+    multithreaded.add(Integral(f * Grad(u), Grad(v))).add(Integral(u, v));
+
+    const auto& assembly = static_cast<const MultithreadedAssembly&>(multithreaded.getAssembly());
+    const auto& pattern = assembly.getSparsityPattern();
+
+    sequential.assemble();
+    multithreaded.assemble();
+    const auto& a = sequential.getOperator();
+    const auto& b = multithreaded.getOperator();
+    ASSERT_EQ(a.rows(), b.rows());
+    ASSERT_EQ(a.cols(), b.cols());
+    EXPECT_LT((a - b).norm(), RODIN_FUZZY_CONSTANT * a.norm());
+    EXPECT_TRUE(pattern.isPatternOf(b));
+    EXPECT_EQ(pattern.getRows(), fes.getSize());
+    EXPECT_EQ(pattern.getColumns(), fes.getSize());
+
+    // Changing the coefficients only refills the values
+    const Real* values = b.valuePtr();
+    const auto* inner = b.innerIndexPtr();
+    const size_t nnz = b.nonZeros();
+    const Math::SparseMatrix<Real> first = b;
+
+    alpha = 3;
+    sequential.assemble();
+    multithreaded.assemble();
+    EXPECT_EQ(b.valuePtr(), values);
+    EXPECT_EQ(b.innerIndexPtr(), inner);
+    EXPECT_EQ(static_cast<size_t>(b.nonZeros()), nnz);
+    EXPECT_TRUE(pattern.isPatternOf(b));
+    EXPECT_LT((a - b).norm(), RODIN_FUZZY_CONSTANT * a.norm());
+    EXPECT_GT((b - first).norm(), RODIN_FUZZY_CONSTANT * first.norm());
+  }
+
+  TEST(Rodin_Assembly_Multithreaded, SparseMatrix_MeshChange)
+  {
+    const MultithreadedAssembly assembly(4);
+    Math::SparseMatrix<Real> res;
+
+    for (const size_t n : { 8, 12 })
+    {
+      Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { n, n });
+      mesh.scale(1.0 / (n - 1));
+      FES fes(mesh);
+      TrialFunction u(fes);
+      TestFunction v(fes);
+
+      SparseBilinearForm sequential(u, v);
+      sequential.setAssembly(SequentialAssembly());
+      sequential = Integral(Grad(u), Grad(v)) + Integral(u, v);
+
+      SparseBilinearForm bf(u, v);
+      bf.add(Integral(Grad(u), Grad(v))).add(Integral(u, v));
+
+      // The pattern must be rebuilt for the new mesh and spaces
+      assembly.execute(res, { fes, fes, bf.getLocalIntegrators(), bf.getGlobalIntegrators() });
+      const auto& pattern = assembly.getSparsityPattern();
+      EXPECT_EQ(pattern.getRows(), fes.getSize());
+      EXPECT_EQ(pattern.getColumns(), fes.getSize());
+      EXPECT_TRUE(pattern.isPatternOf(res));
+
+      const auto& a = sequential.getOperator();
+      ASSERT_EQ(a.rows(), res.rows());
+      ASSERT_EQ(a.cols(), res.cols());
+      EXPECT_LT((a - res).norm(), RODIN_FUZZY_CONSTANT * a.norm());
+    }
+  }
+
+  TEST(Rodin_Assembly_Multithreaded, SparseMatrix_Reorder)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 12, 12 });
+    mesh.scale(1.0 / 11);
+    FES fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    RealFunction f = [](const Point& p) { return 1 + p.x() * p.x() + 2 * p.y(); };
+
+    SparseBilinearForm multithreaded(u, v);
+    multithreaded.setAssembly(MultithreadedAssembly(4));
+    multithreaded.add(Integral(f * Grad(u), Grad(v))).add(Integral(u, v));
+    multithreaded.assemble();
+
+    // Same address and polytope counts, but every polytope is renumbered
+    mesh.reorder();
+
+    SparseBilinearForm sequential(u, v);
+    sequential.setAssembly(SequentialAssembly());
+    sequential = Integral(f * Grad(u), Grad(v)) + Integral(u, v);
+
+    multithreaded.assemble();
+    const auto& assembly = static_cast<const MultithreadedAssembly&>(multithreaded.getAssembly());
+    const auto& a = sequential.getOperator();
+    const auto& b = multithreaded.getOperator();
+    EXPECT_TRUE(assembly.getSparsityPattern().isPatternOf(b));
+    EXPECT_TRUE(assembly.getSparsityPattern().isPatternOf(a));
+    EXPECT_LT((a - b).norm(), RODIN_FUZZY_CONSTANT * a.norm());
+  }
+}
@@ -218,4 +218,40 @@ namespace Rodin::Tests::Unit
     connectivity.compute(d, 0);
     EXPECT_EQ(connectivity.getCount(0), 9);
   }
+
+  TEST(Rodin_Geometry_Connectivity, SanityTest_3D_5Nodes_Tetrahedra)
+  {
+    constexpr const size_t meshDim = 3;
+    constexpr const size_t nodes = 5;
+
+    Connectivity<Context::Local> connectivity;
+    connectivity.initialize(meshDim)
+                .nodes(nodes)
+                .polytope(Polytope::Type::Tetrahedron, {0, 1, 2, 3})
+                .polytope(Polytope::Type::Tetrahedron, {1, 2, 3, 4});
+
+    connectivity.compute(2, 3);
+    EXPECT_EQ(connectivity.getCount(2), 7);
+    EXPECT_EQ(connectivity.getIncidence(2, 3).size(), 7);
+    EXPECT_EQ(connectivity.getIncidence(2, 3).getIndices().size(), 8);
+    const auto shared = connectivity.getIndex(2, IndexArray{{ 1, 2, 3 }});
+    ASSERT_TRUE(shared.has_value());
+    EXPECT_EQ(connectivity.getIncidence({2, 3}, *shared), IndexSet({ 0, 1 }));
+
+    connectivity.compute(1, 3);
+    EXPECT_EQ(connectivity.getCount(1), 9);
+    EXPECT_EQ(connectivity.getIncidence({1, 3}, 0), IndexSet({ 0 }));
+    size_t count = 0;
+    for (Index i = 0; i < connectivity.getCount(1); i++)
+    {
+      const auto inc = connectivity.getIncidence({1, 3}, i);
+      EXPECT_TRUE(std::is_sorted(inc.begin(), inc.end()));
+      count += inc.size();
+    }
+    EXPECT_EQ(count, 12);
+
+    connectivity.compute(3, 3);
+    EXPECT_EQ(connectivity.getIncidence({3, 3}, 0), IndexSet({ 1 }));
+    EXPECT_EQ(connectivity.getIncidence({3, 3}, 1), IndexSet({ 0 }));
+  }
 }
@@ -4,6 +4,8 @@
  *       (See accompanying file LICENSE or copy at
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
+#include <random>
+#include <numeric>
 #include <fstream>
 #include <gtest/gtest.h>
 
@@ -224,5 +226,242 @@ namespace Rodin::Tests::Unit
       }
     }
   }
-}
 
+  TEST(Rodin_Geometry_Mesh, ColoringUniformGrid)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 8, 8 });
+    const size_t D = mesh.getDimension();
+    const auto& coloring = mesh.getColoring(D);
+    EXPECT_GT(coloring.size(), 0);
+
+    size_t count = 0;
+    for (const auto& color : coloring)
+    {
+      IndexSet vertices;
+      for (const Index i : color)
+      {
+        for (const Index v : mesh.getConnectivity().getPolytope(D, i))
+          EXPECT_TRUE(vertices.insert(v).second);
+      }
+      count += color.size();
+    }
+    EXPECT_EQ(count, mesh.getCellCount());
+    EXPECT_EQ(&coloring, &mesh.getColoring(D));
+  }
+
+  TEST(Rodin_Geometry_Mesh, ColoringCopy)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 8, 8 });
+    const size_t D = mesh.getDimension();
+    const auto& coloring = mesh.getColoring(D);
+
+    Mesh copy(mesh);
+    EXPECT_NE(copy.getRevision(), mesh.getRevision());
+    const auto& other = copy.getColoring(D);
+    EXPECT_NE(&coloring, &other);
+    EXPECT_EQ(coloring, other);
+
+    // A new revision invalidates the cached coloring
+    const size_t revision = copy.getRevision();
+    copy.scale(2.0);
+    EXPECT_NE(copy.getRevision(), revision);
+    EXPECT_EQ(copy.getColoring(D), coloring);
+  }
+
+  TEST(Rodin_Geometry_Mesh, PolytopeRangeUniformGrid)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 4, 4 });
+    const size_t D = mesh.getDimension();
+    mesh.getConnectivity().compute(D - 1, D);
+
+    Index expected = 0;
+    for (auto cell : mesh.cells())
+    {
+      EXPECT_EQ(cell.getDimension(), D);
+      EXPECT_EQ(cell.getIndex(), expected++);
+      EXPECT_EQ(cell.getAttribute(), mesh.getAttribute(D, cell.getIndex()));
+    }
+    EXPECT_EQ(expected, mesh.getCellCount());
+
+    size_t boundary = 0;
+    for (auto it = mesh.getBoundary(); !it.end(); ++it)
+      boundary++;
+    size_t count = 0;
+    for (const auto face : mesh.faces())
+      count += face.isBoundary();
+    EXPECT_EQ(count, boundary);
+
+    EXPECT_EQ(mesh.vertices().size(), mesh.getVertexCount());
+    EXPECT_EQ(mesh.polytopes(D - 1).size(), mesh.getFaceCount());
+  }
+
+  TEST(Rodin_Geometry_Mesh, GeometricFactorsUniformGrid)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 4, 4 });
+    const size_t D = mesh.getDimension();
+    mesh.getConnectivity().compute(D - 1, D);
+
+    std::vector<Real> measures;
+    for (const auto cell : mesh.cells())
+      measures.push_back(cell.getMeasure());
+
+    EXPECT_EQ(mesh.getGeometricFactors(D), nullptr);
+    mesh.computeGeometricFactors(D).computeGeometricFactors(D - 1);
+    ASSERT_NE(mesh.getGeometricFactors(D), nullptr);
+    ASSERT_NE(mesh.getGeometricFactors(D - 1), nullptr);
+    EXPECT_EQ(mesh.getGeometricFactors(D)->size(), mesh.getCellCount());
+    EXPECT_EQ(mesh.getGeometricFactors(D - 1)->size(), mesh.getFaceCount());
+
+    const Math::SpatialVector<Real> rc{{ 0.25, 0.25 }};
+    for (const auto cell : mesh.cells())
+    {
+      const Point p(cell, cell.getTransformation(), rc);
+      const auto jacobian = cell.getTransformation().jacobian(rc);
+      EXPECT_NEAR((p.getJacobian() - jacobian).norm(), 0, 1e-12);
+      EXPECT_NEAR(
+          (p.getJacobianInverse() * jacobian - Math::Matrix<Real>::Identity(D, D)).norm(),
+          0, 1e-12);
+      EXPECT_NEAR(p.getJacobianDeterminant(), jacobian.determinant(), 1e-12);
+      EXPECT_NEAR(cell.getMeasure(), measures[cell.getIndex()], 1e-12);
+    }
+
+    // A point constructed before the table is discarded must not refer to it
+    const Polytope cell(D, 0, mesh);
+    const Point p(cell, cell.getTransformation(), rc);
+    mesh.setVertexCoordinates(0, 2 * mesh.getVertexCoordinates(0));
+    EXPECT_EQ(mesh.getGeometricFactors(D), nullptr);
+    EXPECT_EQ(mesh.getGeometricFactors(D - 1), nullptr);
+    EXPECT_NEAR(p.getJacobianDeterminant(),
+        cell.getTransformation().jacobian(rc).determinant(), 1e-12);
+  }
+
+  TEST(Rodin_Geometry_Mesh, GeometricFactorsRevision)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 4, 4 });
+    const size_t D = mesh.getDimension();
+    mesh.computeGeometricFactors(D);
+    ASSERT_NE(mesh.getGeometricFactors(D), nullptr);
+    EXPECT_EQ(mesh.getGeometricFactors(D)->getRevision(), mesh.getRevision());
+
+    Mesh copy(mesh);
+    EXPECT_EQ(copy.getGeometricFactors(D), nullptr);
+
+    Mesh moved(std::move(mesh));
+    ASSERT_NE(moved.getGeometricFactors(D), nullptr);
+    EXPECT_EQ(moved.getGeometricFactors(D)->getRevision(), moved.getRevision());
+
+    moved.scale(2.0);
+    EXPECT_EQ(moved.getGeometricFactors(D), nullptr);
+  }
+
+  TEST(Rodin_Geometry_Mesh, ReorderUniformGrid)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    const size_t D = mesh.getDimension();
+    mesh.getConnectivity().compute(D - 1, D);
+
+    const auto barycenter =
+      [&](size_t d, Index i)
+      {
+        Math::SpatialVector<Real> x = Math::SpatialVector<Real>::Zero(mesh.getSpaceDimension());
+        const auto& vertices = mesh.getConnectivity().getPolytope(d, i);
+        for (const Index v : vertices)
+          x += mesh.getVertexCoordinates(v);
+        return Math::SpatialVector<Real>(x / vertices.size());
+      };
+    const auto attribute =
+      [](const Math::SpatialVector<Real>& x) -> Attribute
+      {
+        return 1 + (x(0) < 0.5) + 2 * (x(1) < 0.5);
+      };
+
+    for (Index i = 0; i < mesh.getCellCount(); i++)
+      mesh.setAttribute({ D, i }, attribute(barycenter(D, i)));
+    for (auto it = mesh.getBoundary(); !it.end(); ++it)
+      mesh.setAttribute({ D - 1, it->getIndex() }, 10 + attribute(barycenter(D - 1, it->getIndex())));
+
+    // Maximal distance between the indices of the vertices of a cell
+    const auto bandwidth =
+      [&]()
+      {
+        size_t res = 0;
+        for (Index i = 0; i < mesh.getCellCount(); i++)
+        {
+          const auto& vertices = mesh.getConnectivity().getPolytope(D, i);
+          res = std::max<size_t>(res, vertices.maxCoeff() - vertices.minCoeff());
+        }
+        return res;
+      };
+
+    // Shuffle the vertices
+    std::vector<Index> shuffle(mesh.getVertexCount());
+    std::iota(shuffle.begin(), shuffle.end(), 0);
+    std::mt19937 gen(0);
+    std::shuffle(shuffle.begin(), shuffle.end(), gen);
+
+    const size_t vertexCount = mesh.getVertexCount();
+    const size_t faceCount = mesh.getFaceCount();
+    const size_t cellCount = mesh.getCellCount();
+    const Real area = mesh.getArea();
+    const size_t grid = bandwidth();
+
+    mesh.reorder(shuffle);
+    const size_t shuffled = bandwidth();
+    EXPECT_GT(shuffled, 4 * grid);
+
+    mesh.reorder();
+    EXPECT_LE(bandwidth(), grid);
+    EXPECT_LT(bandwidth(), shuffled);
+
+    EXPECT_EQ(mesh.getVertexCount(), vertexCount);
+    EXPECT_EQ(mesh.getFaceCount(), faceCount);
+    EXPECT_EQ(mesh.getCellCount(), cellCount);
+    EXPECT_NEAR(mesh.getArea(), area, 1e-12);
+    EXPECT_GT(mesh.getConnectivity().getIncidence(D - 1, D).size(), 0);
+
+    for (Index i = 1; i < mesh.getCellCount(); i++)
+    {
+      const auto& a = mesh.getConnectivity().getPolytope(D, i - 1);
+      const auto& b = mesh.getConnectivity().getPolytope(D, i);
+      EXPECT_LE(a.minCoeff(), b.minCoeff());
+    }
+    for (const auto cell : mesh.cells())
+    {
+      EXPECT_GT(cell.getMeasure(), 0);
+      EXPECT_EQ(cell.getAttribute(), attribute(barycenter(D, cell.getIndex())));
+    }
+    size_t boundary = 0;
+    for (auto it = mesh.getBoundary(); !it.end(); ++it)
+    {
+      EXPECT_EQ(it->getAttribute(), 10 + attribute(barycenter(D - 1, it->getIndex())));
+      boundary++;
+    }
+    EXPECT_EQ(boundary, 4 * 15);
+  }
+
+  TEST(Rodin_Geometry_Mesh, SaveAsync_MEDIT)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Tetrahedron, { 8, 8, 8 });
+    const Math::PointMatrix vertices = mesh.getVertices();
+
+    const auto meshfile =
+      boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.meshb");
+    auto saved = mesh.saveAsync(meshfile, FileFormat::MEDIT);
+
+    // The mesh may be modified while it is being saved
+    mesh.scale(2);
+    saved.get();
+
+    Mesh loaded;
+    loaded.load(meshfile, FileFormat::MEDIT);
+    boost::filesystem::remove(meshfile);
+
+    EXPECT_EQ(loaded.getVertexCount(), mesh.getVertexCount());
+    EXPECT_EQ(loaded.getCellCount(), mesh.getCellCount());
+    EXPECT_EQ((loaded.getVertices() - vertices).norm(), 0);
+
+    auto failed = mesh.saveAsync("/nonexistent/directory/mesh.mesh", FileFormat::MEDIT);
+    EXPECT_THROW(failed.get(), Alert::Exception);
+  }
+}
@@ -0,0 +1,86 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include <Rodin/Geometry.h>
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Geometry_UniformRefinement, Triangle)
+  {
+    Mesh coarse = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 4, 4 });
+    coarse.getConnectivity().compute(1, 0);
+    const size_t edges = coarse.getConnectivity().getCount(1);
+
+    UniformRefinement refinement(coarse);
+    Mesh fine = refinement.refine();
+    EXPECT_EQ(fine.getVertexCount(), coarse.getVertexCount() + edges);
+    EXPECT_EQ(fine.getCellCount(), 4 * coarse.getCellCount());
+    EXPECT_NEAR(fine.getArea(), coarse.getArea(), 1e-12);
+
+    for (Index i = 0; i < coarse.getCellCount(); i++)
+    {
+      const auto [begin, end] = refinement.getChildren(i);
+      EXPECT_EQ(end - begin, 4);
+      Real area = 0;
+      for (Index j = begin; j < end; j++)
+      {
+        EXPECT_EQ(refinement.getParent(j), i);
+        area += fine.getPolytope(2, j)->getMeasure();
+      }
+      EXPECT_NEAR(area, coarse.getPolytope(2, i)->getMeasure(), 1e-12);
+    }
+
+    for (Index i = 0; i < coarse.getVertexCount(); i++)
+    {
+      EXPECT_EQ(refinement.getVertexParents(i).first, i);
+      EXPECT_EQ(refinement.getVertexParents(i).second, i);
+      EXPECT_TRUE(fine.getVertexCoordinates(i).isApprox(coarse.getVertexCoordinates(i)));
+    }
+  }
+
+  TEST(Rodin_Geometry_UniformRefinement, Tetrahedron)
+  {
+    Mesh coarse = LocalMesh::UniformGrid(Polytope::Type::Tetrahedron, { 3, 3, 3 });
+    UniformRefinement refinement(coarse);
+    Mesh fine = refinement.refine();
+    EXPECT_EQ(fine.getCellCount(), 8 * coarse.getCellCount());
+    EXPECT_NEAR(fine.getVolume(), coarse.getVolume(), 1e-12);
+    for (Index i = 0; i < coarse.getCellCount(); i++)
+    {
+      const Real volume = coarse.getPolytope(3, i)->getMeasure();
+      const auto [begin, end] = refinement.getChildren(i);
+      EXPECT_EQ(end - begin, 8);
+      for (Index j = begin; j < end; j++)
+        EXPECT_NEAR(fine.getPolytope(3, j)->getMeasure(), volume / 8, 1e-12);
+    }
+  }
+
+  TEST(Rodin_Geometry_UniformRefinement, P1Prolongation)
+  {
+    Mesh coarse = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 3, 3 });
+    UniformRefinement refinement(coarse);
+    Mesh fine = refinement.refine();
+
+    // Affine functions are interpolated exactly
+    const auto f = [](const auto& x) { return 2 * x(0) - 3 * x(1) + 1; };
+    Math::Vector<Real> uc(coarse.getVertexCount());
+    for (Index i = 0; i < coarse.getVertexCount(); i++)
+      uc(i) = f(coarse.getVertexCoordinates(i));
+    const Math::Vector<Real> uf = refinement.getP1Prolongation() * uc;
+    for (Index i = 0; i < fine.getVertexCount(); i++)
+      EXPECT_NEAR(uf(i), f(fine.getVertexCoordinates(i)), 1e-12);
+
+    const auto P = refinement.getP1Prolongation(2);
+    EXPECT_EQ(P.rows(), 2 * fine.getVertexCount());
+    EXPECT_EQ(P.cols(), 2 * coarse.getVertexCount());
+    EXPECT_EQ(refinement.getP1Restriction(2).rows(), P.cols());
+  }
+}
@@ -5,11 +5,13 @@
  *          https://www.boost.org/LICENSE_1_0.txt)
  */
 #include <fstream>
+#include <sstream>
 #include <gtest/gtest.h>
 
 #include <Rodin/IO.h>
 #include <Rodin/IO/MFEM.h>
 #include <Rodin/IO/MEDIT.h>
+#include <Rodin/IO/GMSH.h>
 
 #include <Rodin/Geometry.h>
 #include <Rodin/Configure.h>
@@ -55,6 +57,95 @@ namespace Rodin::Tests::Unit
     EXPECT_EQ(mesh.getAttribute(d, 1), 2);
   }
 
+  TEST(Rodin_IO_MeshLoader, SanityTest_MEDIT_2D_Square_MappedFile)
+  {
+    static constexpr const char* filename = "mmg/Square.medit.mesh";
+    boost::filesystem::path meshfile;
+    meshfile = boost::filesystem::path(RODIN_RESOURCES_DIR);
+    meshfile.append(filename);
+
+    Mesh mesh;
+    MeshLoader<FileFormat::MEDIT, Rodin::Context::Local> loader(mesh);
+    loader.load(meshfile);
+
+    EXPECT_EQ(mesh.getSpaceDimension(), 2);
+    EXPECT_EQ(mesh.getVertexCount(), 4);
+    EXPECT_EQ(mesh.getPolytopeCount(1), 5);
+    EXPECT_EQ(mesh.getCellCount(), 2);
+    EXPECT_EQ(mesh.getAttribute(0, 0), RODIN_DEFAULT_POLYTOPE_ATTRIBUTE);
+    EXPECT_EQ(mesh.getAttribute(1, 0), 1);
+    EXPECT_EQ(mesh.getAttribute(1, 1), 2);
+    EXPECT_EQ(mesh.getAttribute(2, 0), 1);
+    EXPECT_EQ(mesh.getAttribute(2, 1), 2);
+    EXPECT_EQ(loader.getCountMap().at(MEDIT::Keyword::Vertices), 4);
+  }
+
+  TEST(Rodin_IO_MeshLoader, MEDIT_3D_UniformGrid_MappedFile)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Tetrahedron, { 12, 12, 12 });
+    mesh.scale(1.0 / 11);
+    for (size_t i = 0; i < mesh.getCellCount(); i++)
+      mesh.setAttribute({ 3, i }, 1 + i % 3);
+
+    const auto meshfile =
+      boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.mesh");
+    mesh.save(meshfile, FileFormat::MEDIT);
+
+    Mesh streamed;
+    boost::filesystem::ifstream in(meshfile);
+    MeshLoader<FileFormat::MEDIT, Rodin::Context::Local>(streamed).load(in);
+
+    Mesh mapped;
+    mapped.load(meshfile, FileFormat::MEDIT);
+    boost::filesystem::remove(meshfile);
+
+    ASSERT_GT(mesh.getCellCount(), 4096);
+    EXPECT_EQ(mapped.getSpaceDimension(), 3);
+    EXPECT_EQ(mapped.getVertexCount(), streamed.getVertexCount());
+    EXPECT_EQ(mapped.getCellCount(), streamed.getCellCount());
+    EXPECT_LT((mapped.getVertices() - streamed.getVertices()).norm(), 1e-12);
+    for (size_t i = 0; i < mapped.getCellCount(); i++)
+    {
+      EXPECT_EQ(mapped.getAttribute(3, i), 1 + i % 3);
+      EXPECT_TRUE((mapped.getPolytope(3, i)->getVertices() == streamed.getPolytope(3, i)->getVertices()).all());
+    }
+  }
+
+  TEST(Rodin_IO_MeshLoader, MEDIT_3D_UniformGrid_Binary)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Tetrahedron, { 6, 6, 6 });
+    mesh.scale(1.0 / 5);
+    mesh.getConnectivity().compute(2, 3);
+    for (size_t i = 0; i < mesh.getCellCount(); i++)
+      mesh.setAttribute({ 3, i }, 1 + i % 3);
+
+    const auto meshfile =
+      boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.meshb");
+    mesh.save(meshfile, FileFormat::MEDIT);
+
+    Mesh mapped;
+    mapped.load(meshfile, FileFormat::MEDIT);
+
+    Mesh streamed;
+    boost::filesystem::ifstream in(meshfile, std::ios::binary);
+    MeshLoader<FileFormat::MEDIT, Rodin::Context::Local>(streamed).load(in);
+    boost::filesystem::remove(meshfile);
+
+    for (const Mesh<Rodin::Context::Local>* loaded : { &mapped, &streamed })
+    {
+      EXPECT_EQ(loaded->getSpaceDimension(), 3);
+      EXPECT_EQ(loaded->getVertexCount(), mesh.getVertexCount());
+      EXPECT_EQ(loaded->getCellCount(), mesh.getCellCount());
+      EXPECT_EQ(loaded->getPolytopeCount(2), mesh.getPolytopeCount(2));
+      EXPECT_EQ((loaded->getVertices() - mesh.getVertices()).norm(), 0);
+      for (size_t i = 0; i < mesh.getCellCount(); i++)
+      {
+        EXPECT_EQ(loaded->getAttribute(3, i), 1 + i % 3);
+        EXPECT_TRUE((loaded->getPolytope(3, i)->getVertices() == mesh.getPolytope(3, i)->getVertices()).all());
+      }
+    }
+  }
+
   TEST(Rodin_IO_MeshLoader, SanityTest_MFEM_2D_Square)
   {
     static constexpr const char* filename = "mfem/Square.mfem.mesh";
@@ -123,4 +214,168 @@ namespace Rodin::Tests::Unit
     for (size_t i = 0; i < ecount; i++)
       EXPECT_EQ(mesh.getGeometry(d, i), Polytope::Type::Quadrilateral);
   }
+
+  TEST(Rodin_IO_MeshLoader, MeshFormat_Headers)
+  {
+    std::stringstream mfem("MFEM mesh v1.0\n\ndimension\n2\n");
+    EXPECT_EQ(getMeshFormat(mfem), FileFormat::MFEM);
+
+    std::stringstream medit("\n  MeshVersionFormatted 2\nDimension 2\n");
+    EXPECT_EQ(getMeshFormat(medit), FileFormat::MEDIT);
+
+    std::stringstream gmsh("$MeshFormat\r\n4.1 0 8\r\n$EndMeshFormat\r\n");
+    EXPECT_EQ(getMeshFormat(gmsh), FileFormat::GMSH);
+    std::string line;
+    std::getline(gmsh, line);
+    EXPECT_EQ(line, "$MeshFormat\r");
+
+    std::stringstream unknown("solid cube\n");
+    EXPECT_FALSE(getMeshFormat(unknown).has_value());
+  }
+
+  TEST(Rodin_IO_MeshLoader, GMSH_2D_Square_ASCII)
+  {
+    std::stringstream in(
+        "$MeshFormat\n"
+        "4.1 0 8\n"
+        "$EndMeshFormat\n"
+        "$PhysicalNames\n"
+        "3\n"
+        "1 10 \"Bottom\"\n"
+        "1 11 \"Sides\"\n"
+        "2 3 \"Domain\"\n"
+        "$EndPhysicalNames\n"
+        "$Entities\n"
+        "4 4 1 0\n"
+        "1 0 0 0 1 7\n"
+        "2 1 0 0 0\n"
+        "3 1 1 0 0\n"
+        "4 0 1 0 0\n"
+        "1 0 0 0 1 0 0 1 10 2 1 -2\n"
+        "2 1 0 0 1 1 0 1 11 2 2 -3\n"
+        "3 0 1 0 1 1 0 1 11 2 3 -4\n"
+        "4 0 0 0 0 1 0 0 2 4 -1\n"
+        "1 0 0 0 1 1 0 1 3 4 1 2 3 4\n"
+        "$EndEntities\n"
+        "$Nodes\n"
+        "5 4 1 4\n"
+        "0 1 0 1\n1\n0 0 0\n"
+        "0 2 0 1\n2\n1 0 0\n"
+        "0 3 0 1\n3\n1 1 0\n"
+        "0 4 0 1\n4\n0 1 0\n"
+        "2 1 0 0\n"
+        "$EndNodes\n"
+        "$Elements\n"
+        "4 5 1 5\n"
+        "0 1 15 1\n1 1\n"
+        "1 1 1 1\n2 1 2\n"
+        "1 4 1 1\n3 4 1\n"
+        "2 1 2 2\n4 1 2 3\n5 1 3 4\n"
+        "$EndElements\n");
+
+    // The stream is rewound after the detection
+    EXPECT_EQ(getMeshFormat(in), FileFormat::GMSH);
+
+    Mesh mesh;
+    MeshLoader<FileFormat::GMSH, Rodin::Context::Local> loader(mesh);
+    loader.load(in);
+
+    EXPECT_EQ(mesh.getSpaceDimension(), 2);
+    EXPECT_EQ(mesh.getDimension(), 2);
+    EXPECT_EQ(loader.getPhysicalNames().size(), 3);
+    EXPECT_EQ(loader.getPhysicalNames().at({ 1, 10 }), "Bottom");
+    EXPECT_EQ(loader.getPhysicalNames().at({ 2, 3 }), "Domain");
+
+    size_t d = 0;
+    EXPECT_EQ(mesh.getVertexCount(), 4);
+    EXPECT_EQ(mesh.getAttribute(d, 0), 7);
+    EXPECT_EQ(mesh.getAttribute(d, 1), RODIN_DEFAULT_POLYTOPE_ATTRIBUTE);
+    EXPECT_EQ(mesh.getVertexCoordinates(2).x(), 1);
+    EXPECT_EQ(mesh.getVertexCoordinates(2).y(), 1);
+
+    // The entity tag is used when the entity has no physical tag
+    d = 1;
+    EXPECT_EQ(mesh.getPolytopeCount(d), 2);
+    EXPECT_EQ(mesh.getAttribute(d, 0), 10);
+    EXPECT_EQ(mesh.getAttribute(d, 1), 4);
+
+    d = 2;
+    EXPECT_EQ(mesh.getCellCount(), 2);
+    for (size_t i = 0; i < mesh.getCellCount(); i++)
+    {
+      EXPECT_EQ(mesh.getGeometry(d, i), Polytope::Type::Triangle);
+      EXPECT_EQ(mesh.getAttribute(d, i), 3);
+    }
+    EXPECT_TRUE((mesh.getPolytope(d, 1)->getVertices() == IndexArray{{ 0, 2, 3 }}).all());
+  }
+
+  TEST(Rodin_IO_MeshLoader, GMSH_3D_Quadrilateral_Binary)
+  {
+    std::string data;
+    const auto text = [&](const char* s) { data.append(s); };
+    const auto put =
+      [&](auto... vs)
+      {
+        (data.append(reinterpret_cast<const char*>(&vs), sizeof(vs)), ...);
+      };
+
+    text("$MeshFormat\n4.1 1 8\n");
+    put(int(1));
+    text("\n$EndMeshFormat\n");
+
+    text("$Entities\n");
+    put(size_t(0), size_t(1), size_t(1), size_t(0));
+    put(int(5), 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, size_t(1), int(2), size_t(0));
+    put(int(1), 0.0, 0.0, 0.0, 1.0, 1.0, 1.0, size_t(1), int(6), size_t(1), int(5));
+    text("\n$EndEntities\n");
+
+    // Sparse node tags, in two blocks, the first one being parametric
+    text("$Nodes\n");
+    put(size_t(2), size_t(4), size_t(10), size_t(40));
+    put(int(1), int(5), int(1), size_t(2));
+    put(size_t(10), size_t(20));
+    put(0.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 1.0);
+    put(int(2), int(1), int(0), size_t(2));
+    put(size_t(30), size_t(40));
+    put(1.0, 1.0, 0.5, 0.0, 1.0, 0.5);
+    text("\n$EndNodes\n");
+
+    text("$Elements\n");
+    put(size_t(2), size_t(2), size_t(1), size_t(2));
+    put(int(1), int(5), int(1), size_t(1));
+    put(size_t(1), size_t(10), size_t(20));
+    put(int(2), int(1), int(3), size_t(1));
+    put(size_t(2), size_t(10), size_t(20), size_t(30), size_t(40));
+    text("\n$EndElements\n");
+
+    {
+      std::stringstream in(data);
+      EXPECT_EQ(getMeshFormat(in), FileFormat::GMSH);
+    }
+
+    const auto meshfile =
+      boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.msh");
+    {
+      boost::filesystem::ofstream out(meshfile, std::ios::binary);
+      out.write(data.data(), data.size());
+    }
+
+    Mesh mesh;
+    mesh.load(meshfile, FileFormat::GMSH);
+    boost::filesystem::remove(meshfile);
+
+    EXPECT_EQ(mesh.getSpaceDimension(), 3);
+    EXPECT_EQ(mesh.getDimension(), 2);
+    EXPECT_EQ(mesh.getVertexCount(), 4);
+    EXPECT_EQ(mesh.getVertexCoordinates(1).x(), 1);
+    EXPECT_EQ(mesh.getVertexCoordinates(3).z(), 0.5);
+
+    EXPECT_EQ(mesh.getPolytopeCount(1), 1);
+    EXPECT_EQ(mesh.getAttribute(1, 0), 2);
+
+    EXPECT_EQ(mesh.getCellCount(), 1);
+    EXPECT_EQ(mesh.getGeometry(2, 0), Polytope::Type::Quadrilateral);
+    EXPECT_EQ(mesh.getAttribute(2, 0), 6);
+    EXPECT_TRUE((mesh.getPolytope(2, 0)->getVertices() == IndexArray{{ 0, 1, 3, 2 }}).all());
+  }
 }
@@ -0,0 +1,140 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <fstream>
+#include <sstream>
+#include <hdf5.h>
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+
+#include <Rodin/Variational.h>
+#include <Rodin/IO/XDMF.h>
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  namespace
+  {
+    std::vector<Real> readDataset(hid_t file, const std::string& path, std::vector<hsize_t>& dims)
+    {
+      const hid_t dataset = H5Dopen2(file, path.c_str(), H5P_DEFAULT);
+      EXPECT_GE(dataset, 0) << path;
+      if (dataset < 0)
+        return {};
+      const hid_t space = H5Dget_space(dataset);
+      dims.resize(H5Sget_simple_extent_ndims(space));
+      H5Sget_simple_extent_dims(space, dims.data(), nullptr);
+      std::vector<Real> res(H5Sget_simple_extent_npoints(space));
+      H5Dread(dataset, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, res.data());
+      H5Sclose(space);
+      H5Dclose(dataset);
+      return res;
+    }
+
+    size_t count(const std::string& str, const std::string& pattern)
+    {
+      size_t res = 0;
+      for (size_t pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1))
+        res++;
+      return res;
+    }
+  }
+
+  TEST(Rodin_IO_XDMF, TimeSeries_UniformGrid_16x16)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+
+    P1 vh(mesh);
+    GridFunction u(vh);
+
+    P1 wh(mesh, mesh.getSpaceDimension());
+    GridFunction w(wh);
+    w.project(VectorFunction{
+        [](const Point& p) { return p.x(); },
+        [](const Point& p) { return p.y(); } });
+
+    P0 ph(mesh);
+    GridFunction q(ph);
+
+    const auto base =
+      boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%");
+    const auto xdmffile = boost::filesystem::path(base).replace_extension(".xdmf");
+    const auto h5file = boost::filesystem::path(base).replace_extension(".h5");
+
+    {
+      IO::XDMF xdmf(xdmffile);
+      xdmf.setMesh(mesh).add("u", u).add("w", w).add("q", q);
+      for (size_t i = 0; i < 4; i++)
+      {
+        u.project([&](const Point& p) { return i * p.x() + p.y(); });
+        q = Real(i);
+        xdmf.write(0.5 * i);
+      }
+      xdmf.flush();
+      EXPECT_EQ(xdmf.getStepCount(), 4);
+      EXPECT_EQ(xdmf.getMeshCount(), 1);
+
+      // Moving the mesh writes it again
+      mesh.scale(2);
+      xdmf.write(2);
+      xdmf.write(2.5);
+      EXPECT_EQ(xdmf.getMeshCount(), 2);
+    }
+
+    std::stringstream index;
+    index << std::ifstream(xdmffile.c_str()).rdbuf();
+    EXPECT_EQ(count(index.str(), "<Time "), 6);
+    EXPECT_EQ(count(index.str(), "/Mesh/0/Geometry"), 4);
+    EXPECT_EQ(count(index.str(), "/Mesh/1/Geometry"), 2);
+    EXPECT_EQ(count(index.str(), "TopologyType=\"Triangle\""), 6);
+
+    const hid_t file = H5Fopen(h5file.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    ASSERT_GE(file, 0);
+    std::vector<hsize_t> dims;
+
+    const auto vertices = readDataset(file, "/Mesh/0/Geometry", dims);
+    EXPECT_EQ(dims, std::vector<hsize_t>({ mesh.getVertexCount(), 2 }));
+    const auto moved = readDataset(file, "/Mesh/1/Geometry", dims);
+    for (size_t i = 0; i < mesh.getVertexCount(); i++)
+    {
+      EXPECT_NEAR(moved[2 * i], mesh.getVertexCoordinates(i).x(), 1e-12);
+      EXPECT_NEAR(moved[2 * i + 1], mesh.getVertexCoordinates(i).y(), 1e-12);
+      EXPECT_NEAR(vertices[2 * i], mesh.getVertexCoordinates(i).x() / 2, 1e-12);
+    }
+
+    const auto topology = readDataset(file, "/Mesh/0/Topology", dims);
+    EXPECT_EQ(dims, std::vector<hsize_t>({ mesh.getCellCount(), 3 }));
+    for (size_t k = 0; k < 3; k++)
+      EXPECT_EQ(topology[3 * 7 + k], mesh.getConnectivity().getPolytope(2, 7)(k));
+
+    const auto values = readDataset(file, "/Step/3/u", dims);
+    EXPECT_EQ(dims, std::vector<hsize_t>({ mesh.getVertexCount(), 1 }));
+    for (size_t i = 0; i < mesh.getVertexCount(); i++)
+      EXPECT_NEAR(values[i], u.getData()(i), 1e-12);
+
+    const auto vectors = readDataset(file, "/Step/0/w", dims);
+    EXPECT_EQ(dims, std::vector<hsize_t>({ mesh.getVertexCount(), 3 }));
+    for (size_t i = 0; i < mesh.getVertexCount(); i++)
+    {
+      EXPECT_NEAR(vectors[3 * i], vertices[2 * i], 1e-12);
+      EXPECT_NEAR(vectors[3 * i + 1], vertices[2 * i + 1], 1e-12);
+      EXPECT_EQ(vectors[3 * i + 2], 0);
+    }
+
+    const auto cells = readDataset(file, "/Step/2/q", dims);
+    EXPECT_EQ(dims, std::vector<hsize_t>({ mesh.getCellCount(), 1 }));
+    for (const Real v : cells)
+      EXPECT_EQ(v, 2);
+
+    H5Fclose(file);
+    boost::filesystem::remove(xdmffile);
+    boost::filesystem::remove(h5file);
+  }
+}
@@ -0,0 +1,149 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Math/BlockSparseMatrix.h"
+#include "Rodin/Variational.h"
+#include "Rodin/Variational/LinearElasticity.h"
+#include "Rodin/Assembly/BlockSparseMatrix.h"
+#include "Rodin/Solver/CG.h"
+#include "Rodin/Solver/GMRES.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Math_BlockSparseMatrix, SparseMatrix_Conversion)
+  {
+    constexpr size_t n = 7;
+    for (size_t b = 1; b <= 4; b++)
+    {
+      std::vector<Eigen::Triplet<Real>> triplets;
+      for (size_t i = 0; i < n * b; i++)
+      {
+        triplets.emplace_back(i, i, 4.0 + i);
+        triplets.emplace_back(i, (i + n + 1) % (n * b), -1.0 / (i + 1));
+        triplets.emplace_back((3 * i) % (n * b), i, 0.5);
+      }
+      Math::SparseMatrix<Real> A(n * b, n * b);
+      A.setFromTriplets(triplets.begin(), triplets.end());
+
+      const Math::BlockSparseMatrix<Real> B(A, b);
+      EXPECT_EQ(B.rows(), A.rows());
+      EXPECT_EQ(B.cols(), A.cols());
+      EXPECT_EQ(B.getBlockSize(), b);
+      EXPECT_EQ(B.getBlockRows(), n);
+      EXPECT_LE(B.getNonZeroBlocks(), static_cast<size_t>(A.nonZeros()));
+      EXPECT_LT((Math::Matrix<Real>(B.toSparseMatrix()) - Math::Matrix<Real>(A)).norm(), 1e-12);
+      EXPECT_LT((B.diagonal() - Math::Vector<Real>(A.diagonal())).norm(), 1e-12);
+      EXPECT_EQ(B.coeff(1, 1), A.coeff(1, 1));
+
+      const Math::Vector<Real> x = Math::Vector<Real>::LinSpaced(n * b, -1, 2);
+      const Math::Vector<Real> y = B * x;
+      const Math::Vector<Real> z = A * x;
+      EXPECT_LT((y - z).norm(), 1e-12 * z.norm());
+
+      // Scaled and accumulated products of expressions and strided vectors
+      Math::Vector<Real> w = z;
+      w.noalias() += 0.5 * (B * (2 * x));
+      EXPECT_LT((w - 2 * z).norm(), 1e-12 * z.norm());
+
+      Math::Matrix<Real> X(n * b, 2);
+      X.col(0) = x;
+      X.col(1) = -x;
+      Math::Matrix<Real> Y = Math::Matrix<Real>::Zero(2, n * b);
+      Y.row(1).transpose().noalias() = B * X.col(1);
+      EXPECT_LT((Y.row(1).transpose() + z).norm(), 1e-12 * z.norm());
+    }
+  }
+
+  TEST(Rodin_Math_BlockSparseMatrix, BilinearForm_Elasticity_UniformGrid_16x16)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 vh(mesh, mesh.getSpaceDimension());
+    TrialFunction u(vh);
+    TestFunction v(vh);
+
+    const Real lambda = 0.5769, mu = 0.3846;
+
+    BilinearForm<decltype(vh), decltype(vh), Math::SparseMatrix<Real>> sparse(u, v);
+    sparse = LinearElasticityIntegral(u, v)(lambda, mu) + Integral(u, v);
+
+    BilinearForm<decltype(vh), decltype(vh), Math::BlockSparseMatrix<Real>> block(u, v);
+    block = LinearElasticityIntegral(u, v)(lambda, mu) + Integral(u, v);
+
+    BilinearForm<decltype(vh), decltype(vh), Math::BlockSparseMatrix<Real>> sequential(u, v);
+    sequential.setAssembly(Assembly::Sequential<Math::BlockSparseMatrix<Real>, decltype(sequential)>());
+    sequential = LinearElasticityIntegral(u, v)(lambda, mu) + Integral(u, v);
+
+    const auto& A = sparse.getOperator();
+    const auto& B = block.getOperator();
+    EXPECT_EQ(B.getBlockSize(), 2);
+    EXPECT_EQ(B.getBlockRows(), mesh.getVertexCount());
+    EXPECT_EQ(B.rows(), A.rows());
+
+    const Math::Matrix<Real> dense = A;
+    EXPECT_LT((Math::Matrix<Real>(B.toSparseMatrix()) - dense).norm(), 1e-10 * dense.norm());
+    EXPECT_LT(
+        (Math::Matrix<Real>(sequential.getOperator().toSparseMatrix()) - dense).norm(),
+        1e-10 * dense.norm());
+
+    const Math::Vector<Real> x = Math::Vector<Real>::LinSpaced(vh.getSize(), -1, 1);
+    const Math::Vector<Real> y = B * x;
+    const Math::Vector<Real> z = A * x;
+    EXPECT_LT((y - z).norm(), 1e-12 * z.norm());
+
+    const Math::Vector<Real> b = Math::Vector<Real>::Ones(vh.getSize());
+    Eigen::ConjugateGradient<Math::SparseMatrix<Real>, Eigen::Lower | Eigen::Upper> eigen;
+    eigen.setTolerance(1e-12);
+    const Math::Vector<Real> expected = eigen.compute(A).solve(b);
+
+    Math::Vector<Real> w;
+    Solver::CG cg(B);
+    cg.setTolerance(1e-12).solve(w, b);
+    EXPECT_TRUE(cg.success());
+    EXPECT_LT((w - expected).norm(), 1e-8 * expected.norm());
+
+    Math::Vector<Real> g;
+    Solver::GMRES gmres(B);
+    gmres.setTolerance(1e-12).setRestart(100).setMaxIterations(1000).solve(g, b);
+    EXPECT_TRUE(gmres.success());
+    EXPECT_LT((g - expected).norm(), 1e-8 * expected.norm());
+  }
+
+  TEST(Rodin_Math_BlockSparseMatrix, BilinearForm_Multithreaded_UniformGrid_6x6)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 6, 6 });
+    mesh.scale(1.0 / 5);
+
+    P1 vh(mesh, mesh.getSpaceDimension());
+    TrialFunction u(vh);
+    TestFunction v(vh);
+
+    using BlockBilinearForm = BilinearForm<decltype(vh), decltype(vh), Math::BlockSparseMatrix<Real>>;
+
+    BlockBilinearForm sequential(u, v);
+    sequential.setAssembly(Assembly::Sequential<Math::BlockSparseMatrix<Real>, BlockBilinearForm>());
+    sequential = LinearElasticityIntegral(u, v)(0.5769, 0.3846) + Integral(u, v);
+
+    BlockBilinearForm multithreaded(u, v);
+    multithreaded.setAssembly(Assembly::Multithreaded<Math::BlockSparseMatrix<Real>, BlockBilinearForm>(4));
+    multithreaded = LinearElasticityIntegral(u, v)(0.5769, 0.3846) + Integral(u, v);
+
+    const Math::Matrix<Real> a = sequential.getOperator().toSparseMatrix();
+    const Math::Matrix<Real> b = multithreaded.getOperator().toSparseMatrix();
+    ASSERT_EQ(a.rows(), b.rows());
+    ASSERT_EQ(a.cols(), b.cols());
+    EXPECT_GT(a.norm(), 0);
+    EXPECT_LT((a - b).norm(), 1e-12 * a.norm());
+  }
+}
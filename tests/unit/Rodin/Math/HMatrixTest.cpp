@@ -0,0 +1,185 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Math/HMatrix.h"
+#include "Rodin/Variational.h"
+#include "Rodin/Assembly/HMatrix.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  inline
+  Real K(const Point& x, const Point& y)
+  {
+    return 1.0 / (4 * M_PI * (x - y).norm());
+  }
+
+  TEST(Rodin_Math_HMatrix, ACA_PointCloud)
+  {
+    constexpr size_t n = 400;
+    Math::Matrix<Real> points(2, n);
+    for (size_t i = 0; i < n; i++)
+    {
+      const Real t = 2 * M_PI * i / n;
+      points(0, i) = std::cos(t) * (1 + 0.25 * std::sin(3 * t));
+      points(1, i) = std::sin(t) * (1 + 0.25 * std::sin(3 * t));
+    }
+
+    const auto kernel =
+      [&](Index i, Index j) -> Real
+      {
+        return std::log(1 + (points.col(i) - points.col(j)).squaredNorm());
+      };
+
+    Math::Matrix<Real> dense(n, n);
+    for (size_t i = 0; i < n; i++)
+      for (size_t j = 0; j < n; j++)
+        dense(i, j) = kernel(i, j);
+
+    Math::ClusterTree tree(points, points, 16);
+    EXPECT_EQ(tree.size(), n);
+    std::vector<Index> indices = tree.getIndices();
+    std::sort(indices.begin(), indices.end());
+    for (size_t i = 0; i < n; i++)
+      EXPECT_EQ(indices[i], i);
+
+    Math::HMatrix<Real> hmat(tree, tree, 2.0);
+    hmat.assemble(
+        [&](const Index* rows, size_t m, const Index* cols, size_t k, Math::Matrix<Real>& res)
+        {
+          res.resize(m, k);
+          for (size_t p = 0; p < m; p++)
+            for (size_t q = 0; q < k; q++)
+              res(p, q) = kernel(rows[p], cols[q]);
+        }, 1e-8);
+
+    EXPECT_LT(hmat.getStorageSize(), n * n);
+    EXPECT_LT((hmat.toDense() - dense).norm(), 1e-6 * dense.norm());
+
+    const Math::Vector<Real> x = Math::Vector<Real>::LinSpaced(n, -1, 1);
+    const Math::Vector<Real> y = hmat * x;
+    const Math::Vector<Real> z = dense * x;
+    EXPECT_LT((y - z).norm(), 1e-6 * z.norm());
+  }
+
+  TEST(Rodin_Math_HMatrix, ACA_PointCloud_Complex)
+  {
+    constexpr size_t n = 400;
+    Math::Matrix<Real> points(2, n);
+    for (size_t i = 0; i < n; i++)
+    {
+      const Real t = 2 * M_PI * i / n;
+      points(0, i) = std::cos(t) * (1 + 0.25 * std::sin(3 * t));
+      points(1, i) = std::sin(t) * (1 + 0.25 * std::sin(3 * t));
+    }
+
+    const auto kernel =
+      [&](Index i, Index j) -> Complex
+      {
+        const Real r2 = (points.col(i) - points.col(j)).squaredNorm();
+        return std::exp(Complex(0, 2) * std::sqrt(r2)) * std::log(1 + r2);
+      };
+
+    Math::Matrix<Complex> dense(n, n);
+    for (size_t i = 0; i < n; i++)
+      for (size_t j = 0; j < n; j++)
+        dense(i, j) = kernel(i, j);
+
+    Math::ClusterTree tree(points, points, 16);
+    Math::HMatrix<Complex> hmat(tree, tree, 2.0);
+    hmat.assemble(
+        [&](const Index* rows, size_t m, const Index* cols, size_t k, Math::Matrix<Complex>& res)
+        {
+          res.resize(m, k);
+          for (size_t p = 0; p < m; p++)
+            for (size_t q = 0; q < k; q++)
+              res(p, q) = kernel(rows[p], cols[q]);
+        }, 1e-8);
+
+    EXPECT_LT(hmat.getStorageSize(), n * n);
+    EXPECT_LT((hmat.toDense() - dense).norm(), 1e-6 * dense.norm());
+  }
+
+  TEST(Rodin_Math_HMatrix, BilinearForm_Potential_UniformGrid_24x24)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 24, 24 });
+    mesh.scale(1.0 / 23);
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    BilinearForm<decltype(fes), decltype(fes), Math::Matrix<Real>> dense(u, v);
+    dense = Integral(Potential(K, u), v);
+    dense.assemble();
+
+    BilinearForm<decltype(fes), decltype(fes), Math::HMatrix<Real>> hmat(u, v);
+    hmat.setAssembly(
+        Assembly::Sequential<Math::HMatrix<Real>, decltype(hmat)>()
+        .setLeafSize(8).setTolerance(1e-8));
+    hmat = Integral(Potential(K, u), v);
+
+    const auto& op = hmat.getOperator();
+    EXPECT_EQ(op.rows(), fes.getSize());
+    EXPECT_EQ(op.cols(), fes.getSize());
+    EXPECT_LT(op.getStorageSize(), fes.getSize() * fes.getSize());
+
+    const auto& a = dense.getOperator();
+    EXPECT_LT((op.toDense() - a).norm(), 1e-6 * a.norm());
+
+    const Math::Vector<Real> x = Math::Vector<Real>::LinSpaced(fes.getSize(), -1, 1);
+    Math::Vector<Real> y;
+    op.getLinearOperator().apply(x, y);
+    const Math::Vector<Real> z = a * x;
+    EXPECT_LT((y - z).norm(), 1e-6 * z.norm());
+  }
+
+  TEST(Rodin_Math_HMatrix, BilinearForm_Potential_Multithreaded_UniformGrid_16x16)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    BilinearForm<decltype(fes), decltype(fes), Math::HMatrix<Real>> seq(u, v);
+    seq.setAssembly(
+        Assembly::Sequential<Math::HMatrix<Real>, decltype(seq)>()
+        .setLeafSize(8).setTolerance(1e-8));
+    seq = Integral(Potential(K, u), v);
+
+    BilinearForm<decltype(fes), decltype(fes), Math::HMatrix<Real>> mt(u, v);
+    mt.setAssembly(
+        Assembly::Multithreaded<Math::HMatrix<Real>, decltype(mt)>(4)
+        .setLeafSize(8).setTolerance(1e-8));
+    mt = Integral(Potential(K, u), v);
+
+    const auto& a = seq.getOperator();
+    const auto& b = mt.getOperator();
+    EXPECT_EQ(b.rows(), a.rows());
+    EXPECT_EQ(b.cols(), a.cols());
+    EXPECT_EQ(b.getStorageSize(), a.getStorageSize());
+
+    // The blocks are the same and are approximated independently
+    const Math::Matrix<Real> da = a.toDense();
+    const Math::Matrix<Real> db = b.toDense();
+    for (Eigen::Index i = 0; i < da.rows(); i++)
+    {
+      for (Eigen::Index j = 0; j < da.cols(); j++)
+        EXPECT_NEAR(db(i, j), da(i, j), 1e-12);
+    }
+
+    const Math::Vector<Real> x = Math::Vector<Real>::LinSpaced(fes.getSize(), -1, 1);
+    Math::Vector<Real> y, z;
+    a.getLinearOperator().apply(x, y);
+    b.getLinearOperator().apply(x, z);
+    EXPECT_LT((y - z).norm(), 1e-12 * y.norm());
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Solver/CG.h"
+#include "Rodin/Solver/AMG.h"
+#include "Rodin/Solver/SparseLU.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Solver_AMG, Poisson_UniformGrid_64x64)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 64, 64 });
+    mesh.scale(1.0 / 63);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    RealFunction f = 1;
+
+    Problem poisson(u, v);
+    poisson = Integral(Grad(u), Grad(v))
+            - Integral(f, v)
+            + DirichletBC(u, RealFunction(0));
+
+    Solver::SparseLU(poisson).solve();
+    const Math::Vector<Real> expected = u.getSolution().getWeights().value();
+
+    Solver::CG jacobi(poisson);
+    jacobi.setTolerance(1e-10).solve();
+    EXPECT_TRUE(jacobi.success());
+
+    Solver::AMG amg;
+    Solver::CG cg(poisson);
+    cg.setPreconditioner(amg).setTolerance(1e-10).solve();
+    EXPECT_TRUE(cg.success());
+    EXPECT_GT(amg.getLevelCount(), 1);
+    EXPECT_LT(amg.getOperator(amg.getLevelCount() - 1).rows(), amg.getOperator(0).rows());
+    EXPECT_LT(cg.getIterations(), 30);
+    EXPECT_LT(4 * cg.getIterations(), jacobi.getIterations());
+    EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-6 * expected.norm());
+
+    // Reuse of the aggregates
+    const size_t levels = amg.getLevelCount();
+    cg.solve();
+    EXPECT_TRUE(cg.success());
+    EXPECT_EQ(amg.getLevelCount(), levels);
+    EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-6 * expected.norm());
+  }
+
+  TEST(Rodin_Solver_AMG, Elasticity_UniformGrid_48x48)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 48, 48 });
+    mesh.scale(1.0 / 47);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh, 2);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    VectorFunction f{0, -1};
+
+    Problem elasticity(u, v);
+    elasticity = LinearElasticityIntegral(u, v)(0.5769, 0.3846)
+               - Integral(f, v)
+               + DirichletBC(u, VectorFunction{0, 0});
+
+    Solver::SparseLU(elasticity).solve();
+    const Math::Vector<Real> expected = u.getSolution().getWeights().value();
+
+    Solver::CG jacobi(elasticity);
+    jacobi.setTolerance(1e-10).solve();
+    EXPECT_TRUE(jacobi.success());
+
+    Solver::AMG amg;
+    amg.setBlockSize(2);
+    Solver::CG cg(elasticity);
+    cg.setPreconditioner(amg).setTolerance(1e-10).solve();
+    EXPECT_TRUE(cg.success());
+    EXPECT_GT(amg.getLevelCount(), 1);
+    EXPECT_LT(4 * cg.getIterations(), jacobi.getIterations());
+    EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-6 * expected.norm());
+  }
+}
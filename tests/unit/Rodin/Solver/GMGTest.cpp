@@ -0,0 +1,120 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Geometry/UniformRefinement.h"
+#include "Rodin/Solver/CG.h"
+#include "Rodin/Solver/GMG.h"
+#include "Rodin/Solver/SparseLU.h"
+#include "Rodin/Models/Hilbert/H1a.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Solver_GMG, Poisson_UniformRefinement)
+  {
+    std::vector<Mesh<Context::Local>> meshes;
+    meshes.push_back(LocalMesh::UniformGrid(Polytope::Type::Triangle, { 5, 5 }));
+    meshes.back().scale(1.0 / 4);
+
+    Solver::GMG gmg;
+    std::vector<size_t> iterations;
+    for (size_t k = 0; k < 4; k++)
+    {
+      UniformRefinement refinement(meshes.back());
+      Mesh fine = refinement.refine();
+      gmg.addLevel(refinement.getP1Prolongation());
+      meshes.push_back(std::move(fine));
+
+      auto& mesh = meshes.back();
+      mesh.getConnectivity().compute(1, 2);
+
+      P1 fes(mesh);
+      TrialFunction u(fes);
+      TestFunction v(fes);
+
+      RealFunction f = 1;
+
+      Problem poisson(u, v);
+      poisson = Integral(Grad(u), Grad(v))
+              - Integral(f, v)
+              + DirichletBC(u, RealFunction(0));
+
+      Solver::SparseLU(poisson).solve();
+      const Math::Vector<Real> expected = u.getSolution().getWeights().value();
+
+      Solver::CG cg(poisson);
+      cg.setPreconditioner(gmg).setTolerance(1e-10).solve();
+      EXPECT_TRUE(cg.success());
+      EXPECT_EQ(gmg.getLevelCount(), k + 2);
+      EXPECT_EQ(gmg.getOperator(k + 1).rows(), meshes.front().getVertexCount());
+      EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-6 * expected.norm());
+      iterations.push_back(cg.getIterations());
+    }
+
+    // The convergence does not depend on the mesh size
+    EXPECT_LT(iterations.back(), 20);
+    EXPECT_LE(iterations.back(), iterations.front() + 3);
+  }
+
+  TEST(Rodin_Solver_GMG, H1a_UniformRefinement)
+  {
+    Mesh coarse = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 9, 9 });
+    coarse.scale(1.0 / 8);
+    UniformRefinement r1(coarse);
+    Mesh mid = r1.refine();
+    UniformRefinement r2(mid);
+    Mesh mesh = r2.refine();
+
+    Solver::GMG gmg;
+    gmg.addLevel(r1.getP1Prolongation()).addLevel(r2.getP1Prolongation());
+
+    P1 fes(mesh);
+    RealFunction f = 1;
+
+    Models::Hilbert::H1a hilbert(fes);
+    hilbert.setAlpha(0.1);
+    const auto& v = hilbert.getTestFunction();
+    const auto expected = hilbert(Integral(f, v));
+    hilbert.setPreconditioner(gmg);
+    const auto actual = hilbert(Integral(f, v));
+    EXPECT_EQ(gmg.getLevelCount(), 3);
+    EXPECT_LT(
+        (actual.getWeights().value() - expected.getWeights().value()).norm(),
+        1e-6 * expected.getWeights().value().norm());
+  }
+
+  TEST(Rodin_Solver_GMG, H1a_DirichletBC)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 9, 9 });
+    mesh.scale(1.0 / 8);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    RealFunction f = 0;
+
+    Models::Hilbert::H1a hilbert(fes);
+    hilbert.setAlpha(0.5);
+    hilbert += DirichletBC(hilbert.getTrialFunction(), RealFunction(1));
+    const auto& v = hilbert.getTestFunction();
+    const auto solution = hilbert(Integral(f, v));
+    const auto& weights = solution.getWeights().value();
+
+    // Without the boundary condition the solution would vanish
+    for (auto it = mesh.getBoundary(); !it.end(); ++it)
+    {
+      for (const Index i : it->getVertices())
+        EXPECT_NEAR(weights.coeff(i), 1.0, RODIN_FUZZY_CONSTANT);
+    }
+    EXPECT_GT(weights.minCoeff(), 0.0);
+    EXPECT_LT(weights.minCoeff(), 1.0);
+  }
+}
@@ -0,0 +1,77 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Solver/CG.h"
+#include "Rodin/Solver/IC0.h"
+#include "Rodin/Solver/SparseLU.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Solver_IC0, Tridiagonal)
+  {
+    // The Cholesky factor of a tridiagonal matrix has no fill-in
+    const size_t n = 40;
+    std::vector<Eigen::Triplet<Real>> triplets;
+    for (size_t i = 0; i < n; i++)
+    {
+      triplets.emplace_back(i, i, 2.0);
+      if (i > 0)
+      {
+        triplets.emplace_back(i, i - 1, -1.0);
+        triplets.emplace_back(i - 1, i, -1.0);
+      }
+    }
+    Math::SparseMatrix<Real> A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    const Math::Vector<Real> b = Math::Vector<Real>::Ones(n);
+
+    Solver::IC0 ic;
+    ic.setup(A);
+    Math::Vector<Real> x;
+    ic.apply(b, x);
+    EXPECT_EQ(ic.getShift(), 0);
+    EXPECT_LT((A * x - b).norm(), 1e-10 * b.norm());
+  }
+
+  TEST(Rodin_Solver_IC0, Poisson_UniformGrid_64x64)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 64, 64 });
+    mesh.scale(1.0 / 63);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    RealFunction f = 1;
+
+    Problem poisson(u, v);
+    poisson = Integral(Grad(u), Grad(v))
+            - Integral(f, v)
+            + DirichletBC(u, RealFunction(0));
+
+    Solver::SparseLU(poisson).solve();
+    const Math::Vector<Real> expected = u.getSolution().getWeights().value();
+
+    Solver::CG jacobi(poisson);
+    jacobi.setTolerance(1e-10).solve();
+    EXPECT_TRUE(jacobi.success());
+
+    Solver::IC0 ic;
+    Solver::CG cg(poisson);
+    cg.setPreconditioner(ic).setTolerance(1e-10).solve();
+    EXPECT_TRUE(cg.success());
+    EXPECT_LT(2 * cg.getIterations(), jacobi.getIterations());
+    EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-6 * expected.norm());
+  }
+}
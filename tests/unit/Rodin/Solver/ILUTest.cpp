@@ -0,0 +1,116 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Solver/ILU.h"
+#include "Rodin/Solver/GMRES.h"
+#include "Rodin/Solver/BiCGSTAB.h"
+#include "Rodin/Solver/SparseLU.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Solver_ILU, ExactFactorization)
+  {
+    const size_t n = 50;
+    std::vector<Eigen::Triplet<Real>> triplets;
+    for (size_t i = 0; i < n; i++)
+    {
+      triplets.emplace_back(i, i, 4.0);
+      if (i > 0)
+        triplets.emplace_back(i, i - 1, -1.0);
+      if (i + 1 < n)
+        triplets.emplace_back(i, i + 1, -2.0);
+      if (i + 7 < n)
+        triplets.emplace_back(i + 7, i, -0.5);
+    }
+    Math::SparseMatrix<Real> A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    const Math::Vector<Real> b = Math::Vector<Real>::LinSpaced(n, -1, 1);
+
+    // Without dropping, the incomplete factorization is the LU factorization
+    Solver::ILU ilu;
+    ilu.setFillLevel(n).setup(A);
+    Math::Vector<Real> x;
+    ilu.apply(b, x);
+    EXPECT_LT((A * x - b).norm(), 1e-12 * b.norm());
+
+    // ILU(0) keeps the pattern of A
+    ilu.setFillLevel(0).setup(A);
+    EXPECT_EQ(ilu.getNonZeros(), A.nonZeros());
+    ilu.setFillLevel(1).setup(A);
+    EXPECT_GT(ilu.getNonZeros(), A.nonZeros());
+  }
+
+  TEST(Rodin_Solver_ILU, WideLevels)
+  {
+    // Block diagonal matrix of 2x2 blocks, whose triangular factors have
+    // levels of n / 2 independent rows
+    const size_t n = 20000;
+    std::vector<Eigen::Triplet<Real>> triplets;
+    for (size_t i = 0; i < n; i += 2)
+    {
+      triplets.emplace_back(i, i, 3.0);
+      triplets.emplace_back(i, i + 1, 1.0);
+      triplets.emplace_back(i + 1, i, -1.0);
+      triplets.emplace_back(i + 1, i + 1, 2.0);
+    }
+    Math::SparseMatrix<Real> A(n, n);
+    A.setFromTriplets(triplets.begin(), triplets.end());
+    const Math::Vector<Real> b = Math::Vector<Real>::Random(n);
+
+    Solver::ILU ilu;
+    ilu.setup(A);
+    Math::Vector<Real> x;
+    ilu.apply(b, x);
+    EXPECT_LT((A * x - b).norm(), 1e-12 * b.norm());
+  }
+
+  TEST(Rodin_Solver_ILU, AdvectionDiffusion_UniformGrid_64x64)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 64, 64 });
+    mesh.scale(1.0 / 63);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    VectorFunction beta{1, 0.5};
+    RealFunction f = 1;
+
+    Problem pb(u, v);
+    pb = Integral(0.01 * Grad(u), Grad(v))
+       + Integral(Dot(beta, Grad(u)), v)
+       - Integral(f, v)
+       + DirichletBC(u, RealFunction(0));
+
+    Solver::SparseLU(pb).solve();
+    const Math::Vector<Real> expected = u.getSolution().getWeights().value();
+
+    Solver::GMRES jacobi(pb);
+    jacobi.setTolerance(1e-10).solve();
+    EXPECT_TRUE(jacobi.success());
+
+    Solver::ILU ilu;
+    Solver::GMRES gmres(pb);
+    gmres.setPreconditioner(ilu).setTolerance(1e-10).solve();
+    EXPECT_TRUE(gmres.success());
+    EXPECT_LT(2 * gmres.getIterations(), jacobi.getIterations());
+    EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-6 * expected.norm());
+
+    ilu.setFillLevel(2);
+    Solver::BiCGSTAB bicgstab(pb);
+    bicgstab.setPreconditioner(ilu).setTolerance(1e-10).solve();
+    EXPECT_TRUE(bicgstab.success());
+    EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-6 * expected.norm());
+  }
+}
@@ -0,0 +1,154 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Variational/LinearElasticity.h"
+#include "Rodin/Math/BlockSparseMatrix.h"
+#include "Rodin/Assembly/BlockSparseMatrix.h"
+#include "Rodin/Solver/CG.h"
+#include "Rodin/Solver/GMRES.h"
+#include "Rodin/Solver/BiCGSTAB.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  namespace
+  {
+    /**
+     * Checks that the solver ignores the value of x unless warm starting is
+     * enabled, and that it converges when warm started from the solution.
+     */
+    template <class Solver>
+    void checkMatrixFreeSolver(Solver& solver, const Math::Vector<Real>& b, const Math::Vector<Real>& expected)
+    {
+      Math::Vector<Real> x = Math::Vector<Real>::Constant(b.size(), 1e6);
+      solver.setTolerance(1e-12).setMaxIterations(1000).solve(x, b);
+      EXPECT_TRUE(solver.success());
+      const size_t iterations = solver.getIterations();
+      EXPECT_GT(iterations, 0);
+      EXPECT_LT((x - expected).norm(), 1e-8 * expected.norm());
+
+      Math::Vector<Real> y = expected;
+      solver.solve(y, b);
+      EXPECT_EQ(solver.getIterations(), iterations);
+      EXPECT_LT((y - x).norm(), 1e-10 * x.norm());
+
+      solver.setWarmStart().solve(x, b);
+      EXPECT_TRUE(solver.success());
+      EXPECT_LT((x - expected).norm(), 1e-8 * expected.norm());
+    }
+
+    /**
+     * Diagonal preconditioner which counts its setups.
+     */
+    class CountingJacobi final
+      : public Solver::PreconditionerBase<Math::BlockSparseMatrix<Real>, Math::Vector<Real>>
+    {
+      public:
+        CountingJacobi()
+          : m_setups(0)
+        {}
+
+        void setup(const Math::BlockSparseMatrix<Real>& A) override
+        {
+          m_invdiag = A.diagonal().cwiseInverse();
+          m_setups++;
+        }
+
+        void apply(const Math::Vector<Real>& r, Math::Vector<Real>& z) const override
+        {
+          z = m_invdiag.cwiseProduct(r);
+        }
+
+        size_t getSetups() const
+        {
+          return m_setups;
+        }
+
+      private:
+        Math::Vector<Real> m_invdiag;
+        size_t m_setups;
+    };
+  }
+
+  TEST(Rodin_Solver_MatrixFree, LinearOperator_UniformGrid_16x16)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    BilinearForm bf(u, v);
+    bf = Integral(Grad(u), Grad(v)) + Integral(u, v);
+
+    const Math::Vector<Real> b = Math::Vector<Real>::LinSpaced(fes.getSize(), -1, 1);
+    Eigen::ConjugateGradient<Math::SparseMatrix<Real>, Eigen::Lower | Eigen::Upper> eigen;
+    eigen.setTolerance(1e-12);
+    const Math::Vector<Real> expected = eigen.compute(bf.getOperator()).solve(b);
+
+    const auto op = bf.getLinearOperator();
+
+    Solver::CG cg(op);
+    checkMatrixFreeSolver(cg, b, expected);
+    EXPECT_EQ(cg.getIterations(), 0);
+
+    Solver::GMRES gmres(op);
+    gmres.setRestart(100);
+    checkMatrixFreeSolver(gmres, b, expected);
+
+    Solver::BiCGSTAB bicgstab(op);
+    checkMatrixFreeSolver(bicgstab, b, expected);
+    EXPECT_EQ(bicgstab.getIterations(), 0);
+  }
+
+  TEST(Rodin_Solver_MatrixFree, BlockSparseMatrix_UniformGrid_8x8)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 8, 8 });
+    mesh.scale(1.0 / 7);
+    P1 vh(mesh, mesh.getSpaceDimension());
+    TrialFunction u(vh);
+    TestFunction v(vh);
+
+    BilinearForm<decltype(vh), decltype(vh), Math::BlockSparseMatrix<Real>> bf(u, v);
+    bf = LinearElasticityIntegral(u, v)(0.5769, 0.3846) + Integral(u, v);
+    const auto& op = bf.getOperator();
+
+    const Math::Vector<Real> b = Math::Vector<Real>::LinSpaced(vh.getSize(), -1, 1);
+    const Math::SparseMatrix<Real> A = op.toSparseMatrix();
+    Eigen::ConjugateGradient<Math::SparseMatrix<Real>, Eigen::Lower | Eigen::Upper> eigen;
+    eigen.setTolerance(1e-12);
+    const Math::Vector<Real> expected = eigen.compute(A).solve(b);
+
+    Solver::CG cg(op);
+    checkMatrixFreeSolver(cg, b, expected);
+    EXPECT_EQ(cg.getIterations(), 0);
+
+    Solver::GMRES gmres(op);
+    gmres.setRestart(100);
+    checkMatrixFreeSolver(gmres, b, expected);
+
+    Solver::BiCGSTAB bicgstab(op);
+    checkMatrixFreeSolver(bicgstab, b, expected);
+    EXPECT_EQ(bicgstab.getIterations(), 0);
+
+    // The preconditioner is set up at each solve
+    CountingJacobi pc;
+    Math::Vector<Real> x;
+    Solver::CG pcg(op);
+    pcg.setPreconditioner(pc).setTolerance(1e-12).setMaxIterations(1000);
+    pcg.solve(x, b);
+    pcg.solve(x, b);
+    EXPECT_TRUE(pcg.success());
+    EXPECT_EQ(pc.getSetups(), 2);
+    EXPECT_LT((x - expected).norm(), 1e-8 * expected.norm());
+  }
+}
@@ -0,0 +1,87 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Solver/CG.h"
+#include "Rodin/Solver/SparseLU.h"
+#include "Rodin/Solver/SimplicialLDLT.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Solver_WarmStart, CG_Poisson)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 32, 32 });
+    mesh.scale(1.0 / 31);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    RealFunction f = 1;
+
+    Problem poisson(u, v);
+    poisson = Integral(Grad(u), Grad(v))
+            - Integral(f, v)
+            + DirichletBC(u, RealFunction(0));
+
+    Solver::CG cold(poisson);
+    cold.setTolerance(1e-10).solve();
+    EXPECT_TRUE(cold.success());
+    const size_t iterations = cold.getIterations();
+    EXPECT_GT(iterations, 0);
+    cold.solve();
+    EXPECT_EQ(cold.getIterations(), iterations);
+
+    Solver::CG warm(poisson);
+    warm.setWarmStart().setTolerance(1e-10).solve();
+    EXPECT_TRUE(warm.success());
+    EXPECT_EQ(warm.getIterations(), 0);
+  }
+
+  TEST(Rodin_Solver_WarmStart, Direct_Refactorization)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    Real k = 1;
+    RealFunction coefficient = [&](const Point&) { return k; };
+    RealFunction f = 1;
+
+    Problem pb(u, v);
+    pb = Integral(coefficient * Grad(u), Grad(v))
+       + Integral(u, v)
+       - Integral(f, v)
+       + DirichletBC(u, RealFunction(0));
+
+    Solver::SparseLU lu(pb);
+    Solver::SimplicialLDLT ldlt(pb);
+    for (k = 1; k < 8; k *= 2)
+    {
+      pb.assemble();
+
+      Solver::SparseLU(pb).solve();
+      const Math::Vector<Real> expected = u.getSolution().getWeights().value();
+
+      lu.solve();
+      EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-10 * expected.norm());
+
+      ldlt.solve();
+      EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(), 1e-10 * expected.norm());
+    }
+  }
+}
@@ -0,0 +1,169 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Variational/LinearElasticity.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  namespace
+  {
+    inline
+    Real K(const Point& x, const Point& y)
+    {
+      return 1.0 / (4 * M_PI * (x - y).norm());
+    }
+
+    /**
+     * Checks that the element matrix of the integrator agrees with its
+     * entry-wise integration on every cell of the mesh.
+     */
+    template <class FES>
+    void checkElementMatrix(
+        LocalBilinearFormIntegratorBase<Real>& bfi, const FES& trialfes, const FES& testfes)
+    {
+      const auto& mesh = trialfes.getMesh();
+      Math::Matrix<Real> mat;
+      for (auto it = mesh.getCell(); !it.end(); ++it)
+      {
+        const Polytope& polytope = *it;
+        const size_t d = polytope.getDimension();
+        const Index i = polytope.getIndex();
+        bfi.setPolytope(polytope);
+        mat.resize(
+            testfes.getFiniteElement(d, i).getCount(), trialfes.getFiniteElement(d, i).getCount());
+        bfi.getElementMatrix(mat);
+        for (size_t l = 0; l < static_cast<size_t>(mat.rows()); l++)
+        {
+          for (size_t m = 0; m < static_cast<size_t>(mat.cols()); m++)
+          {
+            const Real expected = bfi.integrate(m, l);
+            EXPECT_NEAR(mat(l, m), expected, 1e-12 * std::max(Real(1), std::abs(expected)));
+          }
+        }
+      }
+    }
+
+    /**
+     * Checks that the element matrix of the integrator agrees with its
+     * entry-wise integration on every pair of cells of the mesh.
+     */
+    template <class FES>
+    void checkElementMatrix(
+        GlobalBilinearFormIntegratorBase<Real>& bfi, const FES& trialfes, const FES& testfes)
+    {
+      const auto& mesh = trialfes.getMesh();
+      Math::Matrix<Real> mat;
+      for (auto teIt = mesh.getCell(); !teIt.end(); ++teIt)
+      {
+        const Polytope& tep = *teIt;
+        for (auto trIt = mesh.getCell(); !trIt.end(); ++trIt)
+        {
+          const Polytope& trp = *trIt;
+          bfi.setPolytope(trp, tep);
+          mat.resize(
+              testfes.getFiniteElement(tep.getDimension(), tep.getIndex()).getCount(),
+              trialfes.getFiniteElement(trp.getDimension(), trp.getIndex()).getCount());
+          bfi.getElementMatrix(mat);
+          for (size_t l = 0; l < static_cast<size_t>(mat.rows()); l++)
+          {
+            for (size_t m = 0; m < static_cast<size_t>(mat.cols()); m++)
+            {
+              const Real expected = bfi.integrate(m, l);
+              EXPECT_NEAR(mat(l, m), expected, 1e-12 * std::max(Real(1), std::abs(expected)));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Rodin_Variational_BilinearFormIntegrator, ElementMatrix_Scalar_P1)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 5, 5 });
+    mesh.scale(1.0 / 4);
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+    RealFunction f = [](const Point& p) { return 1 + p.x() * p.y(); };
+
+    {
+      auto bfi = Integral(u, v);
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = Integral(f * u, v);
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = Integral(Grad(u), Grad(v));
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = Integral(f * Grad(u), Grad(v));
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = 2.5 * Integral(Grad(u), Grad(v));
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = -Integral(f * u, v);
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = Integral(Potential(K, u), v);
+      checkElementMatrix(bfi, fes, fes);
+    }
+  }
+
+  TEST(Rodin_Variational_BilinearFormIntegrator, ElementMatrix_Vector_P1)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 5, 5 });
+    mesh.scale(1.0 / 4);
+    P1 fes(mesh, mesh.getSpaceDimension());
+    TrialFunction u(fes);
+    TestFunction v(fes);
+    RealFunction f = [](const Point& p) { return 1 + p.x() * p.y(); };
+
+    {
+      auto bfi = Integral(u, v);
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = Integral(Jacobian(u), Jacobian(v));
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = Integral(f * Jacobian(u), Jacobian(v));
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = LinearElasticityIntegral(u, v)(0.5769, 0.3846);
+      checkElementMatrix(bfi, fes, fes);
+    }
+
+    {
+      auto bfi = -LinearElasticityIntegral(u, v)(0.5769, 0.3846);
+      checkElementMatrix(bfi, fes, fes);
+    }
+  }
+}
@@ -0,0 +1,75 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Solver/LDLT.h"
+#include "Rodin/Solver/LLT.h"
+#include "Rodin/Solver/PartialPivLU.h"
+#include "Rodin/Variational.h"
+#include "Rodin/Assembly/Blocked.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  inline
+  Real K(const Point& x, const Point& y)
+  {
+    return 1.0 / (4 * M_PI * (x - y).norm());
+  }
+
+  TEST(Rodin_Variational_DenseProblem, BlockedAssembly_UniformGrid_12x12)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 12, 12 });
+    mesh.scale(1.0 / 11);
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    BilinearForm<decltype(fes), decltype(fes), Math::Matrix<Real>> sequential(u, v);
+    sequential.setAssembly(Assembly::Sequential<Math::Matrix<Real>, decltype(sequential)>());
+    sequential.add(Integral(u, v)).add(Integral(Potential(K, u), v)).assemble();
+
+    BilinearForm<decltype(fes), decltype(fes), Math::Matrix<Real>> blocked(u, v);
+    blocked.setAssembly(
+        Assembly::Blocked<Math::Matrix<Real>, decltype(blocked)>(2).setBlockSize(7));
+    blocked.add(Integral(u, v)).add(Integral(Potential(K, u), v)).assemble();
+
+    const auto& a = sequential.getOperator();
+    const auto& b = blocked.getOperator();
+    ASSERT_EQ(a.rows(), b.rows());
+    ASSERT_EQ(a.cols(), b.cols());
+    EXPECT_LT((a - b).norm(), RODIN_FUZZY_CONSTANT * a.norm());
+  }
+
+  TEST(Rodin_Variational_DenseProblem, Solve_UniformGrid_8x8)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 8, 8 });
+    mesh.scale(1.0 / 7);
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    RealFunction f = [](const Point& p) { return 1 + p.x() * p.y(); };
+
+    DenseProblem problem(u, v);
+    problem = Integral(u, v) + Integral(Potential(K, u), v) - Integral(f, v);
+
+    Solver::LDLT(problem).solve();
+    const Math::Vector<Real> expected = u.getSolution().getWeights().value();
+
+    Solver::PartialPivLU(problem).solve();
+    EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(),
+        RODIN_FUZZY_CONSTANT * expected.norm());
+
+    Solver::LLT(problem).solve();
+    EXPECT_LT((u.getSolution().getWeights().value() - expected).norm(),
+        RODIN_FUZZY_CONSTANT * expected.norm());
+  }
+}
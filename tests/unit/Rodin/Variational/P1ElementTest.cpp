@@ -108,4 +108,27 @@ namespace Rodin::Tests::Unit
       }
     }
   }
+
+  TEST(Rodin_Variational_RealP1Element, FuzzyTest_3D_Reference_Tetrahedron_FixedSize)
+  {
+    constexpr size_t n = 25;
+
+    RandomFloat gen(0.0, 1.0);
+    RealP1Element k(Polytope::Type::Tetrahedron);
+
+    const auto& gradients = RealP1Element::getSimplexGradients<3>();
+    for (size_t i = 0; i < n; i++)
+    {
+      const Real s = gen();
+      const Real t = gen();
+      Math::SpatialVector<Real> p{{ s * t, (1 - s) * t, (1 - t) / 2 }};
+      const Math::FixedSizeVector<Real, 4> basis = RealP1Element::getSimplexBasis<3>(p);
+      for (size_t local = 0; local < k.getCount(); local++)
+      {
+        EXPECT_NEAR(basis(local), k.getBasis(local)(p), RODIN_FUZZY_CONSTANT);
+        EXPECT_NEAR((gradients.col(local) - k.getGradient(local)(p)).norm(), 0, RODIN_FUZZY_CONSTANT);
+      }
+    }
+  }
 }
+
@@ -413,5 +413,124 @@ namespace Rodin::Tests::Unit
     lf = Integral(v);
     lf.assemble();
   }
-}
 
+  TEST(Rodin_Variational_Real_P1_BilinearForm, FuzzyTest_UniformGrid_8x8_Apply)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 8, 8 });
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+    BilinearForm bf(u, v);
+    bf = Integral(Grad(u), Grad(v)) + Integral(u, v);
+    bf.assemble();
+
+    Math::Vector<Real> x = Math::Vector<Real>::LinSpaced(fes.getSize(), -1, 1);
+    Math::Vector<Real> y;
+    bf.apply(x, y);
+
+    const Math::Vector<Real> z = bf.getOperator() * x;
+    ASSERT_EQ(y.size(), z.size());
+    for (int i = 0; i < y.size(); i++)
+      EXPECT_NEAR(y(i), z(i), RODIN_FUZZY_CONSTANT);
+  }
+
+  TEST(Rodin_Variational_Real_P1_BilinearForm, FuzzyTest_UniformGrid_8x8_Apply_NotAssembled)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 8, 8 });
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    // The form is never assembled: its action is computed element by element
+    BilinearForm bf(u, v);
+    bf = Integral(Grad(u), Grad(v)) + Integral(u, v);
+
+    BilinearForm ref(u, v);
+    ref = Integral(Grad(u), Grad(v)) + Integral(u, v);
+    ref.assemble();
+
+    Math::Vector<Real> x = Math::Vector<Real>::LinSpaced(fes.getSize(), -1, 1);
+    Math::Vector<Real> y;
+    bf.apply(x, y);
+
+    const Math::Vector<Real> z = ref.getOperator() * x;
+    ASSERT_EQ(y.size(), z.size());
+    for (int i = 0; i < y.size(); i++)
+      EXPECT_NEAR(y(i), z(i), RODIN_FUZZY_CONSTANT);
+
+    const auto op = bf.getLinearOperator();
+    EXPECT_EQ(op.rows(), z.size());
+    EXPECT_EQ(op.cols(), x.size());
+    Math::Vector<Real> w;
+    op.apply(x, w);
+    ASSERT_EQ(w.size(), z.size());
+    for (int i = 0; i < w.size(); i++)
+      EXPECT_NEAR(w(i), z(i), RODIN_FUZZY_CONSTANT);
+  }
+
+  TEST(Rodin_Variational_Real_P1_GridFunction, SaveLoad_MEDIT_ASCII_Binary)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 32, 32 });
+    mesh.scale(1.0 / 31);
+
+    P1 vh(mesh, 2);
+    GridFunction u(vh);
+    u = VectorFunction{
+      [](const Geometry::Point& p) { return p.x() + 2 * p.y(); },
+      [](const Geometry::Point& p) { return p.x() * p.y(); } };
+
+    // The ASCII encoding is written with a limited precision
+    for (const auto& [extension, tolerance] : { std::pair{ ".sol", 1e-6 }, std::pair{ ".solb", 0.0 } })
+    {
+      const auto filename =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%");
+      const auto solfile = filename.string() + extension;
+      u.save(solfile, FileFormat::MEDIT);
+
+      GridFunction mapped(vh);
+      mapped.load(solfile, FileFormat::MEDIT);
+
+      GridFunction streamed(vh);
+      boost::filesystem::ifstream in(solfile, std::ios::binary);
+      GridFunctionLoader<FileFormat::MEDIT, decltype(vh)>(streamed).load(in);
+      boost::filesystem::remove(solfile);
+
+      EXPECT_LE((mapped.getData() - u.getData()).norm(), tolerance * u.getData().norm());
+      EXPECT_LE((streamed.getData() - u.getData()).norm(), tolerance * u.getData().norm());
+    }
+  }
+
+  TEST(Rodin_Variational_Real_P1_GridFunction, SaveAsync_MEDIT)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 32, 32 });
+    mesh.scale(1.0 / 31);
+
+    P1 vh(mesh);
+    GridFunction u(vh);
+
+    // Each save holds the data at the time of the call
+    std::vector<boost::filesystem::path> files;
+    std::vector<std::future<void>> futures;
+    for (size_t i = 0; i < 4; i++)
+    {
+      u = Real(i);
+      files.push_back(
+          boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%-%%%%.solb"));
+      futures.push_back(u.saveAsync(files.back(), FileFormat::MEDIT));
+    }
+    u = Real(-1);
+
+    for (size_t i = 0; i < files.size(); i++)
+    {
+      futures[i].get();
+      GridFunction v(vh);
+      v.load(files[i], FileFormat::MEDIT);
+      boost::filesystem::remove(files[i]);
+      EXPECT_EQ(v.getData().minCoeff(), Real(i));
+      EXPECT_EQ(v.getData().maxCoeff(), Real(i));
+    }
+
+    auto failed = u.saveAsync("/nonexistent/directory/u.sol", FileFormat::MEDIT);
+    EXPECT_THROW(failed.get(), Alert::Exception);
+  }
+}
@@ -0,0 +1,161 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  inline
+  Real K(const Point& x, const Point& y)
+  {
+    return 1.0 / (4 * M_PI * (x - y).norm());
+  }
+
+  TEST(Rodin_Variational_Potential, FuzzyTest_UniformGrid_16x16_QuadraturePointCloud)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+
+    RealFunction f =
+      [](const Point& p)
+      {
+        return 1 + p.x() * p.y();
+      };
+
+    Potential potential(K, f);
+    const auto cloud = potential.getQuadraturePointCloud(mesh);
+    EXPECT_EQ(cloud->getMesh(), &mesh);
+    EXPECT_EQ(potential.getQuadraturePointCloud(mesh), cloud);
+
+    const Potential copy(potential);
+    EXPECT_EQ(copy.getQuadraturePointCloud(mesh), cloud);
+
+    for (const auto polytope : mesh.cells())
+    {
+      const Math::SpatialVector<Real> rc = Math::SpatialVector<Real>::Zero(2);
+      const Point x(polytope, polytope.getTransformation(), std::cref(rc));
+      Real expected = 0;
+      for (const auto cell : mesh.cells())
+      {
+        const QF::GenericPolytopeQuadrature qf(cell.getGeometry());
+        for (size_t i = 0; i < qf.getSize(); i++)
+        {
+          const Point y(cell, cell.getTransformation(), std::cref(qf.getPoint(i)));
+          expected += qf.getWeight(i) * y.getDistortion() * K(x, y) * f(y);
+        }
+      }
+      EXPECT_NEAR(potential(x), expected, RODIN_FUZZY_CONSTANT * std::abs(expected));
+      if (polytope.getIndex() > 8)
+        break;
+    }
+  }
+
+  TEST(Rodin_Variational_Potential, FuzzyTest_UniformGrid_32x32_Treecode)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 32, 32 });
+    mesh.scale(1.0 / 31);
+    P1 fes(mesh);
+
+    RealFunction f =
+      [](const Point& p)
+      {
+        return 1 + p.x() * p.y();
+      };
+
+    GridFunction direct(fes);
+    direct = Potential(K, f);
+
+    Potential treecode(K, f);
+    treecode.setTreecode(1e-6);
+    GridFunction fast(fes);
+    fast = treecode;
+
+    ASSERT_TRUE(treecode.getTreecode());
+    const auto& a = direct.getData();
+    const auto& b = fast.getData();
+    EXPECT_LT((a - b).norm(), 1e-5 * a.norm());
+  }
+
+  TEST(Rodin_Variational_Potential, MutableOperand_UniformGrid_8x8)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 8, 8 });
+    mesh.scale(1.0 / 7);
+
+    Real alpha = 1;
+    RealFunction f =
+      [&](const Point& p)
+      {
+        return alpha * (1 + p.x() * p.y());
+      };
+
+    const auto polytope = mesh.getCell(0);
+    const Math::SpatialVector<Real> rc = Math::SpatialVector<Real>::Zero(2);
+    const Point x(*polytope, polytope->getTransformation(), std::cref(rc));
+
+    // The operand is evaluated at every evaluation by default
+    Potential potential(K, f);
+    const Real a = potential(x);
+    EXPECT_GT(std::abs(a), 0);
+    alpha = 2;
+    EXPECT_NEAR(potential(x), 2 * a, RODIN_FUZZY_CONSTANT * std::abs(a));
+
+    // The cached values are kept until the cache is cleared
+    potential.setOperandCache();
+    EXPECT_NEAR(potential(x), 2 * a, RODIN_FUZZY_CONSTANT * std::abs(a));
+    alpha = 3;
+    EXPECT_NEAR(potential(x), 2 * a, RODIN_FUZZY_CONSTANT * std::abs(a));
+    potential.clearCache();
+    EXPECT_NEAR(potential(x), 3 * a, RODIN_FUZZY_CONSTANT * std::abs(a));
+
+    Potential treecode(K, f);
+    treecode.setTreecode(1e-8);
+    const Real b = treecode(x);
+    EXPECT_NEAR(b, 3 * a, 1e-6 * std::abs(a));
+    alpha = 4;
+    treecode.clearCache();
+    EXPECT_NEAR(treecode(x), 4 * b / 3, RODIN_FUZZY_CONSTANT * std::abs(b));
+  }
+
+  TEST(Rodin_Variational_Potential, MeshChange_UniformGrid_8x8)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 8, 8 });
+    mesh.scale(1.0 / 7);
+
+    RealFunction f =
+      [](const Point& p)
+      {
+        return 1 + p.x() * p.y();
+      };
+
+    Potential potential(K, f);
+    potential.setOperandCache();
+    const auto cloud = potential.getQuadraturePointCloud(mesh);
+    EXPECT_EQ(cloud->getRevision(), mesh.getRevision());
+
+    Potential treecode(K, f);
+    treecode.setTreecode(1e-8);
+
+    for (const Real c : { 1.0, 2.0 })
+    {
+      mesh.scale(c);
+      const auto polytope = mesh.getCell(0);
+      const Math::SpatialVector<Real> rc = Math::SpatialVector<Real>::Zero(2);
+      const Point x(*polytope, polytope->getTransformation(), std::cref(rc));
+
+      const Real expected = Potential(K, f)(x);
+      EXPECT_NEAR(potential(x), expected, RODIN_FUZZY_CONSTANT * std::abs(expected));
+      EXPECT_NEAR(treecode(x), expected, 1e-6 * std::abs(expected));
+      EXPECT_NE(potential.getQuadraturePointCloud(mesh), cloud);
+      EXPECT_EQ(potential.getQuadraturePointCloud(mesh)->getRevision(), mesh.getRevision());
+    }
+  }
+}
@@ -0,0 +1,95 @@
+/*
+ *          Copyright Carlos BRITO PACHECO 2021 - 2023.
+ * Distributed under the Boost Software License, Version 1.0.
+ *       (See accompanying file LICENSE or copy at
+ *          https://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <gtest/gtest.h>
+
+#include "Rodin/Variational.h"
+#include "Rodin/Solver/SparseLU.h"
+
+using namespace Rodin;
+using namespace Rodin::Geometry;
+using namespace Rodin::Variational;
+
+namespace Rodin::Tests::Unit
+{
+  TEST(Rodin_Variational_Problem, Reassemble_UniformGrid_16x16)
+  {
+    Mesh mesh = LocalMesh::UniformGrid(Polytope::Type::Triangle, { 16, 16 });
+    mesh.scale(1.0 / 15);
+    mesh.getConnectivity().compute(1, 2);
+
+    P1 fes(mesh);
+    TrialFunction u(fes);
+    TestFunction v(fes);
+
+    Real k = 1;
+    RealFunction coefficient = [&](const Point& p) { return k * (1 + p.x()); };
+    RealFunction f = 1;
+    RealFunction g = [](const Point& p) { return p.x() - p.y(); };
+
+    // Solves the same problem with a freshly constructed Problem object
+    auto solve =
+      [&](Attribute attr)
+      {
+        TrialFunction w(fes);
+        TestFunction z(fes);
+        Problem fresh(w, z);
+        fresh = Integral(coefficient * Grad(w), Grad(z))
+              + Integral(w, z)
+              - Integral(f, z)
+              + DirichletBC(w, g).on(attr);
+        Solver::SparseLU(fresh).solve();
+        return Math::Vector<Real>(w.getSolution().getWeights().value());
+      };
+
+    auto check =
+      [&](const Math::Vector<Real>& expected)
+      {
+        const auto& actual = u.getSolution().getWeights().value();
+        ASSERT_EQ(actual.size(), expected.size());
+        EXPECT_LT((actual - expected).norm(), 1e-10 * expected.norm());
+      };
+
+    Problem pb(u, v);
+    pb = Integral(coefficient * Grad(u), Grad(v))
+       + Integral(u, v)
+       - Integral(f, v)
+       + DirichletBC(u, g).on(1);
+    Solver::SparseLU lu(pb);
+
+    lu.solve();
+    check(solve(1));
+
+    // Reassembly with changed coefficients and the same boundary
+    k = 4;
+    pb.assemble();
+    lu.solve();
+    check(solve(1));
+
+    // Reassembly after changing the boundary DOFs
+    std::vector<Index> faces;
+    for (auto it = mesh.getBoundary(); !it.end(); ++it)
+    {
+      if (it->getIndex() % 3 == 0)
+        faces.push_back(it->getIndex());
+    }
+    ASSERT_GT(faces.size(), 0);
+    for (const Index i : faces)
+      mesh.setAttribute({ 1, i }, 2);
+
+    pb.assemble();
+    lu.solve();
+    check(solve(1));
+
+    // Reassembly with a new body
+    pb = Integral(coefficient * Grad(u), Grad(v))
+       + Integral(u, v)
+       - Integral(f, v)
+       + DirichletBC(u, g).on(2);
+    lu.solve();
+    check(solve(2));
+  }
+}